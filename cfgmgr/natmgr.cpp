@@ -8198,50 +8198,83 @@ void NatMgr::doTask(Consumer &consumer)
     }
 }
 
-/* To parse the timeout notifications */
-void NatMgr::timeoutNotifications(string op, string data)
+/* To parse the timeout notifications.
+ * Aged out entries are notified in batches, the first key is in the data
+ * and the remaining keys of the batch are in the fields of the notification */
+void NatMgr::timeoutNotifications(string op, string data, vector<FieldValueTuple> &values)
 {
     SWSS_LOG_ENTER();
 
+    vector<string> keys = { data };
+
+    for (auto &fv : values)
+    {
+        keys.push_back(fvField(fv));
+    }
+
     if (op == "SET-SINGLE-NAT")
     {
         SWSS_LOG_INFO("Received set single nat timeout notification");
-        updateDynamicSingleNatConnTrackTimeout(data, NAT_TIMEOUT_MAX);
+        for (auto &key : keys)
+        {
+            updateDynamicSingleNatConnTrackTimeout(key, NAT_TIMEOUT_MAX);
+        }
     }
     else if (op == "AGEOUT-SINGLE-NAT")
     {
-        SWSS_LOG_INFO("Received reset single nat timeout notification");
-        updateDynamicSingleNatConnTrackTimeout(data, NAT_TIMEOUT_LOW);
+        SWSS_LOG_INFO("Received reset single nat timeout notification for %zu entries", keys.size());
+        for (auto &key : keys)
+        {
+            updateDynamicSingleNatConnTrackTimeout(key, NAT_TIMEOUT_LOW);
+        }
     }
     else if (op == "SET-SINGLE-NAPT")
     {
         SWSS_LOG_INFO("Received set single napt timeout notification");
-        updateDynamicSingleNaptConnTrackTimeout(data, NAT_TIMEOUT_MAX);
+        for (auto &key : keys)
+        {
+            updateDynamicSingleNaptConnTrackTimeout(key, NAT_TIMEOUT_MAX);
+        }
     }
     else if (op == "AGEOUT-SINGLE-NAPT")
     {
-        SWSS_LOG_INFO("Received reset single napt timeout notification");
-        updateDynamicSingleNaptConnTrackTimeout(data, NAT_TIMEOUT_LOW);
+        SWSS_LOG_INFO("Received reset single napt timeout notification for %zu entries", keys.size());
+        for (auto &key : keys)
+        {
+            updateDynamicSingleNaptConnTrackTimeout(key, NAT_TIMEOUT_LOW);
+        }
     }
     else if (op == "SET-TWICE-NAT")
     {
         SWSS_LOG_INFO("Received set twice nat timeout notification");
-        updateDynamicTwiceNatConnTrackTimeout(data, NAT_TIMEOUT_MAX);
+        for (auto &key : keys)
+        {
+            updateDynamicTwiceNatConnTrackTimeout(key, NAT_TIMEOUT_MAX);
+        }
     }
     else if (op == "AGEOUT-TWICE-NAT")
     {
-        SWSS_LOG_INFO("Received reset twice nat timeout notification");
-        updateDynamicTwiceNatConnTrackTimeout(data, NAT_TIMEOUT_LOW);
+        SWSS_LOG_INFO("Received reset twice nat timeout notification for %zu entries", keys.size());
+        for (auto &key : keys)
+        {
+            updateDynamicTwiceNatConnTrackTimeout(key, NAT_TIMEOUT_LOW);
+        }
     }
     else if (op == "SET-TWICE-NAPT")
     {
         SWSS_LOG_INFO("Received set twice napt timeout notification");
-        updateDynamicTwiceNaptConnTrackTimeout(data, NAT_TIMEOUT_MAX);
+        for (auto &key : keys)
+        {
+            updateDynamicTwiceNaptConnTrackTimeout(key, NAT_TIMEOUT_MAX);
+        }
     }
     else if (op == "AGEOUT-TWICE-NAPT")
     {
-        SWSS_LOG_INFO("Received reset twice napt timeout notification");
-        updateDynamicTwiceNaptConnTrackTimeout(data, NAT_TIMEOUT_LOW);
+        SWSS_LOG_INFO("Received reset twice napt timeout notification for %zu entries", keys.size());
+        for (auto &key : keys)
+        {
+            updateDynamicTwiceNaptConnTrackTimeout(key, NAT_TIMEOUT_LOW);
+        }
     }
     else
     {
@@ -246,7 +246,7 @@ public:
     void cleanupPoolIpTable();
     void cleanupMangleIpTables();
     bool isPortInitDone(DBConnector *app_db);
-    void timeoutNotifications(std::string op, std::string data);
+    void timeoutNotifications(std::string op, std::string data, std::vector<FieldValueTuple> &values);
     void flushNotifications(std::string op, std::string data);
     void removeStaticNatIptables(const std::string port = NONE_STRING);
     void removeStaticNaptIptables(const std::string port = NONE_STRING);
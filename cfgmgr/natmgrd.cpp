@@ -190,7 +190,7 @@ int main(int argc, char **argv)
                std::vector<swss::FieldValueTuple> values;
 
                timeoutNotificationsConsumer->pop(op, data, values);
-               natmgr->timeoutNotifications(op, data);
+               natmgr->timeoutNotifications(op, data, values);
                continue;
             }
 
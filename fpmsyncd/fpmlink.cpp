@@ -1,6 +1,9 @@
 #include <string.h>
 #include <errno.h>
 #include <system_error>
+#include <algorithm>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
 #include "logger.h"
 #include "netmsg.h"
 #include "netdispatcher.h"
@@ -112,12 +115,14 @@ bool FpmLink::isRawProcessing(struct nlmsghdr *h)
 
 FpmLink::FpmLink(RouteSync *rsync, unsigned short port) :
     MSG_BATCH_SIZE(256),
+    m_routesync(rsync),
     m_bufSize(FPM_MAX_MSG_LEN * MSG_BATCH_SIZE),
-    m_messageBuffer(NULL),
-    m_pos(0),
+    m_readerStop(false),
+    m_readerDone(false),
+    m_readerErrno(0),
+    m_eventFd(-1),
     m_connected(false),
-    m_server_up(false),
-    m_routesync(rsync)
+    m_server_up(false)
 {
     struct sockaddr_in addr = {};
     int true_val = 1;
@@ -156,17 +161,35 @@ FpmLink::FpmLink(RouteSync *rsync, unsigned short port) :
         throw system_error(errno, system_category());
     }
 
+    m_eventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (m_eventFd < 0)
+    {
+        close(m_server_socket);
+        throw system_error(errno, system_category());
+    }
+
     m_server_up = true;
-    m_messageBuffer = new char[m_bufSize];
+
+    m_buffers.resize(RX_BUFFER_COUNT);
+    for (auto &buf : m_buffers)
+    {
+        buf.data = new char[m_bufSize];
+        buf.len = 0;
+        m_freeBuffers.push_back(&buf);
+    }
 }
 
 FpmLink::~FpmLink()
 {
-    delete[] m_messageBuffer;
+    stopReader();
+    for (auto &buf : m_buffers)
+        delete[] buf.data;
     if (m_connected)
         close(m_connection_socket);
     if (m_server_up)
         close(m_server_socket);
+    if (m_eventFd >= 0)
+        close(m_eventFd);
 }
 
 void FpmLink::accept()
@@ -182,12 +205,191 @@ void FpmLink::accept()
     if (m_connection_socket < 0)
         throw system_error(errno, system_category());
 
+    m_connected = true;
+
     SWSS_LOG_INFO("New connection accepted from: %s\n", inet_ntoa(client_addr.sin_addr));
+
+    m_reader = thread(&FpmLink::readerThread, this);
 }
 
 int FpmLink::getFd()
 {
-    return m_connection_socket;
+    return m_eventFd;
+}
+
+void FpmLink::stopReader()
+{
+    if (!m_reader.joinable())
+    {
+        return;
+    }
+
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_readerStop = true;
+    }
+    m_bufferFreed.notify_all();
+
+    /* Unblock the reader thread if it is waiting in read() */
+    shutdown(m_connection_socket, SHUT_RDWR);
+    m_reader.join();
+}
+
+FpmLink::RxBuffer *FpmLink::getFreeBuffer()
+{
+    unique_lock<mutex> lock(m_mutex);
+
+    if (m_freeBuffers.empty() && !m_readerStop)
+    {
+        /*
+         * All buffers are queued for processing. Stop reading the socket
+         * until readData() releases one, zebra is throttled by TCP meanwhile.
+         */
+        m_stats.backPressureEvents++;
+        m_bufferFreed.wait(lock, [this] { return !m_freeBuffers.empty() || m_readerStop; });
+    }
+
+    if (m_readerStop)
+    {
+        return nullptr;
+    }
+
+    RxBuffer *buf = m_freeBuffers.front();
+    m_freeBuffers.pop_front();
+    return buf;
+}
+
+void FpmLink::pushReadyBuffer(RxBuffer *buf, size_t len)
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        buf->len = len;
+        m_readyBuffers.push_back(buf);
+        m_stats.queueDepth = m_readyBuffers.size();
+        m_stats.maxQueueDepth = max(m_stats.maxQueueDepth, m_stats.queueDepth);
+    }
+
+    uint64_t one = 1;
+    if (::write(m_eventFd, &one, sizeof(one)) < 0)
+    {
+        SWSS_LOG_ERROR("Failed to signal FPM receive buffer: %s", strerror(errno));
+    }
+}
+
+void FpmLink::readerThread()
+{
+    RxBuffer *buf = getFreeBuffer();
+    /* Bytes received into buf */
+    size_t pos = 0;
+    /* Bytes of complete FPM messages at the start of buf */
+    size_t complete = 0;
+    int err = 0;
+
+    while (buf)
+    {
+        ssize_t read = ::read(m_connection_socket, buf->data + pos, m_bufSize - pos);
+        if (read == 0)
+            break;
+        if (read < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            err = errno;
+            break;
+        }
+        pos += (size_t)read;
+
+        {
+            lock_guard<mutex> lock(m_mutex);
+            m_stats.rxBytes += (uint64_t)read;
+        }
+
+        /* Only frame boundaries are checked here, messages are validated by readData() */
+        while (pos - complete >= FPM_MSG_HDR_LEN)
+        {
+            fpm_msg_hdr_t *hdr = reinterpret_cast<fpm_msg_hdr_t *>(static_cast<void *>(buf->data + complete));
+            size_t msg_len = fpm_msg_len(hdr);
+            if (msg_len < FPM_MSG_HDR_LEN)
+            {
+                err = EBADMSG;
+                break;
+            }
+            if (pos - complete < msg_len)
+            {
+                break;
+            }
+            complete += msg_len;
+        }
+        if (err)
+        {
+            break;
+        }
+
+        if (complete == 0)
+        {
+            continue;
+        }
+
+        /*
+         * Hand the buffer over right away when readData() has nothing queued
+         * so that a quiet link does not add latency. Otherwise keep filling it
+         * so that a backlog is processed in large batches, but only while more
+         * data is already waiting: the next read() would block otherwise, and
+         * the end of a burst would be held until zebra sends again.
+         */
+        bool idle;
+        {
+            lock_guard<mutex> lock(m_mutex);
+            idle = m_readyBuffers.empty();
+        }
+        int pending = 0;
+        if (!idle && m_bufSize - pos >= FPM_MAX_MSG_LEN &&
+            ioctl(m_connection_socket, FIONREAD, &pending) == 0 && pending > 0)
+        {
+            continue;
+        }
+
+        RxBuffer *next = getFreeBuffer();
+        if (!next)
+        {
+            break;
+        }
+
+        /* Only the partial message at the tail is carried over to the next buffer */
+        memcpy(next->data, buf->data + complete, pos - complete);
+        pos -= complete;
+        pushReadyBuffer(buf, complete);
+        buf = next;
+        complete = 0;
+    }
+
+    {
+        lock_guard<mutex> lock(m_mutex);
+        if (buf)
+        {
+            m_freeBuffers.push_back(buf);
+        }
+        m_readerDone = true;
+        m_readerErrno = err;
+    }
+
+    uint64_t one = 1;
+    if (::write(m_eventFd, &one, sizeof(one)) < 0)
+    {
+        SWSS_LOG_ERROR("Failed to signal FPM connection close: %s", strerror(errno));
+    }
+}
+
+bool FpmLink::hasCachedData()
+{
+    lock_guard<mutex> lock(m_mutex);
+    return !m_readyBuffers.empty() || m_readerDone;
+}
+
+FpmLinkStats FpmLink::getStats()
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_stats;
 }
 
 uint64_t FpmLink::readData()
@@ -195,32 +397,43 @@ uint64_t FpmLink::readData()
     fpm_msg_hdr_t *hdr;
     size_t msg_len;
     size_t start = 0, left;
-    ssize_t read;
+    uint64_t messages = 0, max_msg_len = 0;
+    uint64_t cnt;
+    RxBuffer *buf = nullptr;
 
-    read = ::read(m_connection_socket, m_messageBuffer + m_pos, m_bufSize - m_pos);
-    if (read == 0)
-        throw FpmConnectionClosedException();
-    if (read < 0)
+    /* Reset the eventfd, pending buffers are tracked by m_readyBuffers */
+    if (::read(m_eventFd, &cnt, sizeof(cnt)) < 0 && errno != EAGAIN)
         throw system_error(errno, system_category());
-    m_pos+= (uint32_t)read;
 
-    /* Check for complete messages */
-    while (true)
     {
-        hdr = reinterpret_cast<fpm_msg_hdr_t *>(static_cast<void *>(m_messageBuffer + start));
-        left = m_pos - start;
-        if (left < FPM_MSG_HDR_LEN)
+        lock_guard<mutex> lock(m_mutex);
+        if (!m_readyBuffers.empty())
         {
-            break;
+            buf = m_readyBuffers.front();
+            m_readyBuffers.pop_front();
+            m_stats.queueDepth = m_readyBuffers.size();
         }
-
-        /* fpm_msg_len includes header size */
-        msg_len = fpm_msg_len(hdr);
-        if (left < msg_len)
+        else if (m_readerDone)
         {
-            break;
+            if (m_readerErrno)
+                throw system_error(m_readerErrno, system_category());
+            throw FpmConnectionClosedException();
         }
+    }
 
+    if (!buf)
+    {
+        return 0;
+    }
+
+    /* The reader thread only queues complete messages */
+    while (start < buf->len)
+    {
+        hdr = reinterpret_cast<fpm_msg_hdr_t *>(static_cast<void *>(buf->data + start));
+        left = buf->len - start;
+
+        /* fpm_msg_len includes header size */
+        msg_len = fpm_msg_len(hdr);
         if (!fpm_msg_ok(hdr, left))
         {
             throw system_error(make_error_code(errc::bad_message), "Malformed FPM message received");
@@ -228,11 +441,19 @@ uint64_t FpmLink::readData()
 
         processFpmMessage(hdr);
 
+        messages++;
+        max_msg_len = max(max_msg_len, (uint64_t)msg_len);
         start += msg_len;
     }
 
-    memmove(m_messageBuffer, m_messageBuffer + start, m_pos - start);
-    m_pos = m_pos - (uint32_t)start;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_freeBuffers.push_back(buf);
+        m_stats.rxMessages += messages;
+        m_stats.maxMessageSize = max(m_stats.maxMessageSize, max_msg_len);
+    }
+    m_bufferFreed.notify_one();
+
     return 0;
 }
 
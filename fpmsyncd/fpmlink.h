@@ -10,6 +10,12 @@
 #include <assert.h>
 #include <unistd.h>
 #include <exception>
+#include <cstdint>
+#include <deque>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
 
 #include "selectable.h"
 #include "fpm/fpm.h"
@@ -17,17 +23,36 @@
 
 namespace swss {
 
+/* Ingest counters exported by fpmsyncd to STATE_DB */
+struct FpmLinkStats
+{
+    uint64_t rxBytes = 0;
+    uint64_t rxMessages = 0;
+    uint64_t maxMessageSize = 0;
+    uint64_t queueDepth = 0;
+    uint64_t maxQueueDepth = 0;
+    uint64_t backPressureEvents = 0;
+};
+
 class FpmLink : public Selectable {
 public:
     const int MSG_BATCH_SIZE;
+    /* Number of receive buffers shared between the reader thread and readData() */
+    static const size_t RX_BUFFER_COUNT = 8;
+
     FpmLink(RouteSync *rsync, unsigned short port = FPM_DEFAULT_PORT);
     virtual ~FpmLink();
 
-    /* Wait for connection (blocking) */
+    /* Wait for connection (blocking) and start the reader thread */
     void accept();
 
+    /* Returns the eventfd signalled by the reader thread */
     int getFd() override;
+    /* Processes the complete FPM messages of one filled receive buffer */
     uint64_t readData() override;
+    bool hasCachedData() override;
+
+    FpmLinkStats getStats();
     /* readMe throws FpmConnectionClosedException when connection is lost */
     class FpmConnectionClosedException : public std::exception
     {
@@ -42,10 +67,34 @@ public:
     void processFpmMessage(fpm_msg_hdr_t* hdr);
 
 private:
+    struct RxBuffer
+    {
+        char *data;
+        /* Length of the complete FPM messages held in data */
+        size_t len;
+    };
+
+    void readerThread();
+    RxBuffer *getFreeBuffer();
+    void pushReadyBuffer(RxBuffer *buf, size_t len);
+    void stopReader();
+
     RouteSync *m_routesync;
     unsigned int m_bufSize;
-    char *m_messageBuffer;
-    unsigned int m_pos;
+    std::vector<RxBuffer> m_buffers;
+
+    /* Buffers handed over between the reader thread and readData(), guarded by m_mutex */
+    std::mutex m_mutex;
+    std::condition_variable m_bufferFreed;
+    std::deque<RxBuffer *> m_freeBuffers;
+    std::deque<RxBuffer *> m_readyBuffers;
+    bool m_readerStop;
+    bool m_readerDone;
+    int m_readerErrno;
+    FpmLinkStats m_stats;
+
+    std::thread m_reader;
+    int m_eventFd;
 
     bool m_connected;
     bool m_server_up;
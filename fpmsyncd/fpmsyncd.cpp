@@ -23,6 +23,12 @@ const uint32_t DEFAULT_ROUTING_RESTART_INTERVAL = 120;
 // TODO: support eoiu hold interval config
 const uint32_t DEFAULT_EOIU_HOLD_INTERVAL = 3;
 
+// Interval for exporting FPM ingest counters to STATE_DB
+const uint32_t FPM_STATS_INTERVAL = 10;
+
+#define STATE_FPM_STATS_TABLE_NAME "FPM_STATS_TABLE"
+#define FPM_STATS_KEY "fpm"
+
 // Check if eoiu state reached by both ipv4 and ipv6
 static bool eoiuFlagsSet(Table &bgpStateTable)
 {
@@ -44,6 +50,21 @@ static bool eoiuFlagsSet(Table &bgpStateTable)
     return true;
 }
 
+static void updateFpmStats(Table &fpmStatsTable, FpmLink &fpm)
+{
+    FpmLinkStats stats = fpm.getStats();
+
+    vector<FieldValueTuple> fvs = {
+        {"rx_bytes", to_string(stats.rxBytes)},
+        {"rx_messages", to_string(stats.rxMessages)},
+        {"max_message_size", to_string(stats.maxMessageSize)},
+        {"queue_depth", to_string(stats.queueDepth)},
+        {"max_queue_depth", to_string(stats.maxQueueDepth)},
+        {"back_pressure_events", to_string(stats.backPressureEvents)}
+    };
+    fpmStatsTable.set(FPM_STATS_KEY, fvs);
+}
+
 int main(int argc, char **argv)
 {
     swss::Logger::linkToDbNative("fpmsyncd");
@@ -53,6 +74,7 @@ int main(int argc, char **argv)
 
     DBConnector stateDb("STATE_DB", 0);
     Table bgpStateTable(&stateDb, STATE_BGP_TABLE_NAME);
+    Table fpmStatsTable(&stateDb, STATE_FPM_STATS_TABLE_NAME);
 
     NetDispatcher::getInstance().registerMessageHandler(RTM_NEWROUTE, &sync);
     NetDispatcher::getInstance().registerMessageHandler(RTM_DELROUTE, &sync);
@@ -68,6 +90,7 @@ int main(int argc, char **argv)
             SelectableTimer eoiuCheckTimer(timespec{0, 0});
             // After eoiu flags are detected, start a hold timer before starting reconciliation.
             SelectableTimer eoiuHoldTimer(timespec{0, 0});
+            SelectableTimer fpmStatsTimer(timespec{FPM_STATS_INTERVAL, 0});
            
             /*
              * Pipeline should be flushed right away to deal with state pending
@@ -81,6 +104,9 @@ int main(int argc, char **argv)
 
             s.addSelectable(&fpm);
 
+            fpmStatsTimer.start();
+            s.addSelectable(&fpmStatsTimer);
+
             /* If warm-restart feature is enabled, execute 'restoration' logic */
             bool warmStartEnabled = sync.m_warmStartHelper.checkAndStart();
             if (warmStartEnabled)
@@ -128,7 +154,11 @@ int main(int argc, char **argv)
                  * select() loop.
                  * Note:  route reconciliation always succeeds, it will not be done twice.
                  */
-                if (temps == &warmStartTimer || temps == &eoiuHoldTimer)
+                if (temps == &fpmStatsTimer)
+                {
+                    updateFpmStats(fpmStatsTable, fpm);
+                }
+                else if (temps == &warmStartTimer || temps == &eoiuHoldTimer)
                 {
                     if (temps == &warmStartTimer)
                     {
@@ -8,6 +8,9 @@
 #include "directory.h"
 #include "notifications.h"
 
+#include <algorithm>
+#include <list>
+
 using namespace std;
 using namespace swss;
 
@@ -18,6 +21,7 @@ using namespace swss;
 #define BFD_SRCPORTINIT 49152
 #define BFD_SRCPORTMAX 65536
 #define NUM_BFD_SRCPORT_RETRIES 3
+#define BFD_STATE_COALESCE_WINDOW_MS 200
 
 extern sai_bfd_api_t*       sai_bfd_api;
 extern sai_object_id_t      gSwitchId;
@@ -25,6 +29,7 @@ extern sai_object_id_t      gVirtualRouterId;
 extern PortsOrch*           gPortsOrch;
 extern sai_switch_api_t*    sai_switch_api;
 extern Directory<Orch*>     gDirectory;
+extern size_t               gMaxBulkSize;
 
 const map<string, sai_bfd_session_type_t> session_type_map =
 {
@@ -52,7 +57,9 @@ const map<sai_bfd_session_state_t, string> session_state_lookup =
 
 BfdOrch::BfdOrch(DBConnector *db, string tableName, TableConnector stateDbBfdSessionTable):
     Orch(db, tableName),
-    m_stateBfdSessionTable(stateDbBfdSessionTable.first, stateDbBfdSessionTable.second)
+    bfd_session_bulker(sai_bfd_api, gSwitchId, gMaxBulkSize),
+    m_stateDbPipeline(stateDbBfdSessionTable.first),
+    m_stateBfdSessionTable(&m_stateDbPipeline, stateDbBfdSessionTable.second, true)
 {
     SWSS_LOG_ENTER();
 
@@ -69,9 +76,15 @@ BfdOrch::BfdOrch(DBConnector *db, string tableName, TableConnector stateDbBfdSes
     {
         m_stateBfdSessionTable.del(alias);
     }
+    m_stateDbPipeline.flush();
 
     Orch::addExecutor(bfdStateNotificatier);
     register_state_change_notif = false;
+
+    auto interval = timespec { .tv_sec = 0, .tv_nsec = BFD_STATE_COALESCE_WINDOW_MS * 1000000 };
+    m_stateCoalesceTimer = new SelectableTimer(interval);
+    Orch::addExecutor(new ExecutableTimer(m_stateCoalesceTimer, this, "BFD_STATE_COALESCE_TIMER"));
+    m_stateCoalesceTimerRunning = false;
 }
 
 BfdOrch::~BfdOrch(void)
@@ -83,20 +96,60 @@ void BfdOrch::doTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
 
+    /*
+     * The hardware sessions of all the pending requests are created in one
+     * bulk. A request for a session which is already in the bulk first
+     * flushes it, as its handling depends on the outcome of the previous one.
+     */
+    list<pair<SyncMap::iterator, BfdSessionCreateContext>> pending;
+    set<string> pending_keys;
+
+    auto flush = [&] () {
+        bfd_session_bulker.flush();
+
+        for (auto& task : pending)
+        {
+            if (create_bfd_session_post(task.second))
+            {
+                consumer.m_toSync.erase(task.first);
+            }
+        }
+
+        pending.clear();
+        pending_keys.clear();
+    };
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
-        KeyOpFieldsValuesTuple t = it->second;
+        auto task = it++;
+        KeyOpFieldsValuesTuple t = task->second;
 
         string key =  kfvKey(t);
         string op = kfvOp(t);
         auto data = kfvFieldsValues(t);
 
+        if (pending_keys.find(key) != pending_keys.end())
+        {
+            flush();
+        }
+
         if (op == SET_COMMAND)
         {
-            if (!create_bfd_session(key, data))
+            /* Queue from the stored context, the bulker keeps a pointer to its session id */
+            pending.emplace_back(task, BfdSessionCreateContext());
+            auto& ctx = pending.back().second;
+
+            bool done = create_bfd_session(key, data, ctx);
+            if (ctx.queued)
+            {
+                pending_keys.insert(key);
+                continue;
+            }
+
+            pending.pop_back();
+            if (!done)
             {
-                it++;
                 continue;
             }
         }
@@ -104,7 +157,6 @@ void BfdOrch::doTask(Consumer &consumer)
         {
             if (!remove_bfd_session(key))
             {
-                it++;
                 continue;
             }
         }
@@ -113,8 +165,11 @@ void BfdOrch::doTask(Consumer &consumer)
             SWSS_LOG_ERROR("Unknown operation type %s\n", op.c_str());
         }
 
-        it = consumer.m_toSync.erase(it);
+        consumer.m_toSync.erase(task);
     }
+
+    flush();
+    m_stateDbPipeline.flush();
 }
 
 void BfdOrch::doTask(NotificationConsumer &consumer)
@@ -146,25 +201,146 @@ void BfdOrch::doTask(NotificationConsumer &consumer)
 
             SWSS_LOG_INFO("Get BFD session state change notification id:%" PRIx64 " state: %s", id, session_state_lookup.at(state).c_str());
 
-            if (state != bfd_session_lookup[id].state)
-            {
-                auto key = bfd_session_lookup[id].peer;
-                m_stateBfdSessionTable.hset(key, "state", session_state_lookup.at(state));
+            update_session_state(id, state);
+        }
 
-                SWSS_LOG_NOTICE("BFD session state for %s changed from %s to %s", key.c_str(),
-                            session_state_lookup.at(bfd_session_lookup[id].state).c_str(), session_state_lookup.at(state).c_str());
+        sai_deserialize_free_bfd_session_state_ntf(count, bfdSessionState);
+        m_stateDbPipeline.flush();
+    }
+}
 
-                BfdUpdate update;
-                update.peer = key;
-                update.state = state;
-                notify(SUBJECT_TYPE_BFD_SESSION_STATE_CHANGE, static_cast<void *>(&update));
+void BfdOrch::doTask(SelectableTimer &timer)
+{
+    SWSS_LOG_ENTER();
 
-                bfd_session_lookup[id].state = state;
-            }
+    if (&timer != m_stateCoalesceTimer)
+    {
+        return;
+    }
+
+    auto now = chrono::steady_clock::now();
+    auto window = chrono::milliseconds(BFD_STATE_COALESCE_WINDOW_MS);
+    auto next_deadline = chrono::steady_clock::time_point::max();
+
+    for (auto it = m_pendingStateSessions.begin(); it != m_pendingStateSessions.end();)
+    {
+        auto session = bfd_session_lookup.find(*it);
+        if (session == bfd_session_lookup.end())
+        {
+            it = m_pendingStateSessions.erase(it);
+            continue;
         }
 
-        sai_deserialize_free_bfd_session_state_ntf(count, bfdSessionState);
+        auto& info = session->second;
+        if (now - info.last_update < window)
+        {
+            next_deadline = min(next_deadline, info.last_update + window);
+            it++;
+            continue;
+        }
+
+        /* Only the latest state is published, a flap back to the published state is dropped */
+        if (info.coalesced > 1 || info.pending_state == info.state)
+        {
+            SWSS_LOG_INFO("Coalesced %u state changes of BFD session %s", info.coalesced, info.peer.c_str());
+        }
+        if (info.pending_state != info.state)
+        {
+            publish_session_state(info, info.pending_state);
+        }
+
+        info.pending = false;
+        info.coalesced = 0;
+        it = m_pendingStateSessions.erase(it);
     }
+
+    m_stateCoalesceTimer->stop();
+    m_stateCoalesceTimerRunning = false;
+    if (!m_pendingStateSessions.empty())
+    {
+        arm_state_coalesce_timer(next_deadline);
+    }
+
+    m_stateDbPipeline.flush();
+}
+
+void BfdOrch::update_session_state(sai_object_id_t id, sai_bfd_session_state_t state)
+{
+    auto session = bfd_session_lookup.find(id);
+    if (session == bfd_session_lookup.end())
+    {
+        SWSS_LOG_WARN("Got state change notification of unknown BFD session %" PRIx64, id);
+        return;
+    }
+
+    auto& info = session->second;
+    if (!info.pending)
+    {
+        if (state == info.state)
+        {
+            return;
+        }
+
+        /* A single change is published right away */
+        auto now = chrono::steady_clock::now();
+        if (now - info.last_update >= chrono::milliseconds(BFD_STATE_COALESCE_WINDOW_MS))
+        {
+            publish_session_state(info, state);
+            return;
+        }
+
+        info.pending = true;
+        m_pendingStateSessions.insert(id);
+    }
+
+    /* Changes within the window of the previous one are held until it ends */
+    info.pending_state = state;
+    info.coalesced++;
+
+    arm_state_coalesce_timer(info.last_update + chrono::milliseconds(BFD_STATE_COALESCE_WINDOW_MS));
+}
+
+/* Have the coalescing timer fire at the deadline, unless it fires earlier already */
+void BfdOrch::arm_state_coalesce_timer(chrono::steady_clock::time_point deadline)
+{
+    if (m_stateCoalesceTimerRunning && deadline >= m_stateCoalesceDeadline)
+    {
+        return;
+    }
+
+    /* A zero timeout would disarm the timer */
+    auto delay = chrono::duration_cast<chrono::nanoseconds>(deadline - chrono::steady_clock::now());
+    delay = max(delay, chrono::nanoseconds(chrono::milliseconds(1)));
+
+    auto interval = timespec { .tv_sec = static_cast<time_t>(delay.count() / 1000000000),
+                               .tv_nsec = static_cast<long>(delay.count() % 1000000000) };
+    m_stateCoalesceTimer->setInterval(interval);
+    if (m_stateCoalesceTimerRunning)
+    {
+        m_stateCoalesceTimer->reset();
+    }
+    else
+    {
+        m_stateCoalesceTimer->start();
+        m_stateCoalesceTimerRunning = true;
+    }
+    m_stateCoalesceDeadline = deadline;
+}
+
+void BfdOrch::publish_session_state(BfdSessionStateInfo& info, sai_bfd_session_state_t state)
+{
+    m_stateBfdSessionTable.hset(info.peer, "state", session_state_lookup.at(state));
+
+    SWSS_LOG_NOTICE("BFD session state for %s changed from %s to %s", info.peer.c_str(),
+                session_state_lookup.at(info.state).c_str(), session_state_lookup.at(state).c_str());
+
+    BfdUpdate update;
+    update.peer = info.peer;
+    update.state = state;
+    notify(SUBJECT_TYPE_BFD_SESSION_STATE_CHANGE, static_cast<void *>(&update));
+
+    info.state = state;
+    info.last_update = chrono::steady_clock::now();
 }
 
 bool BfdOrch::register_bfd_state_change_notification(void)
@@ -202,7 +378,7 @@ bool BfdOrch::register_bfd_state_change_notification(void)
     return true;
 }
 
-bool BfdOrch::create_bfd_session(const string& key, const vector<FieldValueTuple>& data)
+bool BfdOrch::create_bfd_session(const string& key, const vector<FieldValueTuple>& data, BfdSessionCreateContext& ctx)
 {
     if (!register_state_change_notif)
     {
@@ -428,17 +604,31 @@ bool BfdOrch::create_bfd_session(const string& key, const vector<FieldValueTuple
 
     fvVector.emplace_back("state", session_state_lookup.at(SAI_BFD_SESSION_STATE_DOWN));
 
-    sai_object_id_t bfd_session_id = SAI_NULL_OBJECT_ID;
-    sai_status_t status = sai_bfd_api->create_bfd_session(&bfd_session_id, gSwitchId, (uint32_t)attrs.size(), attrs.data());
+    ctx.key = key;
+    ctx.state_db_key = get_state_db_key(vrf_name, alias, peer_address);
+    ctx.attrs = move(attrs);
+    ctx.fvs = move(fvVector);
 
-    if (status != SAI_STATUS_SUCCESS)
+    /* Created by the flush of the bulker, completed by create_bfd_session_post */
+    bfd_session_bulker.create_entry(&ctx.bfd_session_id, (uint32_t)ctx.attrs.size(), ctx.attrs.data());
+    ctx.queued = true;
+
+    return true;
+}
+
+bool BfdOrch::create_bfd_session_post(BfdSessionCreateContext& ctx)
+{
+    sai_status_t status = SAI_STATUS_SUCCESS;
+
+    if (ctx.bfd_session_id == SAI_NULL_OBJECT_ID)
     {
-        status = retry_create_bfd_session(bfd_session_id, attrs);
+        /* The bulk does not tell why a session failed, retry it alone with other source ports */
+        status = retry_create_bfd_session(ctx.bfd_session_id, ctx.attrs);
     }
 
     if (status != SAI_STATUS_SUCCESS)
     {
-        SWSS_LOG_ERROR("Failed to create bfd session %s, rv:%d", key.c_str(), status);
+        SWSS_LOG_ERROR("Failed to create bfd session %s, rv:%d", ctx.key.c_str(), status);
         task_process_status handle_status = handleSaiCreateStatus(SAI_API_BFD, status);
         if (handle_status != task_success)
         {
@@ -446,13 +636,16 @@ bool BfdOrch::create_bfd_session(const string& key, const vector<FieldValueTuple
         }
     }
 
-    const string state_db_key = get_state_db_key(vrf_name, alias, peer_address);
-    m_stateBfdSessionTable.set(state_db_key, fvVector);
-    bfd_session_map[key] = bfd_session_id;
-    bfd_session_lookup[bfd_session_id] = {state_db_key, SAI_BFD_SESSION_STATE_DOWN};
+    m_stateBfdSessionTable.set(ctx.state_db_key, ctx.fvs);
+    bfd_session_map[ctx.key] = ctx.bfd_session_id;
+
+    BfdSessionStateInfo info;
+    info.peer = ctx.state_db_key;
+    info.state = SAI_BFD_SESSION_STATE_DOWN;
+    bfd_session_lookup[ctx.bfd_session_id] = info;
 
     BfdUpdate update;
-    update.peer = state_db_key;
+    update.peer = ctx.state_db_key;
     update.state = SAI_BFD_SESSION_STATE_DOWN;
     notify(SUBJECT_TYPE_BFD_SESSION_STATE_CHANGE, static_cast<void *>(&update));
 
@@ -514,6 +707,7 @@ bool BfdOrch::remove_bfd_session(const string& key)
     m_stateBfdSessionTable.del(bfd_session_lookup[bfd_session_id].peer);
     bfd_session_map.erase(key);
     bfd_session_lookup.erase(bfd_session_id);
+    m_pendingStateSessions.erase(bfd_session_id);
 
     return true;
 }
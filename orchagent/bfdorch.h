@@ -1,8 +1,14 @@
 #ifndef SWSS_BFDORCH_H
 #define SWSS_BFDORCH_H
 
+#include <chrono>
+#include <set>
+
 #include "orch.h"
 #include "observer.h"
+#include "bulker.h"
+#include "redispipeline.h"
+#include "timer.h"
 
 struct BfdUpdate
 {
@@ -10,16 +16,41 @@ struct BfdUpdate
     sai_bfd_session_state_t state;
 };
 
+/* Session whose hardware object is created in bulk with the other pending ones */
+struct BfdSessionCreateContext
+{
+    std::string key;
+    std::string state_db_key;
+    std::vector<sai_attribute_t> attrs;
+    std::vector<swss::FieldValueTuple> fvs;
+    sai_object_id_t bfd_session_id = SAI_NULL_OBJECT_ID;
+    bool queued = false;
+};
+
+/* Last published state of a session, and the changes received since */
+struct BfdSessionStateInfo
+{
+    std::string peer;
+    sai_bfd_session_state_t state = SAI_BFD_SESSION_STATE_DOWN;
+    std::chrono::steady_clock::time_point last_update;
+    bool pending = false;
+    sai_bfd_session_state_t pending_state = SAI_BFD_SESSION_STATE_DOWN;
+    /* Number of changes received while pending */
+    uint32_t coalesced = 0;
+};
+
 class BfdOrch: public Orch, public Subject
 {
 public:
     void doTask(Consumer &consumer);
     void doTask(swss::NotificationConsumer &consumer);
+    void doTask(swss::SelectableTimer &timer);
     BfdOrch(swss::DBConnector *db, std::string tableName, TableConnector stateDbBfdSessionTable);
     virtual ~BfdOrch(void);
 
 private:
-    bool create_bfd_session(const std::string& key, const std::vector<swss::FieldValueTuple>& data);
+    bool create_bfd_session(const std::string& key, const std::vector<swss::FieldValueTuple>& data, BfdSessionCreateContext& ctx);
+    bool create_bfd_session_post(BfdSessionCreateContext& ctx);
     bool remove_bfd_session(const std::string& key);
     std::string get_state_db_key(const std::string& vrf_name, const std::string& alias, const swss::IpAddress& peer_address);
 
@@ -30,11 +61,26 @@ private:
     void update_port_number(std::vector<sai_attribute_t> &attrs);
     sai_status_t retry_create_bfd_session(sai_object_id_t &bfd_session_id, vector<sai_attribute_t> attrs);
 
+    void update_session_state(sai_object_id_t id, sai_bfd_session_state_t state);
+    void publish_session_state(BfdSessionStateInfo& info, sai_bfd_session_state_t state);
+    void arm_state_coalesce_timer(std::chrono::steady_clock::time_point deadline);
+
     std::map<std::string, sai_object_id_t> bfd_session_map;
-    std::map<sai_object_id_t, BfdUpdate> bfd_session_lookup;
+    std::map<sai_object_id_t, BfdSessionStateInfo> bfd_session_lookup;
 
+    ObjectBulker<sai_bfd_api_t> bfd_session_bulker;
+
+    /* STATE_DB writes are buffered and flushed once per task */
+    swss::RedisPipeline m_stateDbPipeline;
     swss::Table m_stateBfdSessionTable;
 
+    /* Sessions with state changes held back by the coalescing window */
+    std::set<sai_object_id_t> m_pendingStateSessions;
+    swss::SelectableTimer* m_stateCoalesceTimer;
+    bool m_stateCoalesceTimerRunning;
+    /* End of the earliest coalescing window, when the timer fires next */
+    std::chrono::steady_clock::time_point m_stateCoalesceDeadline;
+
     swss::NotificationConsumer* m_bfdStateNotificationConsumer;
     bool register_state_change_notif;
 };
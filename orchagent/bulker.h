@@ -4,6 +4,7 @@
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
+#include <tuple>
 #include <stdexcept>
 #include <boost/functional/hash.hpp>
 #include <sairedis.h>
@@ -48,6 +49,36 @@ static inline bool operator==(const sai_inseg_entry_t& a, const sai_inseg_entry_
         ;
 }
 
+static inline bool operator==(const sai_nat_entry_key_t& a, const sai_nat_entry_key_t& b)
+{
+    return a.src_ip == b.src_ip
+        && a.dst_ip == b.dst_ip
+        && a.proto == b.proto
+        && a.l4_src_port == b.l4_src_port
+        && a.l4_dst_port == b.l4_dst_port
+        ;
+}
+
+static inline bool operator==(const sai_nat_entry_mask_t& a, const sai_nat_entry_mask_t& b)
+{
+    return a.src_ip == b.src_ip
+        && a.dst_ip == b.dst_ip
+        && a.proto == b.proto
+        && a.l4_src_port == b.l4_src_port
+        && a.l4_dst_port == b.l4_dst_port
+        ;
+}
+
+static inline bool operator==(const sai_nat_entry_t& a, const sai_nat_entry_t& b)
+{
+    return a.switch_id == b.switch_id
+        && a.vr_id == b.vr_id
+        && a.nat_type == b.nat_type
+        && a.data.key == b.data.key
+        && a.data.mask == b.data.mask
+        ;
+}
+
 static inline std::size_t hash_value(const sai_ip_prefix_t& a)
 {
     size_t seed = 0;
@@ -104,6 +135,24 @@ namespace std
             return seed;
         }
     };
+
+    template <>
+    struct hash<sai_nat_entry_t>
+    {
+        size_t operator()(const sai_nat_entry_t& a) const noexcept
+        {
+            size_t seed = 0;
+            boost::hash_combine(seed, a.switch_id);
+            boost::hash_combine(seed, a.vr_id);
+            boost::hash_combine(seed, a.nat_type);
+            boost::hash_combine(seed, a.data.key.src_ip);
+            boost::hash_combine(seed, a.data.key.dst_ip);
+            boost::hash_combine(seed, a.data.key.proto);
+            boost::hash_combine(seed, a.data.key.l4_src_port);
+            boost::hash_combine(seed, a.data.key.l4_dst_port);
+            return seed;
+        }
+    };
 }
 
 // SAI typedef which is not available in SAI 1.5
@@ -126,6 +175,13 @@ typedef sai_status_t (*sai_bulk_set_fdb_entry_attribute_fn)(
         _In_ const sai_attribute_t *attr_list,
         _In_ sai_bulk_op_error_mode_t mode,
         _Out_ sai_status_t *object_statuses);
+typedef sai_status_t (*sai_bulk_get_fdb_entry_attribute_fn)(
+        _In_ uint32_t object_count,
+        _In_ const sai_fdb_entry_t *fdb_entry,
+        _In_ const uint32_t *attr_count,
+        _Inout_ sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses);
 
 template<typename T>
 struct SaiBulkerTraits { };
@@ -141,6 +197,7 @@ struct SaiBulkerTraits<sai_route_api_t>
     using bulk_create_entry_fn = sai_bulk_create_route_entry_fn;
     using bulk_remove_entry_fn = sai_bulk_remove_route_entry_fn;
     using bulk_set_entry_attribute_fn = sai_bulk_set_route_entry_attribute_fn;
+    using bulk_get_entry_attribute_fn = sai_bulk_get_route_entry_attribute_fn;
 };
 
 template<>
@@ -154,6 +211,7 @@ struct SaiBulkerTraits<sai_fdb_api_t>
     using bulk_create_entry_fn = sai_bulk_create_fdb_entry_fn;
     using bulk_remove_entry_fn = sai_bulk_remove_fdb_entry_fn;
     using bulk_set_entry_attribute_fn = sai_bulk_set_fdb_entry_attribute_fn;
+    using bulk_get_entry_attribute_fn = sai_bulk_get_fdb_entry_attribute_fn;
 };
 
 template<>
@@ -181,6 +239,57 @@ struct SaiBulkerTraits<sai_mpls_api_t>
     using bulk_create_entry_fn = sai_bulk_create_inseg_entry_fn;
     using bulk_remove_entry_fn = sai_bulk_remove_inseg_entry_fn;
     using bulk_set_entry_attribute_fn = sai_bulk_set_inseg_entry_attribute_fn;
+    using bulk_get_entry_attribute_fn = sai_bulk_get_inseg_entry_attribute_fn;
+};
+
+template<>
+struct SaiBulkerTraits<sai_nat_api_t>
+{
+    using entry_t = sai_nat_entry_t;
+    using api_t = sai_nat_api_t;
+    using create_entry_fn = sai_create_nat_entry_fn;
+    using remove_entry_fn = sai_remove_nat_entry_fn;
+    using set_entry_attribute_fn = sai_set_nat_entry_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_create_nat_entry_fn;
+    using bulk_remove_entry_fn = sai_bulk_remove_nat_entry_fn;
+    using bulk_set_entry_attribute_fn = sai_bulk_set_nat_entry_attribute_fn;
+    using bulk_get_entry_attribute_fn = sai_bulk_get_nat_entry_attribute_fn;
+};
+
+template<>
+struct SaiBulkerTraits<sai_bfd_api_t>
+{
+    using entry_t = sai_object_id_t;
+    using api_t = sai_bfd_api_t;
+    using create_entry_fn = sai_create_bfd_session_fn;
+    using remove_entry_fn = sai_remove_bfd_session_fn;
+    using set_entry_attribute_fn = sai_set_bfd_session_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_object_create_fn;
+    using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
+};
+
+template<>
+struct SaiBulkerTraits<sai_tunnel_api_t>
+{
+    using entry_t = sai_object_id_t;
+    using api_t = sai_tunnel_api_t;
+    using create_entry_fn = sai_create_tunnel_map_entry_fn;
+    using remove_entry_fn = sai_remove_tunnel_map_entry_fn;
+    using set_entry_attribute_fn = sai_set_tunnel_map_entry_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_object_create_fn;
+    using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
+};
+
+template<>
+struct SaiBulkerTraits<sai_vlan_api_t>
+{
+    using entry_t = sai_object_id_t;
+    using api_t = sai_vlan_api_t;
+    using create_entry_fn = sai_create_vlan_member_fn;
+    using remove_entry_fn = sai_remove_vlan_member_fn;
+    using set_entry_attribute_fn = sai_set_vlan_member_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_object_create_fn;
+    using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
 };
 
 template <typename T>
@@ -298,6 +407,35 @@ public:
         *object_status = SAI_STATUS_NOT_EXECUTED;
     }
 
+    // attr_list is filled on flush, it must stay valid until then
+    sai_status_t get_entry_attribute(
+        _Out_ sai_status_t *object_status,
+        _In_ const Te *entry,
+        _In_ uint32_t attr_count,
+        _Inout_ sai_attribute_t *attr_list)
+    {
+        assert(object_status);
+        if (!object_status) throw std::invalid_argument("object_status is null");
+        assert(entry);
+        if (!entry) throw std::invalid_argument("entry is null");
+        assert(attr_list);
+        if (!attr_list) throw std::invalid_argument("attr_list is null");
+
+        auto rc = getting_entries.emplace(std::piecewise_construct,
+                std::forward_as_tuple(*entry),
+                std::forward_as_tuple(attr_count, attr_list, object_status));
+        bool inserted = rc.second;
+        if (!inserted)
+        {
+            SWSS_LOG_INFO("EntityBulker.get_entry_attribute not inserted %zu\n", getting_entries.size());
+            *object_status = SAI_STATUS_ITEM_ALREADY_EXISTS;
+            return *object_status;
+        }
+
+        *object_status = SAI_STATUS_NOT_EXECUTED;
+        return *object_status;
+    }
+
     void flush()
     {
         // Removing
@@ -385,6 +523,36 @@ public:
 
             setting_entries.clear();
         }
+
+        // Getting
+        if (!getting_entries.empty())
+        {
+            std::vector<Te> rs;
+            std::vector<uint32_t> cs;
+            std::vector<sai_attribute_t*> tss;
+            std::vector<sai_status_t*> status_vector;
+
+            for (auto const& i: getting_entries)
+            {
+                auto const& entry = i.first;
+                sai_status_t *object_status = std::get<2>(i.second);
+                if (*object_status == SAI_STATUS_NOT_EXECUTED)
+                {
+                    rs.push_back(entry);
+                    cs.push_back(std::get<0>(i.second));
+                    tss.push_back(std::get<1>(i.second));
+                    status_vector.push_back(object_status);
+
+                    if (rs.size() >= max_bulk_size)
+                    {
+                        flush_getting_entries(rs, cs, tss, status_vector);
+                    }
+                }
+            }
+            flush_getting_entries(rs, cs, tss, status_vector);
+
+            getting_entries.clear();
+        }
     }
 
     void clear()
@@ -392,6 +560,7 @@ public:
         removing_entries.clear();
         creating_entries.clear();
         setting_entries.clear();
+        getting_entries.clear();
     }
 
     size_t creating_entries_count() const
@@ -409,6 +578,11 @@ public:
         return removing_entries.size();
     }
 
+    size_t getting_entries_count() const
+    {
+        return getting_entries.size();
+    }
+
     size_t creating_entries_count(const Te& entry) const
     {
         return creating_entries.count(entry);
@@ -443,11 +617,21 @@ private:
             sai_status_t *                                  // OUT object_status
     >                                                       removing_entries;
 
+    std::unordered_map<                                     // A map of
+            Te,                                             // entry ->
+            std::tuple<
+                    uint32_t,                               // (attr_count, INOUT attr_list, OUT object_status)
+                    sai_attribute_t *,
+                    sai_status_t *
+            >
+    >                                                       getting_entries;
+
     size_t max_bulk_size;
 
     typename Ts::bulk_create_entry_fn                       create_entries;
     typename Ts::bulk_remove_entry_fn                       remove_entries;
     typename Ts::bulk_set_entry_attribute_fn                set_entries_attribute;
+    typename Ts::bulk_get_entry_attribute_fn                get_entries_attribute = nullptr;
 
     sai_status_t flush_removing_entries(
         _Inout_ std::vector<Te> &rs)
@@ -563,6 +747,53 @@ private:
 
         return status;
     }
+
+    sai_status_t flush_getting_entries(
+        _Inout_ std::vector<Te> &rs,
+        _Inout_ std::vector<uint32_t> &cs,
+        _Inout_ std::vector<sai_attribute_t*> &tss,
+        _Inout_ std::vector<sai_status_t*> &status_vector)
+    {
+        if (rs.empty())
+        {
+            return SAI_STATUS_SUCCESS;
+        }
+        size_t count = rs.size();
+        std::vector<sai_status_t> statuses(count, SAI_STATUS_NOT_EXECUTED);
+        sai_status_t status = SAI_STATUS_NOT_IMPLEMENTED;
+        if (get_entries_attribute)
+        {
+            status = (*get_entries_attribute)((uint32_t)count, rs.data(), cs.data(), tss.data()
+                , SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+        }
+        if (status == SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_INFO("EntityBulker.flush getting_entries, count %zu\n", count);
+        }
+        else
+        {
+            SWSS_LOG_INFO("EntityBulker.flush get entry attribute failed, number of entries to get: %zu, status: %s",
+                            count, sai_serialize_status(status).c_str());
+        }
+
+        for (size_t ir = 0; ir < count; ir++)
+        {
+            sai_status_t *object_status = status_vector[ir];
+            if (object_status)
+            {
+                // Report the bulk failure on the entries the SAI did not process,
+                // so that the caller can fall back to a single entry get
+                *object_status = (statuses[ir] == SAI_STATUS_NOT_EXECUTED && status != SAI_STATUS_SUCCESS) ? status : statuses[ir];
+            }
+        }
+
+        rs.clear();
+        cs.clear();
+        tss.clear();
+        status_vector.clear();
+
+        return status;
+    }
 };
 
 template <>
@@ -572,6 +803,7 @@ inline EntityBulker<sai_route_api_t>::EntityBulker(sai_route_api_t *api, size_t
     create_entries = api->create_route_entries;
     remove_entries = api->remove_route_entries;
     set_entries_attribute = api->set_route_entries_attribute;
+    get_entries_attribute = api->get_route_entries_attribute;
 }
 
 template <>
@@ -594,6 +826,17 @@ inline EntityBulker<sai_mpls_api_t>::EntityBulker(sai_mpls_api_t *api, size_t ma
     create_entries = api->create_inseg_entries;
     remove_entries = api->remove_inseg_entries;
     set_entries_attribute = api->set_inseg_entries_attribute;
+    get_entries_attribute = api->get_inseg_entries_attribute;
+}
+
+template <>
+inline EntityBulker<sai_nat_api_t>::EntityBulker(sai_nat_api_t *api, size_t max_bulk_size) :
+    max_bulk_size(max_bulk_size)
+{
+    create_entries = api->create_nat_entries;
+    remove_entries = api->remove_nat_entries;
+    set_entries_attribute = api->set_nat_entries_attribute;
+    get_entries_attribute = api->get_nat_entries_attribute;
 }
 
 template <typename T>
@@ -612,18 +855,32 @@ public:
         _Out_ sai_object_id_t *object_id,
         _In_ uint32_t attr_count,
         _In_ const sai_attribute_t *attr_list)
+    {
+        return create_entry(object_id, nullptr, attr_count, attr_list);
+    }
+
+    // Same as above, with the per entry status of the bulk call reported in object_status on flush
+    sai_status_t create_entry(
+        _Out_ sai_object_id_t *object_id,
+        _Out_ sai_status_t *object_status,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
     {
         assert(object_id);
         if (!object_id) throw std::invalid_argument("object_id is null");
         assert(attr_list);
         if (!attr_list) throw std::invalid_argument("attr_list is null");
 
-        creating_entries.emplace_back(std::piecewise_construct, std::forward_as_tuple(object_id), std::forward_as_tuple(attr_list, attr_list + attr_count));
+        creating_entries.emplace_back(object_id, object_status, std::vector<sai_attribute_t>(attr_list, attr_list + attr_count));
 
-        auto& last_attrs = std::get<1>(creating_entries.back());
+        auto& last_attrs = std::get<2>(creating_entries.back());
         SWSS_LOG_INFO("ObjectBulker.create_entry %zu, %zu, %u\n", creating_entries.size(), last_attrs.size(), last_attrs[0].id);
 
         *object_id = SAI_NULL_OBJECT_ID; // not created immediately, postponed until flush
+        if (object_status)
+        {
+            *object_status = SAI_STATUS_NOT_EXECUTED;
+        }
         return SAI_STATUS_NOT_EXECUTED;
     }
 
@@ -700,26 +957,29 @@ public:
         if (!creating_entries.empty())
         {
             std::vector<sai_object_id_t *> rs;
+            std::vector<sai_status_t *> pss;
             std::vector<sai_attribute_t const*> tss;
             std::vector<uint32_t> cs;
 
             for (auto const& i: creating_entries)
             {
                 sai_object_id_t *pid = std::get<0>(i);
-                auto const& attrs = std::get<1>(i);
+                sai_status_t *pstatus = std::get<1>(i);
+                auto const& attrs = std::get<2>(i);
                 if (*pid == SAI_NULL_OBJECT_ID)
                 {
                     rs.push_back(pid);
+                    pss.push_back(pstatus);
                     tss.push_back(attrs.data());
                     cs.push_back((uint32_t)attrs.size());
 
                     if (rs.size() >= max_bulk_size)
                     {
-                        flush_creating_entries(rs, tss, cs);
+                        flush_creating_entries(rs, pss, tss, cs);
                     }
                 }
             }
-            flush_creating_entries(rs, tss, cs);
+            flush_creating_entries(rs, pss, tss, cs);
 
             creating_entries.clear();
         }
@@ -793,8 +1053,9 @@ private:
 
     size_t max_bulk_size;
 
-    std::vector<std::pair<                                  // A vector of pair of
+    std::vector<std::tuple<                                 // A vector of tuple of
             sai_object_id_t *,                              // - object_id
+            sai_status_t *,                                 // - OUT object_status, optional
             std::vector<sai_attribute_t>                    // - attrs
     >>                                                      creating_entries;
 
@@ -849,6 +1110,7 @@ private:
 
     sai_status_t flush_creating_entries(
         _Inout_ std::vector<sai_object_id_t *> &rs,
+        _Inout_ std::vector<sai_status_t *> &pss,
         _Inout_ std::vector<sai_attribute_t const*> &tss,
         _Inout_ std::vector<uint32_t> &cs)
     {
@@ -875,9 +1137,14 @@ private:
         {
             sai_object_id_t *pid = rs[i];
             *pid = (statuses[i] == SAI_STATUS_SUCCESS) ? object_ids[i] : SAI_NULL_OBJECT_ID;
+            if (pss[i])
+            {
+                *pss[i] = statuses[i];
+            }
         }
 
         rs.clear();
+        pss.clear();
         tss.clear();
         cs.clear();
 
@@ -926,3 +1193,76 @@ inline ObjectBulker<sai_next_hop_group_api_t>::ObjectBulker(SaiBulkerTraits<sai_
     // TODO: wait until available in SAI
     //set_entries_attribute = ;
 }
+
+// BFD API has no bulk functions, use the generic bulk object API
+static inline sai_status_t sai_bulk_create_bfd_sessions(
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t object_count,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_object_id_t *object_id,
+        _Out_ sai_status_t *object_statuses)
+{
+    return sai_bulk_object_create(switch_id, SAI_OBJECT_TYPE_BFD_SESSION, object_count, attr_count, attr_list,
+                                  mode, object_id, object_statuses);
+}
+
+static inline sai_status_t sai_bulk_remove_bfd_sessions(
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+{
+    return sai_bulk_object_remove(SAI_OBJECT_TYPE_BFD_SESSION, object_count, object_id, mode, object_statuses);
+}
+
+template <>
+inline ObjectBulker<sai_bfd_api_t>::ObjectBulker(SaiBulkerTraits<sai_bfd_api_t>::api_t *, sai_object_id_t switch_id, size_t max_bulk_size) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    create_entries = sai_bulk_create_bfd_sessions;
+    remove_entries = sai_bulk_remove_bfd_sessions;
+}
+
+// Tunnel API has no bulk functions for tunnel map entries, use the generic bulk object API
+static inline sai_status_t sai_bulk_create_tunnel_map_entries(
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t object_count,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_object_id_t *object_id,
+        _Out_ sai_status_t *object_statuses)
+{
+    return sai_bulk_object_create(switch_id, SAI_OBJECT_TYPE_TUNNEL_MAP_ENTRY, object_count, attr_count, attr_list,
+                                  mode, object_id, object_statuses);
+}
+
+static inline sai_status_t sai_bulk_remove_tunnel_map_entries(
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+{
+    return sai_bulk_object_remove(SAI_OBJECT_TYPE_TUNNEL_MAP_ENTRY, object_count, object_id, mode, object_statuses);
+}
+
+template <>
+inline ObjectBulker<sai_tunnel_api_t>::ObjectBulker(SaiBulkerTraits<sai_tunnel_api_t>::api_t *, sai_object_id_t switch_id, size_t max_bulk_size) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    create_entries = sai_bulk_create_tunnel_map_entries;
+    remove_entries = sai_bulk_remove_tunnel_map_entries;
+}
+
+template <>
+inline ObjectBulker<sai_vlan_api_t>::ObjectBulker(SaiBulkerTraits<sai_vlan_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
+    switch_id(switch_id),
+    max_bulk_size(max_bulk_size)
+{
+    create_entries = api->create_vlan_members;
+    remove_entries = api->remove_vlan_members;
+}
@@ -26,6 +26,7 @@ extern sai_object_id_t      gSwitchId;
 extern PortsOrch*           gPortsOrch;
 extern Directory<Orch*>     gDirectory;
 extern bool                 gIsNatSupported;
+extern bool                 gNativeCounterRates;
 
 #define FLEX_COUNTER_UPD_INTERVAL 1
 
@@ -1148,7 +1149,8 @@ bool CoppOrch::trapGroupUpdatePolicer (string trap_group_name,
 
 void CoppOrch::initTrapRatePlugin()
 {
-    if (m_trap_rate_plugin_loaded)
+    /* Trap rates are computed by CounterRateOrch in native mode */
+    if (m_trap_rate_plugin_loaded || gNativeCounterRates)
     {
         return;
     }
@@ -7,6 +7,7 @@
 #include "saihelper.h"
 
 #define CRM_POLLING_INTERVAL "polling_interval"
+#define CRM_HW_POLLING_RATIO "hw_polling_ratio"
 #define CRM_COUNTERS_TABLE_KEY "STATS"
 
 #define CRM_POLLING_INTERVAL_DEFAULT (5 * 60)
@@ -246,7 +247,8 @@ const map<string, CrmResourceType> crmUsedCntsTableMap =
 CrmOrch::CrmOrch(DBConnector *db, string tableName):
     Orch(db, tableName),
     m_countersDb(new DBConnector("COUNTERS_DB", 0)),
-    m_countersCrmTable(new Table(m_countersDb.get(), COUNTERS_CRM_TABLE)),
+    m_countersPipe(new RedisPipeline(m_countersDb.get())),
+    m_countersCrmTable(new Table(m_countersPipe.get(), COUNTERS_CRM_TABLE, true)),
     m_timer(new SelectableTimer(timespec { .tv_sec = CRM_POLLING_INTERVAL_DEFAULT, .tv_nsec = 0 }))
 {
     SWSS_LOG_ENTER();
@@ -260,6 +262,7 @@ CrmOrch::CrmOrch(DBConnector *db, string tableName):
 
     // The CRM stats needs to be populated again
     m_countersCrmTable->del(CRM_COUNTERS_TABLE_KEY);
+    m_countersCrmTable->flush();
 
     // Note: ExecutableTimer will hold m_timer pointer and release the object later
     auto executor = new ExecutableTimer(m_timer, this, "CRM_COUNTERS_POLL");
@@ -339,6 +342,11 @@ void CrmOrch::handleSetCommand(const string& key, const vector<FieldValueTuple>&
                 m_timer->setInterval(interv);
                 m_timer->reset();
             }
+            else if (field == CRM_HW_POLLING_RATIO)
+            {
+                m_hwPollingRatio = to_uint<uint32_t>(value, 1);
+                m_ticksSinceHwPoll = 0;
+            }
             else if (crmThreshTypeResMap.find(field) != crmThreshTypeResMap.end())
             {
                 auto thresholdType = crmThreshTypeMap.at(value);
@@ -393,7 +401,9 @@ void CrmOrch::incCrmResUsedCounter(CrmResourceType resource)
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[CRM_COUNTERS_TABLE_KEY].usedCounter++;
+        auto &cnt = m_resourcesMap.at(resource).countersMap[CRM_COUNTERS_TABLE_KEY];
+        cnt.usedCounter++;
+        decCrmAvailableCounter(cnt);
     }
     catch (...)
     {
@@ -408,7 +418,9 @@ void CrmOrch::decCrmResUsedCounter(CrmResourceType resource)
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[CRM_COUNTERS_TABLE_KEY].usedCounter--;
+        auto &cnt = m_resourcesMap.at(resource).countersMap[CRM_COUNTERS_TABLE_KEY];
+        cnt.usedCounter--;
+        incCrmAvailableCounter(cnt);
     }
     catch (...)
     {
@@ -423,7 +435,9 @@ void CrmOrch::incCrmAclUsedCounter(CrmResourceType resource, sai_acl_stage_t sta
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmAclKey(stage, point)].usedCounter++;
+        auto &cnt = m_resourcesMap.at(resource).countersMap[getCrmAclKey(stage, point)];
+        cnt.usedCounter++;
+        decCrmAvailableCounter(cnt);
     }
     catch (...)
     {
@@ -438,7 +452,9 @@ void CrmOrch::decCrmAclUsedCounter(CrmResourceType resource, sai_acl_stage_t sta
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmAclKey(stage, point)].usedCounter--;
+        auto &cnt = m_resourcesMap.at(resource).countersMap[getCrmAclKey(stage, point)];
+        cnt.usedCounter--;
+        incCrmAvailableCounter(cnt);
 
         // remove acl_entry and acl_counter in this acl table
         if (resource == CrmResourceType::CRM_ACL_TABLE)
@@ -462,6 +478,7 @@ void CrmOrch::decCrmAclUsedCounter(CrmResourceType resource, sai_acl_stage_t sta
 
             // remove ACL_TABLE_STATS in crm database
             m_countersCrmTable->del(getCrmAclTableKey(oid));
+            m_countersCrmTable->flush();
         }
     }
     catch (...)
@@ -477,8 +494,10 @@ void CrmOrch::incCrmAclTableUsedCounter(CrmResourceType resource, sai_object_id_
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)].usedCounter++;
-        m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)].id = tableId;
+        auto &cnt = m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)];
+        cnt.usedCounter++;
+        cnt.id = tableId;
+        decCrmAvailableCounter(cnt);
     }
     catch (...)
     {
@@ -493,7 +512,9 @@ void CrmOrch::decCrmAclTableUsedCounter(CrmResourceType resource, sai_object_id_
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)].usedCounter--;
+        auto &cnt = m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)];
+        cnt.usedCounter--;
+        incCrmAvailableCounter(cnt);
     }
     catch (...)
     {
@@ -502,20 +523,39 @@ void CrmOrch::decCrmAclTableUsedCounter(CrmResourceType resource, sai_object_id_
     }
 }
 
+void CrmOrch::incCrmAvailableCounter(CrmResourceCounter &cnt)
+{
+    // Keep the "available" counter in sync with the used counter hooks between
+    // hardware polls. The value is refreshed from SAI on the next hardware poll.
+    cnt.availableCounter++;
+}
+
+void CrmOrch::decCrmAvailableCounter(CrmResourceCounter &cnt)
+{
+    if (cnt.availableCounter > 0)
+    {
+        cnt.availableCounter--;
+    }
+}
+
 void CrmOrch::doTask(SelectableTimer &timer)
 {
     SWSS_LOG_ENTER();
 
-    getResAvailableCounters();
+    if (++m_ticksSinceHwPoll >= m_hwPollingRatio)
+    {
+        getResAvailableCounters();
+        m_ticksSinceHwPoll = 0;
+    }
+
     updateCrmCountersTable();
     checkCrmThresholds();
 }
 
-bool CrmOrch::getResAvailability(CrmResourceType type, CrmResourceEntry &res)
+bool CrmOrch::getResObjAvailability(CrmResourceType type, CrmResourceEntry &res, sai_status_t &status)
 {
     sai_attribute_t attr;
     uint64_t availCount = 0;
-    sai_status_t status = SAI_STATUS_SUCCESS;
 
     sai_object_type_t objType = crmResSaiObjAttrMap.at(type);
 
@@ -544,45 +584,132 @@ bool CrmOrch::getResAvailability(CrmResourceType type, CrmResourceEntry &res)
         }
 
         status = sai_object_type_get_availability(gSwitchId, objType, attrCount, &attr, &availCount);
+        if (status == SAI_STATUS_SUCCESS)
+        {
+            res.countersMap[CRM_COUNTERS_TABLE_KEY].availableCounter = static_cast<uint32_t>(availCount);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool CrmOrch::handleResAvailabilityStatus(CrmResourceType type, CrmResourceEntry &res, sai_status_t status)
+{
+    if ((status == SAI_STATUS_NOT_SUPPORTED) ||
+        (status == SAI_STATUS_NOT_IMPLEMENTED) ||
+        SAI_STATUS_IS_ATTR_NOT_SUPPORTED(status) ||
+        SAI_STATUS_IS_ATTR_NOT_IMPLEMENTED(status))
+    {
+        // mark unsupported resources
+        res.resStatus = CrmResourceStatus::CRM_RES_NOT_SUPPORTED;
+        SWSS_LOG_NOTICE("CRM resource %s not supported", crmResTypeNameMap.at(type).c_str());
+        return false;
     }
 
-    if ((status != SAI_STATUS_SUCCESS) || (objType == SAI_OBJECT_TYPE_NULL))
+    if (status != SAI_STATUS_SUCCESS)
     {
-        if (crmResSaiAvailAttrMap.find(type) != crmResSaiAvailAttrMap.end())
+        SWSS_LOG_ERROR("Failed to get availability counter for %s CRM resourse", crmResTypeNameMap.at(type).c_str());
+        return false;
+    }
+
+    return true;
+}
+
+void CrmOrch::getResSwitchAvailability(const vector<CrmResourceType> &types)
+{
+    SWSS_LOG_ENTER();
+
+    if (types.empty())
+    {
+        return;
+    }
+
+    vector<sai_attribute_t> attrs(types.size());
+    for (size_t i = 0; i < types.size(); i++)
+    {
+        attrs[i].id = crmResSaiAvailAttrMap.at(types[i]);
+    }
+
+    sai_status_t status = sai_switch_api->get_switch_attribute(gSwitchId, static_cast<uint32_t>(attrs.size()), attrs.data());
+    if (status == SAI_STATUS_SUCCESS)
+    {
+        for (size_t i = 0; i < types.size(); i++)
         {
-            attr.id = crmResSaiAvailAttrMap.at(type);
-            status = sai_switch_api->get_switch_attribute(gSwitchId, 1, &attr);
+            m_resourcesMap.at(types[i]).countersMap[CRM_COUNTERS_TABLE_KEY].availableCounter = attrs[i].value.u32;
         }
 
-        if ((status == SAI_STATUS_NOT_SUPPORTED) ||
-            (status == SAI_STATUS_NOT_IMPLEMENTED) ||
-            SAI_STATUS_IS_ATTR_NOT_SUPPORTED(status) ||
-            SAI_STATUS_IS_ATTR_NOT_IMPLEMENTED(status))
+        return;
+    }
+
+    // A single unsupported attribute fails the whole get. Query the attributes
+    // one by one so that the unsupported ones are excluded from the next polls.
+    for (auto type : types)
+    {
+        auto &res = m_resourcesMap.at(type);
+        sai_attribute_t attr;
+        attr.id = crmResSaiAvailAttrMap.at(type);
+
+        status = sai_switch_api->get_switch_attribute(gSwitchId, 1, &attr);
+        if (handleResAvailabilityStatus(type, res, status))
         {
-            // mark unsupported resources
-            res.resStatus = CrmResourceStatus::CRM_RES_NOT_SUPPORTED;
-            SWSS_LOG_NOTICE("CRM resource %s not supported", crmResTypeNameMap.at(type).c_str());
-            return false;
+            res.countersMap[CRM_COUNTERS_TABLE_KEY].availableCounter = attr.value.u32;
         }
+    }
+}
+
+void CrmOrch::getResAclTableAvailability()
+{
+    SWSS_LOG_ENTER();
 
+    auto &entryCounters = m_resourcesMap.at(CrmResourceType::CRM_ACL_ENTRY).countersMap;
+    auto &counterCounters = m_resourcesMap.at(CrmResourceType::CRM_ACL_COUNTER).countersMap;
+
+    // ACL entry and ACL counter share the same per ACL table keys, so both are read with a single get
+    map<string, sai_object_id_t> tables;
+    for (const auto &cnt : entryCounters)
+    {
+        tables.emplace(cnt.first, cnt.second.id);
+    }
+    for (const auto &cnt : counterCounters)
+    {
+        tables.emplace(cnt.first, cnt.second.id);
+    }
+
+    for (const auto &table : tables)
+    {
+        sai_attribute_t attrs[2];
+        attrs[0].id = crmResSaiAvailAttrMap.at(CrmResourceType::CRM_ACL_ENTRY);
+        attrs[1].id = crmResSaiAvailAttrMap.at(CrmResourceType::CRM_ACL_COUNTER);
+
+        sai_status_t status = sai_acl_api->get_acl_table_attribute(table.second, 2, attrs);
         if (status != SAI_STATUS_SUCCESS)
         {
-            SWSS_LOG_ERROR("Failed to get availability counter for %s CRM resourse", crmResTypeNameMap.at(type).c_str());
-            return false;
+            SWSS_LOG_ERROR("Failed to get ACL table attributes %u, %u , rv:%d", attrs[0].id, attrs[1].id, status);
+            break;
         }
 
-        availCount = attr.value.u32;
-    }
-
-    res.countersMap[CRM_COUNTERS_TABLE_KEY].availableCounter = static_cast<uint32_t>(availCount);
+        auto it = entryCounters.find(table.first);
+        if (it != entryCounters.end())
+        {
+            it->second.availableCounter = attrs[0].value.u32;
+        }
 
-    return true;
+        it = counterCounters.find(table.first);
+        if (it != counterCounters.end())
+        {
+            it->second.availableCounter = attrs[1].value.u32;
+        }
+    }
 }
 
 void CrmOrch::getResAvailableCounters()
 {
     SWSS_LOG_ENTER();
 
+    // Resources that are read from switch attributes are collected and read with a single get
+    vector<CrmResourceType> switchAttrResources;
+
     for (auto &res : m_resourcesMap)
     {
         // ignore unsupported resources
@@ -611,7 +738,20 @@ void CrmOrch::getResAvailableCounters()
             case CrmResourceType::CRM_MPLS_NEXTHOP:
             case CrmResourceType::CRM_SRV6_NEXTHOP:
             {
-                getResAvailability(res.first, res.second);
+                sai_status_t status = SAI_STATUS_SUCCESS;
+                if (getResObjAvailability(res.first, res.second, status))
+                {
+                    break;
+                }
+
+                if (crmResSaiAvailAttrMap.find(res.first) != crmResSaiAvailAttrMap.end())
+                {
+                    switchAttrResources.push_back(res.first);
+                }
+                else
+                {
+                    handleResAvailabilityStatus(res.first, res.second, status);
+                }
                 break;
             }
 
@@ -653,23 +793,14 @@ void CrmOrch::getResAvailableCounters()
             }
 
             case CrmResourceType::CRM_ACL_ENTRY:
-            case CrmResourceType::CRM_ACL_COUNTER:
             {
-                sai_attribute_t attr;
-                attr.id = crmResSaiAvailAttrMap.at(res.first);
-
-                for (auto &cnt : res.second.countersMap)
-                {
-                    sai_status_t status = sai_acl_api->get_acl_table_attribute(cnt.second.id, 1, &attr);
-                    if (status != SAI_STATUS_SUCCESS)
-                    {
-                        SWSS_LOG_ERROR("Failed to get ACL table attribute %u , rv:%d", attr.id, status);
-                        break;
-                    }
-
-                    cnt.second.availableCounter = attr.value.u32;
-                }
+                getResAclTableAvailability();
+                break;
+            }
 
+            case CrmResourceType::CRM_ACL_COUNTER:
+            {
+                // Read together with CRM_ACL_ENTRY
                 break;
             }
 
@@ -678,12 +809,18 @@ void CrmOrch::getResAvailableCounters()
                 return;
         }
     }
+
+    getResSwitchAvailability(switchAttrResources);
 }
 
 void CrmOrch::updateCrmCountersTable()
 {
     SWSS_LOG_ENTER();
 
+    // Collect all the counters per key, so every key is written once and all
+    // the keys are sent to COUNTERS_DB in a single pipeline flush
+    map<string, vector<FieldValueTuple>> counters;
+
     // Update CRM used counters in COUNTERS_DB
     for (const auto &i : crmUsedCntsTableMap)
     {
@@ -691,9 +828,7 @@ void CrmOrch::updateCrmCountersTable()
         {
             for (const auto &cnt : m_resourcesMap.at(i.second).countersMap)
             {
-                FieldValueTuple attr(i.first, to_string(cnt.second.usedCounter));
-                vector<FieldValueTuple> attrs = { attr };
-                m_countersCrmTable->set(cnt.first, attrs);
+                counters[cnt.first].emplace_back(i.first, to_string(cnt.second.usedCounter));
             }
         }
         catch(const out_of_range &e)
@@ -709,9 +844,7 @@ void CrmOrch::updateCrmCountersTable()
         {
             for (const auto &cnt : m_resourcesMap.at(i.second).countersMap)
             {
-                FieldValueTuple attr(i.first, to_string(cnt.second.availableCounter));
-                vector<FieldValueTuple> attrs = { attr };
-                m_countersCrmTable->set(cnt.first, attrs);
+                counters[cnt.first].emplace_back(i.first, to_string(cnt.second.availableCounter));
             }
         }
         catch(const out_of_range &e)
@@ -719,6 +852,13 @@ void CrmOrch::updateCrmCountersTable()
             // expected when a resource is unavailable
         }
     }
+
+    for (const auto &cnt : counters)
+    {
+        m_countersCrmTable->set(cnt.first, cnt.second);
+    }
+
+    m_countersCrmTable->flush();
 }
 
 void CrmOrch::checkCrmThresholds()
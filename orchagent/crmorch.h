@@ -66,6 +66,7 @@ public:
 
 private:
     std::shared_ptr<swss::DBConnector> m_countersDb = nullptr;
+    std::shared_ptr<swss::RedisPipeline> m_countersPipe = nullptr;
     std::shared_ptr<swss::Table> m_countersCrmTable = nullptr;
     swss::SelectableTimer *m_timer = nullptr;
 
@@ -94,13 +95,23 @@ private:
 
     std::chrono::seconds m_pollingInterval;
 
+    // Hardware availability is read once every m_hwPollingRatio timer ticks.
+    // In between, "available" counters are derived from the used counter hooks.
+    uint32_t m_hwPollingRatio = 1;
+    uint32_t m_ticksSinceHwPoll = 0;
+
     std::map<CrmResourceType, CrmResourceEntry> m_resourcesMap;
 
     void doTask(Consumer &consumer);
     void handleSetCommand(const std::string& key, const std::vector<swss::FieldValueTuple>& data);
     void doTask(swss::SelectableTimer &timer);
-    bool getResAvailability(CrmResourceType type, CrmResourceEntry &res);
+    bool getResObjAvailability(CrmResourceType type, CrmResourceEntry &res, sai_status_t &status);
+    bool handleResAvailabilityStatus(CrmResourceType type, CrmResourceEntry &res, sai_status_t status);
+    void getResSwitchAvailability(const std::vector<CrmResourceType> &types);
+    void getResAclTableAvailability();
     void getResAvailableCounters();
+    void incCrmAvailableCounter(CrmResourceCounter &cnt);
+    void decCrmAvailableCounter(CrmResourceCounter &cnt);
     void updateCrmCountersTable();
     void checkCrmThresholds();
     std::string getCrmAclKey(sai_acl_stage_t stage, sai_acl_bind_point_type_t bindPoint);
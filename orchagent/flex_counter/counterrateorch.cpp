@@ -0,0 +1,370 @@
+#include "counterrateorch.h"
+#include "logger.h"
+#include "schema.h"
+
+#include <hiredis/hiredis.h>
+#include <unordered_set>
+
+using namespace std;
+using namespace swss;
+
+#define RATES_TABLE_NAME            "RATES"
+#define RATES_INIT_DONE_FIELD       "INIT_DONE"
+#define COUNTER_RATE_PIPELINE_SIZE  1024
+
+static timespec intervalToTimespec(uint32_t intervalMs)
+{
+    return timespec { .tv_sec = intervalMs / 1000, .tv_nsec = (intervalMs % 1000) * 1000000 };
+}
+
+const vector<CounterRateType> &CounterRateOrch::getCounterRateTypes()
+{
+    /* Same counters and rates as port_rates.lua, rif_rates.lua, trap_rates.lua and tunnel_rates.lua */
+    static const vector<CounterRateType> types =
+    {
+        {
+            COUNTER_RATE_PORT, COUNTERS_PORT_NAME_MAP,
+            {
+                "SAI_PORT_STAT_IF_IN_UCAST_PKTS", "SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS",
+                "SAI_PORT_STAT_IF_OUT_UCAST_PKTS", "SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS",
+                "SAI_PORT_STAT_IF_IN_OCTETS", "SAI_PORT_STAT_IF_OUT_OCTETS"
+            },
+            { { "RX_BPS", { 4 } }, { "RX_PPS", { 0, 1 } }, { "TX_BPS", { 5 } }, { "TX_PPS", { 2, 3 } } },
+            false, 1000
+        },
+        {
+            COUNTER_RATE_RIF, COUNTERS_RIF_NAME_MAP,
+            {
+                "SAI_ROUTER_INTERFACE_STAT_IN_OCTETS", "SAI_ROUTER_INTERFACE_STAT_IN_PACKETS",
+                "SAI_ROUTER_INTERFACE_STAT_OUT_OCTETS", "SAI_ROUTER_INTERFACE_STAT_OUT_PACKETS"
+            },
+            { { "RX_BPS", { 0 } }, { "RX_PPS", { 1 } }, { "TX_BPS", { 2 } }, { "TX_PPS", { 3 } } },
+            false, 1000
+        },
+        {
+            COUNTER_RATE_TRAP, COUNTERS_TRAP_NAME_MAP,
+            { "SAI_COUNTER_STAT_PACKETS" },
+            { { "RX_PPS", { 0 } } },
+            false, 10000
+        },
+        {
+            COUNTER_RATE_TUNNEL, COUNTERS_TUNNEL_NAME_MAP,
+            {
+                "SAI_TUNNEL_STAT_IN_OCTETS", "SAI_TUNNEL_STAT_IN_PACKETS",
+                "SAI_TUNNEL_STAT_OUT_OCTETS", "SAI_TUNNEL_STAT_OUT_PACKETS"
+            },
+            { { "RX_BPS", { 0 } }, { "RX_PPS", { 1 } }, { "TX_BPS", { 2 } }, { "TX_PPS", { 3 } } },
+            true, 10000
+        }
+    };
+
+    return types;
+}
+
+CounterRateOrch::CounterRateOrch(DBConnector *countersDb) :
+    Orch(countersDb, vector<string>()),
+    m_countersDb(countersDb),
+    m_pipeline(countersDb, COUNTER_RATE_PIPELINE_SIZE),
+    m_ratesTable(&m_pipeline, RATES_TABLE_NAME, true)
+{
+    SWSS_LOG_ENTER();
+
+    for (const auto &type : getCounterRateTypes())
+    {
+        /* Started once the flex counter group is enabled */
+        auto timer = new SelectableTimer(intervalToTimespec(type.defaultIntervalMs));
+        Orch::addExecutor(new ExecutableTimer(timer, this, "COUNTER_RATE_" + type.name));
+
+        auto &ctx = m_contexts[type.name];
+        ctx.type = &type;
+        ctx.timer = timer;
+        ctx.intervalMs = type.defaultIntervalMs;
+        ctx.enabled = false;
+    }
+}
+
+void CounterRateOrch::setPollInterval(const string &type, uint32_t intervalMs)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_contexts.find(type);
+    if (it == m_contexts.end() || intervalMs == 0)
+    {
+        return;
+    }
+
+    auto &ctx = it->second;
+    ctx.intervalMs = intervalMs;
+    ctx.timer->setInterval(intervalToTimespec(intervalMs));
+    if (ctx.enabled)
+    {
+        ctx.timer->reset();
+    }
+    SWSS_LOG_NOTICE("Set %s rate poll interval to %u ms", type.c_str(), intervalMs);
+}
+
+void CounterRateOrch::setEnabled(const string &type, bool enabled)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_contexts.find(type);
+    if (it == m_contexts.end() || it->second.enabled == enabled)
+    {
+        return;
+    }
+
+    auto &ctx = it->second;
+    ctx.enabled = enabled;
+    if (enabled)
+    {
+        ctx.timer->start();
+    }
+    else
+    {
+        /* Rates restart from a new snapshot when enabled again */
+        ctx.timer->stop();
+        ctx.entries.clear();
+    }
+    SWSS_LOG_NOTICE("%s %s rate polling", enabled ? "Enabled" : "Disabled", type.c_str());
+}
+
+void CounterRateOrch::doTask(SelectableTimer &timer)
+{
+    SWSS_LOG_ENTER();
+
+    for (const auto &it : m_contexts)
+    {
+        if (it.second.timer == &timer)
+        {
+            pollRates(it.first);
+            return;
+        }
+    }
+}
+
+void CounterRateOrch::updateRates(const CounterRateType &type, CounterRateEntry &entry,
+                                  const vector<uint64_t> &counters, double alpha, double intervalMs)
+{
+    if (entry.state == CounterRateState::NONE)
+    {
+        entry.state = CounterRateState::COUNTERS_LAST;
+        entry.last = counters;
+        return;
+    }
+
+    if (intervalMs <= 0)
+    {
+        return;
+    }
+
+    /* The first rates are stored as is, the next ones are smoothed */
+    bool smooth = entry.state == CounterRateState::DONE;
+    entry.rates.resize(type.rates.size(), 0);
+
+    for (size_t r = 0; r < type.rates.size(); r++)
+    {
+        /* Signed difference: a wrapped counter still gives the right rate
+         * and a cleared one a negative rate, as with the Lua plugins */
+        int64_t diff = 0;
+        for (auto c : type.rates[r].counters)
+        {
+            diff += static_cast<int64_t>(counters[c] - entry.last[c]);
+        }
+
+        double rate = static_cast<double>(diff) / intervalMs * 1000;
+        entry.rates[r] = smooth ? alpha * rate + (1.0 - alpha) * entry.rates[r] : rate;
+    }
+
+    entry.state = CounterRateState::DONE;
+    entry.last = counters;
+}
+
+bool CounterRateOrch::isNewSnapshot(const CounterRateEntry &entry, const vector<uint64_t> &counters,
+                                    double elapsedMs, uint32_t pollIntervalMs)
+{
+    return entry.state == CounterRateState::NONE || entry.last != counters ||
+           elapsedMs >= 2.0 * pollIntervalMs;
+}
+
+bool CounterRateOrch::readCounters(const CounterRateType &type, const vector<string> &oids,
+                                   vector<vector<uint64_t>> &counters, vector<bool> &valid)
+{
+    SWSS_LOG_ENTER();
+
+    redisContext *ctx = m_countersDb->getContext();
+
+    counters.assign(oids.size(), vector<uint64_t>(type.counters.size(), 0));
+    valid.assign(oids.size(), false);
+
+    /* HMGET COUNTERS:<oid> <counters> for all the objects in one batch */
+    vector<const char *> argv(type.counters.size() + 2);
+    vector<size_t> argvlen(type.counters.size() + 2);
+    argv[0] = "HMGET";
+    argvlen[0] = 5;
+    for (size_t c = 0; c < type.counters.size(); c++)
+    {
+        argv[c + 2] = type.counters[c].c_str();
+        argvlen[c + 2] = type.counters[c].size();
+    }
+
+    size_t appended = 0;
+    for (const auto &oid : oids)
+    {
+        string key = string(COUNTERS_TABLE) + ":" + oid;
+        argv[1] = key.c_str();
+        argvlen[1] = key.size();
+
+        RedisCommand hmget;
+        hmget.formatArgv(static_cast<int>(argv.size()), argv.data(), argvlen.data());
+        if (redisAppendFormattedCommand(ctx, hmget.c_str(), hmget.length()) != REDIS_OK)
+        {
+            SWSS_LOG_ERROR("Failed to queue %s counters read of %s", type.name.c_str(), oid.c_str());
+            break;
+        }
+        appended++;
+    }
+
+    /* Every queued command has to be answered to keep the connection usable */
+    for (size_t i = 0; i < appended; i++)
+    {
+        redisReply *reply = nullptr;
+        if (redisGetReply(ctx, reinterpret_cast<void **>(&reply)) != REDIS_OK || !reply)
+        {
+            SWSS_LOG_ERROR("Failed to read %s counters: %s", type.name.c_str(), ctx->errstr);
+            return false;
+        }
+
+        if (reply->type == REDIS_REPLY_ARRAY && reply->elements == type.counters.size())
+        {
+            bool complete = true;
+            for (size_t c = 0; c < reply->elements; c++)
+            {
+                const redisReply *element = reply->element[c];
+                if (element->type == REDIS_REPLY_STRING)
+                {
+                    counters[i][c] = strtoull(element->str, nullptr, 10);
+                }
+                else if (!type.missingAsZero)
+                {
+                    complete = false;
+                }
+            }
+            valid[i] = complete;
+        }
+
+        freeReplyObject(reply);
+    }
+
+    return appended == oids.size();
+}
+
+void CounterRateOrch::pollRates(const string &typeName)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_contexts.find(typeName);
+    if (it == m_contexts.end())
+    {
+        return;
+    }
+
+    auto &ctx = it->second;
+    const auto &type = *ctx.type;
+
+    auto alphaValue = m_countersDb->hget(string(RATES_TABLE_NAME) + ":" + type.name, type.name + "_ALPHA");
+    if (!alphaValue)
+    {
+        SWSS_LOG_DEBUG("Alpha is not defined for %s rates", type.name.c_str());
+        return;
+    }
+
+    double alpha;
+    try
+    {
+        alpha = stod(*alphaValue);
+    }
+    catch (const exception &)
+    {
+        SWSS_LOG_WARN("Invalid %s rates alpha %s", type.name.c_str(), alphaValue->c_str());
+        return;
+    }
+
+    vector<FieldValueTuple> names;
+    Table nameMap(m_countersDb, type.nameMap);
+    nameMap.get("", names);
+
+    vector<string> oids;
+    oids.reserve(names.size());
+    for (const auto &fv : names)
+    {
+        oids.push_back(fvValue(fv));
+    }
+
+    /* Forget the objects which were removed */
+    unordered_set<string> present(oids.begin(), oids.end());
+    for (auto entry = ctx.entries.begin(); entry != ctx.entries.end();)
+    {
+        if (present.find(entry->first) == present.end())
+        {
+            entry = ctx.entries.erase(entry);
+        }
+        else
+        {
+            entry++;
+        }
+    }
+
+    vector<vector<uint64_t>> counters;
+    vector<bool> valid;
+    if (!readCounters(type, oids, counters, valid))
+    {
+        return;
+    }
+
+    /* Rates are computed over the measured time between two snapshots of each object */
+    auto now = chrono::steady_clock::now();
+
+    for (size_t i = 0; i < oids.size(); i++)
+    {
+        if (!valid[i])
+        {
+            SWSS_LOG_DEBUG("Not found some counters on %s", oids[i].c_str());
+            continue;
+        }
+
+        auto &entry = ctx.entries[oids[i]];
+        double elapsedMs = chrono::duration<double, milli>(now - entry.lastUpdate).count();
+        if (!isNewSnapshot(entry, counters[i], elapsedMs, ctx.intervalMs))
+        {
+            continue;
+        }
+
+        auto prevState = entry.state;
+        updateRates(type, entry, counters[i], alpha, elapsedMs);
+        entry.lastUpdate = now;
+
+        vector<FieldValueTuple> fvs;
+        if (entry.state == CounterRateState::DONE)
+        {
+            for (size_t r = 0; r < type.rates.size(); r++)
+            {
+                fvs.emplace_back(type.rates[r].name, to_string(entry.rates[r]));
+            }
+        }
+        for (size_t c = 0; c < type.counters.size(); c++)
+        {
+            fvs.emplace_back(type.counters[c] + "_last", to_string(counters[i][c]));
+        }
+        m_ratesTable.set(oids[i], fvs);
+
+        if (entry.state != prevState)
+        {
+            vector<FieldValueTuple> state = {
+                { RATES_INIT_DONE_FIELD, entry.state == CounterRateState::DONE ? "DONE" : "COUNTERS_LAST" }
+            };
+            m_ratesTable.set(oids[i] + ":" + type.name, state);
+        }
+    }
+
+    m_pipeline.flush();
+}
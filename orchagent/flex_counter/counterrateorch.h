@@ -0,0 +1,112 @@
+#pragma once
+
+#include "dbconnector.h"
+#include "orch.h"
+#include "redispipeline.h"
+#include "table.h"
+#include "timer.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#define COUNTER_RATE_PORT       "PORT"
+#define COUNTER_RATE_RIF        "RIF"
+#define COUNTER_RATE_TRAP       "TRAP"
+#define COUNTER_RATE_TUNNEL     "TUNNEL"
+
+/* Rate of the sum of one or more counters, e.g. RX_PPS */
+struct CounterRate
+{
+    std::string name;
+    std::vector<size_t> counters;
+};
+
+/*
+ * Object type whose rates are computed, following the layout of the
+ * <type>_rates.lua plugins: configuration in RATES:<type>, rates and last
+ * counters in RATES:<oid>, initialization state in RATES:<oid>:<type>.
+ */
+struct CounterRateType
+{
+    std::string name;
+    std::string nameMap;
+    std::vector<std::string> counters;
+    std::vector<CounterRate> rates;
+    /* Missing counters are read as 0 instead of skipping the object */
+    bool missingAsZero;
+    uint32_t defaultIntervalMs;
+};
+
+enum class CounterRateState
+{
+    NONE,
+    COUNTERS_LAST,
+    DONE
+};
+
+struct CounterRateEntry
+{
+    CounterRateState state = CounterRateState::NONE;
+    std::vector<uint64_t> last;
+    std::vector<double> rates;
+    /* Time the last counters were read */
+    std::chrono::steady_clock::time_point lastUpdate;
+};
+
+/*
+ * Native replacement of the port, RIF, trap and tunnel rate Lua plugins,
+ * enabled with orchagent -n. Each poll reads the counters of all objects
+ * of a type in one pipelined batch, computes the rates and their moving
+ * average in memory and writes the results in one pipelined batch, so
+ * Redis is never blocked by a script.
+ */
+class CounterRateOrch : public Orch
+{
+public:
+    CounterRateOrch(swss::DBConnector *countersDb);
+
+    static const std::vector<CounterRateType> &getCounterRateTypes();
+
+    /* Feed a new counter snapshot of an object, intervalMs after the previous one */
+    static void updateRates(const CounterRateType &type, CounterRateEntry &entry,
+                            const std::vector<uint64_t> &counters, double alpha, double intervalMs);
+
+    /*
+     * Counters read twice within the same syncd poll are unchanged, and
+     * using them would give a zero rate followed by a doubled one. They
+     * are only a new snapshot once they changed, or once they have not
+     * changed for two poll intervals, i.e. the counters are idle.
+     */
+    static bool isNewSnapshot(const CounterRateEntry &entry, const std::vector<uint64_t> &counters,
+                              double elapsedMs, uint32_t pollIntervalMs);
+
+    void setPollInterval(const std::string &type, uint32_t intervalMs);
+    /* Rates are only polled while the flex counter group of the type is enabled */
+    void setEnabled(const std::string &type, bool enabled);
+    void pollRates(const std::string &type);
+
+    void doTask(Consumer &consumer) override {}
+    void doTask(swss::SelectableTimer &timer) override;
+
+private:
+    struct RateContext
+    {
+        const CounterRateType *type;
+        swss::SelectableTimer *timer;
+        uint32_t intervalMs;
+        bool enabled;
+        /* Object id, rate entry */
+        std::unordered_map<std::string, CounterRateEntry> entries;
+    };
+
+    swss::DBConnector *m_countersDb;
+    swss::RedisPipeline m_pipeline;
+    swss::Table m_ratesTable;
+    std::unordered_map<std::string, RateContext> m_contexts;
+
+    bool readCounters(const CounterRateType &type, const std::vector<std::string> &oids,
+                      std::vector<std::vector<uint64_t>> &counters, std::vector<bool> &valid);
+};
@@ -14,6 +14,7 @@
 #include "routeorch.h"
 #include "macsecorch.h"
 #include "flowcounterrouteorch.h"
+#include "counterrateorch.h"
 
 extern sai_port_api_t *sai_port_api;
 
@@ -24,6 +25,7 @@ extern BufferOrch *gBufferOrch;
 extern Directory<Orch*> gDirectory;
 extern CoppOrch *gCoppOrch;
 extern FlowCounterRouteOrch *gFlowCounterRouteOrch;
+extern CounterRateOrch *gCounterRateOrch;
 
 #define BUFFER_POOL_WATERMARK_KEY   "BUFFER_POOL_WATERMARK"
 #define PORT_KEY                    "PORT"
@@ -61,6 +63,15 @@ unordered_map<string, string> flexCounterGroupMap =
     {"MACSEC_FLOW", COUNTERS_MACSEC_FLOW_GROUP},
 };
 
+/* Flex counter groups whose counters have their rates computed by CounterRateOrch */
+unordered_map<string, string> counterRateTypeMap =
+{
+    {PORT_KEY, COUNTER_RATE_PORT},
+    {RIF_KEY, COUNTER_RATE_RIF},
+    {FLOW_CNT_TRAP_KEY, COUNTER_RATE_TRAP},
+    {TUNNEL_KEY, COUNTER_RATE_TUNNEL},
+};
+
 
 FlexCounterOrch::FlexCounterOrch(DBConnector *db, vector<string> &tableNames):
     Orch(db, tableNames),
@@ -137,6 +148,10 @@ void FlexCounterOrch::doTask(Consumer &consumer)
                             m_gbflexCounterGroupTable->set(flexCounterGroupMap[key], fieldValues);
                         }
                     }
+                    if (gCounterRateOrch && counterRateTypeMap.count(key))
+                    {
+                        gCounterRateOrch->setPollInterval(counterRateTypeMap[key], static_cast<uint32_t>(strtoul(value.c_str(), nullptr, 10)));
+                    }
                 }
                 else if(field == FLEX_COUNTER_STATUS_FIELD)
                 {
@@ -238,6 +253,10 @@ void FlexCounterOrch::doTask(Consumer &consumer)
                             m_gbflexCounterGroupTable->set(flexCounterGroupMap[key], fieldValues);
                         }
                     }
+                    if (gCounterRateOrch && counterRateTypeMap.count(key))
+                    {
+                        gCounterRateOrch->setEnabled(counterRateTypeMap[key], value == "enable");
+                    }
                 }
                 else if(field == FLEX_COUNTER_DELAY_STATUS_FIELD)
                 {
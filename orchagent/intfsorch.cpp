@@ -37,6 +37,7 @@ extern bool gIsNatSupported;
 extern NeighOrch *gNeighOrch;
 extern string gMySwitchType;
 extern int32_t gVoqMySwitchId;
+extern bool gNativeCounterRates;
 
 const int intfsorch_pri = 35;
 
@@ -86,20 +87,24 @@ IntfsOrch::IntfsOrch(DBConnector *db, string tableName, VRFOrch *vrf_orch, DBCon
 
     string rifRatePluginName = "rif_rates.lua";
 
-    try
+    /* RIF rates are computed by CounterRateOrch in native mode */
+    if (!gNativeCounterRates)
     {
-        string rifRateLuaScript = swss::loadLuaScript(rifRatePluginName);
-        string rifRateSha = swss::loadRedisScript(m_counter_db.get(), rifRateLuaScript);
-
-        vector<FieldValueTuple> fieldValues;
-        fieldValues.emplace_back(RIF_PLUGIN_FIELD, rifRateSha);
-        fieldValues.emplace_back(POLL_INTERVAL_FIELD, RIF_FLEX_STAT_COUNTER_POLL_MSECS);
-        fieldValues.emplace_back(STATS_MODE_FIELD, STATS_MODE_READ);
-        m_flexCounterGroupTable->set(RIF_STAT_COUNTER_FLEX_COUNTER_GROUP, fieldValues);
-    }
-    catch (const runtime_error &e)
-    {
-        SWSS_LOG_WARN("RIF flex counter group plugins was not set successfully: %s", e.what());
+        try
+        {
+            string rifRateLuaScript = swss::loadLuaScript(rifRatePluginName);
+            string rifRateSha = swss::loadRedisScript(m_counter_db.get(), rifRateLuaScript);
+
+            vector<FieldValueTuple> fieldValues;
+            fieldValues.emplace_back(RIF_PLUGIN_FIELD, rifRateSha);
+            fieldValues.emplace_back(POLL_INTERVAL_FIELD, RIF_FLEX_STAT_COUNTER_POLL_MSECS);
+            fieldValues.emplace_back(STATS_MODE_FIELD, STATS_MODE_READ);
+            m_flexCounterGroupTable->set(RIF_STAT_COUNTER_FLEX_COUNTER_GROUP, fieldValues);
+        }
+        catch (const runtime_error &e)
+        {
+            SWSS_LOG_WARN("RIF flex counter group plugins was not set successfully: %s", e.what());
+        }
     }
 
     if(gMySwitchType == "voq")
@@ -0,0 +1,211 @@
+#ifndef SWSS_IPPREFIXTRIE_H
+#define SWSS_IPPREFIXTRIE_H
+
+#include <arpa/inet.h>
+#include <stdint.h>
+#include <memory>
+
+#include "ipaddress.h"
+#include "ipprefix.h"
+
+/*
+ * Binary trie keyed by IP prefix, with separate IPv4 and IPv6 roots.
+ *
+ * A lookup walks at most one node per prefix bit, so finding the entries
+ * covering an address or the entries inside a prefix costs O(prefix length)
+ * plus the number of entries returned, independently of the trie size.
+ */
+template <typename T>
+class IpPrefixTrie
+{
+public:
+    IpPrefixTrie() : m_size(0)
+    {
+    }
+
+    static int maxLength(const swss::IpAddress &ip)
+    {
+        return ip.isV4() ? 32 : 128;
+    }
+
+    size_t size() const
+    {
+        return m_size;
+    }
+
+    bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    /* Insert or overwrite the value of ip/len */
+    void insert(const swss::IpAddress &ip, int len, const T &value)
+    {
+        Node *node = root(ip);
+        for (int i = 0; i < len; i++)
+        {
+            auto &child = node->child[bit(ip, i)];
+            if (!child)
+            {
+                child.reset(new Node());
+            }
+            node = child.get();
+        }
+
+        if (node->value)
+        {
+            *node->value = value;
+        }
+        else
+        {
+            node->value.reset(new T(value));
+            m_size++;
+        }
+    }
+
+    void insert(const swss::IpPrefix &prefix, const T &value)
+    {
+        insert(prefix.getIp(), prefix.getMaskLength(), value);
+    }
+
+    /* Remove ip/len and the nodes left without entries, return false if not found */
+    bool erase(const swss::IpAddress &ip, int len)
+    {
+        return erase(root(ip), ip, 0, len);
+    }
+
+    bool erase(const swss::IpPrefix &prefix)
+    {
+        return erase(prefix.getIp(), prefix.getMaskLength());
+    }
+
+    T *find(const swss::IpAddress &ip, int len)
+    {
+        Node *node = root(ip);
+        for (int i = 0; i < len && node; i++)
+        {
+            node = node->child[bit(ip, i)].get();
+        }
+
+        return node ? node->value.get() : nullptr;
+    }
+
+    T *find(const swss::IpPrefix &prefix)
+    {
+        return find(prefix.getIp(), prefix.getMaskLength());
+    }
+
+    /* Call func(len, value) for every entry covering ip, shortest prefix first */
+    template <typename F>
+    void forEachCovering(const swss::IpAddress &ip, F func)
+    {
+        Node *node = root(ip);
+        int max_len = maxLength(ip);
+        for (int i = 0; node; i++)
+        {
+            if (node->value)
+            {
+                func(i, *node->value);
+            }
+            if (i == max_len)
+            {
+                break;
+            }
+            node = node->child[bit(ip, i)].get();
+        }
+    }
+
+    /* Call func(value) for every entry inside ip/len, ip/len itself included */
+    template <typename F>
+    void forEachCovered(const swss::IpAddress &ip, int len, F func)
+    {
+        Node *node = root(ip);
+        for (int i = 0; i < len && node; i++)
+        {
+            node = node->child[bit(ip, i)].get();
+        }
+
+        if (node)
+        {
+            walk(node, func);
+        }
+    }
+
+    template <typename F>
+    void forEachCovered(const swss::IpPrefix &prefix, F func)
+    {
+        forEachCovered(prefix.getIp(), prefix.getMaskLength(), func);
+    }
+
+private:
+    struct Node
+    {
+        std::unique_ptr<Node> child[2];
+        std::unique_ptr<T> value;
+    };
+
+    Node m_v4Root;
+    Node m_v6Root;
+    size_t m_size;
+
+    Node *root(const swss::IpAddress &ip)
+    {
+        return ip.isV4() ? &m_v4Root : &m_v6Root;
+    }
+
+    /* Bit i of the address, counted from the most significant bit */
+    static int bit(const swss::IpAddress &ip, int i)
+    {
+        if (ip.isV4())
+        {
+            uint32_t addr = ntohl(ip.getV4Addr());
+            return static_cast<int>((addr >> (31 - i)) & 1);
+        }
+
+        return (ip.getV6Addr()[i / 8] >> (7 - i % 8)) & 1;
+    }
+
+    bool erase(Node *node, const swss::IpAddress &ip, int depth, int len)
+    {
+        if (depth == len)
+        {
+            if (!node->value)
+            {
+                return false;
+            }
+            node->value.reset();
+            m_size--;
+            return true;
+        }
+
+        auto &child = node->child[bit(ip, depth)];
+        if (!child || !erase(child.get(), ip, depth + 1, len))
+        {
+            return false;
+        }
+
+        if (!child->value && !child->child[0] && !child->child[1])
+        {
+            child.reset();
+        }
+        return true;
+    }
+
+    template <typename F>
+    static void walk(Node *node, F &func)
+    {
+        if (node->value)
+        {
+            func(*node->value);
+        }
+        for (auto &child : node->child)
+        {
+            if (child)
+            {
+                walk(child.get(), func);
+            }
+        }
+    }
+};
+
+#endif /* SWSS_IPPREFIXTRIE_H */
@@ -50,6 +50,7 @@ MacAddress gMacAddress;
 MacAddress gVxlanMacAddress;
 
 extern size_t gMaxBulkSize;
+extern bool gNativeCounterRates;
 
 #define DEFAULT_BATCH_SIZE  128
 int gBatchSize = DEFAULT_BATCH_SIZE;
@@ -83,7 +84,7 @@ string gMyAsicName = "";
 
 void usage()
 {
-    cout << "usage: orchagent [-h] [-r record_type] [-d record_location] [-f swss_rec_filename] [-j sairedis_rec_filename] [-b batch_size] [-m MAC] [-i INST_ID] [-s] [-z mode] [-k bulk_size]" << endl;
+    cout << "usage: orchagent [-h] [-r record_type] [-d record_location] [-f swss_rec_filename] [-j sairedis_rec_filename] [-b batch_size] [-m MAC] [-i INST_ID] [-s] [-z mode] [-k bulk_size] [-n]" << endl;
     cout << "    -h: display this message" << endl;
     cout << "    -r record_type: record orchagent logs with type (default 3)" << endl;
     cout << "                    Bit 0: sairedis.rec, Bit 1: swss.rec, Bit 2: responsepublisher.rec. For example:" << endl;
@@ -101,6 +102,7 @@ void usage()
     cout << "    -f swss_rec_filename: swss record log filename(default 'swss.rec')" << endl;
     cout << "    -j sairedis_rec_filename: sairedis record log filename(default sairedis.rec)" << endl;
     cout << "    -k max bulk size in bulk mode (default 1000)" << endl;
+    cout << "    -n compute port, RIF, trap and tunnel rates in orchagent instead of the Redis Lua plugins" << endl;
 }
 
 void sighup_handler(int signo)
@@ -352,7 +354,7 @@ int main(int argc, char **argv)
     string responsepublisher_rec_filename = "responsepublisher.rec";
     int record_type = 3; // Only swss and sairedis recordings enabled by default.
 
-    while ((opt = getopt(argc, argv, "b:m:r:f:j:d:i:hsz:k:")) != -1)
+    while ((opt = getopt(argc, argv, "b:m:r:f:j:d:i:hsz:k:n")) != -1)
     {
         switch (opt)
         {
@@ -430,6 +432,10 @@ int main(int argc, char **argv)
                 }
             }
             break;
+        case 'n':
+            gNativeCounterRates = true;
+            SWSS_LOG_NOTICE("Enabling native counter rates");
+            break;
         default: /* '?' */
             exit(EXIT_FAILURE);
         }
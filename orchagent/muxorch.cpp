@@ -24,6 +24,7 @@
 #include "routeorch.h"
 #include "fdborch.h"
 #include "qosorch.h"
+#include "bulker.h"
 
 /* Global variables */
 extern Directory<Orch*> gDirectory;
@@ -38,6 +39,7 @@ extern QosOrch *gQosOrch;
 extern sai_object_id_t gVirtualRouterId;
 extern sai_object_id_t  gUnderlayIfId;
 extern sai_object_id_t gSwitchId;
+extern size_t gMaxBulkSize;
 extern sai_route_api_t* sai_route_api;
 extern sai_tunnel_api_t* sai_tunnel_api;
 extern sai_next_hop_api_t* sai_next_hop_api;
@@ -163,6 +165,91 @@ static sai_status_t remove_route(IpPrefix &pfx)
     return status;
 }
 
+static void update_route_crm(const IpPrefix &pfx, bool add)
+{
+    CrmResourceType type = pfx.isV4() ? CrmResourceType::CRM_IPV4_ROUTE : CrmResourceType::CRM_IPV6_ROUTE;
+    if (add)
+    {
+        gCrmOrch->incCrmResUsedCounter(type);
+    }
+    else
+    {
+        gCrmOrch->decCrmResUsedCounter(type);
+    }
+}
+
+static sai_route_entry_t tunnel_route_entry(const IpPrefix &pfx)
+{
+    sai_route_entry_t route_entry;
+    route_entry.switch_id = gSwitchId;
+    route_entry.vr_id = gVirtualRouterId;
+    copy(route_entry.destination, pfx);
+    subnet(route_entry.destination, route_entry.destination);
+    return route_entry;
+}
+
+/* Create the tunnel routes of several neighbors with a single bulk call */
+static void create_routes(const vector<IpPrefix> &pfxs, sai_object_id_t nh, vector<sai_status_t> &statuses)
+{
+    EntityBulker<sai_route_api_t> bulker(sai_route_api, gMaxBulkSize);
+
+    sai_attribute_t attrs[2];
+    attrs[0].id = SAI_ROUTE_ENTRY_ATTR_PACKET_ACTION;
+    attrs[0].value.s32 = SAI_PACKET_ACTION_FORWARD;
+    attrs[1].id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+    attrs[1].value.oid = nh;
+
+    statuses.assign(pfxs.size(), SAI_STATUS_NOT_EXECUTED);
+    for (size_t i = 0; i < pfxs.size(); i++)
+    {
+        sai_route_entry_t route_entry = tunnel_route_entry(pfxs[i]);
+        bulker.create_entry(&statuses[i], &route_entry, 2, attrs);
+    }
+
+    bulker.flush();
+
+    for (size_t i = 0; i < pfxs.size(); i++)
+    {
+        if (statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to create tunnel route %s,nh %" PRIx64 " rv:%d",
+                    pfxs[i].getIp().to_string().c_str(), nh, statuses[i]);
+            continue;
+        }
+
+        update_route_crm(pfxs[i], true);
+        SWSS_LOG_NOTICE("Created tunnel route to %s ", pfxs[i].to_string().c_str());
+    }
+}
+
+/* Remove the tunnel routes of several neighbors with a single bulk call */
+static void remove_routes(const vector<IpPrefix> &pfxs, vector<sai_status_t> &statuses)
+{
+    EntityBulker<sai_route_api_t> bulker(sai_route_api, gMaxBulkSize);
+
+    statuses.assign(pfxs.size(), SAI_STATUS_NOT_EXECUTED);
+    for (size_t i = 0; i < pfxs.size(); i++)
+    {
+        sai_route_entry_t route_entry = tunnel_route_entry(pfxs[i]);
+        bulker.remove_entry(&statuses[i], &route_entry);
+    }
+
+    bulker.flush();
+
+    for (size_t i = 0; i < pfxs.size(); i++)
+    {
+        if (statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to remove tunnel route %s, rv:%d",
+                            pfxs[i].getIp().to_string().c_str(), statuses[i]);
+            continue;
+        }
+
+        update_route_crm(pfxs[i], false);
+        SWSS_LOG_NOTICE("Removed tunnel route to %s ", pfxs[i].to_string().c_str());
+    }
+}
+
 static sai_object_id_t create_tunnel(
     const IpAddress* p_dst_ip,
     const IpAddress* p_src_ip,
@@ -474,6 +561,8 @@ void MuxCable::setState(string new_state)
 
     st_chg_in_progress_ = true;
 
+    auto start = std::chrono::steady_clock::now();
+
     if (!(this->*(state_machine_handlers_[it->second]))())
     {
         //Reset back to original state
@@ -483,7 +572,11 @@ void MuxCable::setState(string new_state)
         throw std::runtime_error("Failed to handle state transition");
     }
 
+    auto latency = std::chrono::duration_cast<std::chrono::microseconds>(
+                       std::chrono::steady_clock::now() - start);
+
     mux_cb_orch_->updateMuxMetricState(mux_name_, new_state, false);
+    mux_cb_orch_->updateMuxSwitchoverLatency(mux_name_, new_state, static_cast<uint64_t>(latency.count()));
 
     st_chg_in_progress_ = false;
     st_chg_failed_ = false;
@@ -620,133 +713,198 @@ void MuxNbrHandler::update(NextHopKey nh, sai_object_id_t tunnelId, bool add, Mu
     }
 }
 
+/*
+ * The switchover is applied in stages over all the neighbors of the port, so
+ * that the routes, the next hop group members and the tunnel routes of all the
+ * neighbors are each reprogrammed with a single bulk call.
+ */
 bool MuxNbrHandler::enable(bool update_rt)
 {
     NeighborEntry neigh;
+    bool rc = true;
+
+    vector<NextHopKey> nh_keys;
+    nh_keys.reserve(neighbors_.size());
 
-    auto it = neighbors_.begin();
-    while (it != neighbors_.end())
+    for (auto it = neighbors_.begin(); it != neighbors_.end(); it++)
     {
         SWSS_LOG_INFO("Enabling neigh %s on %s", it->first.to_string().c_str(), alias_.c_str());
 
         neigh = NeighborEntry(it->first, alias_);
         if (!gNeighOrch->enableNeighbor(neigh))
         {
+            /* Keep switching the other neighbors, the failure is reported at the end */
             SWSS_LOG_INFO("Enabling neigh failed for %s", neigh.ip_address.to_string().c_str());
-            return false;
+            rc = false;
+            continue;
         }
 
         /* Update NH to point to learned neighbor */
         it->second = gNeighOrch->getLocalNextHopId(neigh);
+        nh_keys.push_back(NextHopKey(it->first, alias_));
+    }
 
-        /* Reprogram route */
-        NextHopKey nh_key = NextHopKey(it->first, alias_);
-        uint32_t num_routes = 0;
-        if (!gRouteOrch->updateNextHopRoutes(nh_key, num_routes))
-        {
-            SWSS_LOG_INFO("Update route failed for NH %s", nh_key.ip_address.to_string().c_str());
-            return false;
-        }
+    if (nh_keys.empty())
+    {
+        return rc;
+    }
 
-        /* Increment ref count for new NHs */
-        gNeighOrch->increaseNextHopRefCount(nh_key, num_routes);
+    /* Reprogram routes */
+    vector<uint32_t> num_routes;
+    bool updated = gRouteOrch->updateNextHopRoutes(nh_keys, num_routes);
 
-        /*
-         * Invalidate current nexthop group and update with new NH
-         * Ref count update is not required for tunnel NH IDs (nh_removed)
-         */
-        uint32_t nh_removed, nh_added;
-        if (!gRouteOrch->invalidnexthopinNextHopGroup(nh_key, nh_removed))
-        {
-            SWSS_LOG_ERROR("Removing existing NH failed for %s", nh_key.ip_address.to_string().c_str());
-            return false;
-        }
+    /* Increment ref count for new NHs */
+    for (size_t i = 0; i < nh_keys.size(); i++)
+    {
+        gNeighOrch->increaseNextHopRefCount(nh_keys[i], num_routes[i]);
+    }
 
-        if (!gRouteOrch->validnexthopinNextHopGroup(nh_key, nh_added))
+    if (!updated)
+    {
+        SWSS_LOG_INFO("Update route failed for NHs on %s", alias_.c_str());
+        return false;
+    }
+
+    /*
+     * Invalidate current nexthop group and update with new NH
+     * Ref count update is not required for tunnel NH IDs (nh_removed)
+     */
+    vector<uint32_t> nh_removed, nh_added;
+    if (!gRouteOrch->invalidnexthopinNextHopGroup(nh_keys, nh_removed))
+    {
+        SWSS_LOG_ERROR("Removing existing NHs failed on %s", alias_.c_str());
+        return false;
+    }
+
+    bool added = gRouteOrch->validnexthopinNextHopGroup(nh_keys, nh_added);
+
+    /* Increment ref count for ECMP NH members */
+    for (size_t i = 0; i < nh_keys.size(); i++)
+    {
+        gNeighOrch->increaseNextHopRefCount(nh_keys[i], nh_added[i]);
+    }
+
+    if (!added)
+    {
+        SWSS_LOG_ERROR("Adding NHs failed on %s", alias_.c_str());
+        return false;
+    }
+
+    if (update_rt)
+    {
+        vector<IpPrefix> pfxs;
+        pfxs.reserve(nh_keys.size());
+        for (const auto &nh_key : nh_keys)
         {
-            SWSS_LOG_ERROR("Adding NH failed for %s", nh_key.ip_address.to_string().c_str());
-            return false;
+            pfxs.push_back(nh_key.ip_address.to_string());
         }
 
-        /* Increment ref count for ECMP NH members */
-        gNeighOrch->increaseNextHopRefCount(nh_key, nh_added);
+        vector<sai_status_t> statuses;
+        remove_routes(pfxs, statuses);
 
-        IpPrefix pfx = it->first.to_string();
-        if (update_rt)
+        for (size_t i = 0; i < nh_keys.size(); i++)
         {
-            if (remove_route(pfx) != SAI_STATUS_SUCCESS)
+            if (statuses[i] != SAI_STATUS_SUCCESS)
             {
-                return false;
+                rc = false;
+                continue;
             }
-            updateTunnelRoute(nh_key, false);
+            updateTunnelRoute(nh_keys[i], false);
         }
-
-        it++;
     }
 
-    return true;
+    return rc;
 }
 
 bool MuxNbrHandler::disable(sai_object_id_t tnh)
 {
     NeighborEntry neigh;
+    bool rc = true;
+
+    vector<NextHopKey> nh_keys;
+    nh_keys.reserve(neighbors_.size());
 
-    auto it = neighbors_.begin();
-    while (it != neighbors_.end())
+    for (auto it = neighbors_.begin(); it != neighbors_.end(); it++)
     {
         SWSS_LOG_INFO("Disabling neigh %s on %s", it->first.to_string().c_str(), alias_.c_str());
 
         /* Update NH to point to Tunnel nexhtop */
         it->second = tnh;
+        nh_keys.push_back(NextHopKey(it->first, alias_));
+    }
 
-        /* Reprogram route */
-        NextHopKey nh_key = NextHopKey(it->first, alias_);
-        uint32_t num_routes = 0;
-        if (!gRouteOrch->updateNextHopRoutes(nh_key, num_routes))
-        {
-            SWSS_LOG_INFO("Update route failed for NH %s", nh_key.ip_address.to_string().c_str());
-            return false;
-        }
+    if (nh_keys.empty())
+    {
+        return true;
+    }
 
-        /* Decrement ref count for old NHs */
-        gNeighOrch->decreaseNextHopRefCount(nh_key, num_routes);
+    /* Reprogram routes */
+    vector<uint32_t> num_routes;
+    bool updated = gRouteOrch->updateNextHopRoutes(nh_keys, num_routes);
 
-        /* Invalidate current nexthop group and update with new NH */
-        uint32_t nh_removed, nh_added;
-        if (!gRouteOrch->invalidnexthopinNextHopGroup(nh_key, nh_removed))
-        {
-            SWSS_LOG_ERROR("Removing existing NH failed for %s", nh_key.ip_address.to_string().c_str());
-            return false;
-        }
+    /* Decrement ref count for old NHs */
+    for (size_t i = 0; i < nh_keys.size(); i++)
+    {
+        gNeighOrch->decreaseNextHopRefCount(nh_keys[i], num_routes[i]);
+    }
 
-        /* Decrement ref count for ECMP NH members */
-        gNeighOrch->decreaseNextHopRefCount(nh_key, nh_removed);
+    if (!updated)
+    {
+        SWSS_LOG_INFO("Update route failed for NHs on %s", alias_.c_str());
+        return false;
+    }
 
-        if (!gRouteOrch->validnexthopinNextHopGroup(nh_key, nh_added))
-        {
-            SWSS_LOG_ERROR("Adding NH failed for %s", nh_key.ip_address.to_string().c_str());
-            return false;
-        }
+    /* Invalidate current nexthop group and update with new NH */
+    vector<uint32_t> nh_removed, nh_added;
+    bool removed = gRouteOrch->invalidnexthopinNextHopGroup(nh_keys, nh_removed);
 
-        neigh = NeighborEntry(it->first, alias_);
+    /* Decrement ref count for ECMP NH members */
+    for (size_t i = 0; i < nh_keys.size(); i++)
+    {
+        gNeighOrch->decreaseNextHopRefCount(nh_keys[i], nh_removed[i]);
+    }
+
+    if (!removed)
+    {
+        SWSS_LOG_ERROR("Removing existing NHs failed on %s", alias_.c_str());
+        return false;
+    }
+
+    if (!gRouteOrch->validnexthopinNextHopGroup(nh_keys, nh_added))
+    {
+        SWSS_LOG_ERROR("Adding NHs failed on %s", alias_.c_str());
+        return false;
+    }
+
+    vector<IpPrefix> pfxs;
+    pfxs.reserve(nh_keys.size());
+
+    for (const auto &nh_key : nh_keys)
+    {
+        neigh = NeighborEntry(nh_key.ip_address, alias_);
         if (!gNeighOrch->disableNeighbor(neigh))
         {
             SWSS_LOG_INFO("Disabling neigh failed for %s", neigh.ip_address.to_string().c_str());
-            return false;
+            rc = false;
+            continue;
         }
 
         updateTunnelRoute(nh_key, true);
+        pfxs.push_back(nh_key.ip_address.to_string());
+    }
 
-        IpPrefix pfx = it->first.to_string();
-        if (create_route(pfx, it->second) != SAI_STATUS_SUCCESS)
+    vector<sai_status_t> statuses;
+    create_routes(pfxs, tnh, statuses);
+
+    for (auto status : statuses)
+    {
+        if (status != SAI_STATUS_SUCCESS)
         {
-            return false;
+            rc = false;
         }
-
-        it++;
     }
 
-    return true;
+    return rc;
 }
 
 sai_object_id_t MuxNbrHandler::getNextHopId(const NextHopKey nhKey)
@@ -975,16 +1133,42 @@ sai_object_id_t MuxOrch::getNextHopTunnelId(std::string tunnelKey, IpAddress& ip
 
 MuxCable* MuxOrch::findMuxCableInSubnet(IpAddress ip)
 {
-    for (auto it = mux_cable_tb_.begin(); it != mux_cable_tb_.end(); it++)
+    /* Cable with the longest server prefix covering the IP */
+    MuxCable* cable = nullptr;
+    mux_subnet_index_.forEachCovering(ip, [&cable](int, MuxCable* ptr) { cable = ptr; });
+
+    return cable;
+}
+
+void MuxOrch::addSubnetIndex(MuxCable* cable)
+{
+    mux_subnet_index_.insert(cable->getServerIpv4(), cable);
+    mux_subnet_index_.insert(cable->getServerIpv6(), cable);
+}
+
+void MuxOrch::removeSubnetIndex(MuxCable* cable)
+{
+    for (const auto& pfx : { cable->getServerIpv4(), cable->getServerIpv6() })
     {
-       MuxCable* ptr = it->second.get();
-       if (ptr->isIpInSubnet(ip))
-       {
-           return ptr;
-       }
-    }
+        MuxCable** indexed = mux_subnet_index_.find(pfx);
+        if (!indexed || *indexed != cable)
+        {
+            continue;
+        }
 
-    return nullptr;
+        mux_subnet_index_.erase(pfx);
+
+        /* Hand the prefix over to another cable configured with the same one */
+        for (const auto& it : mux_cable_tb_)
+        {
+            MuxCable* other = it.second.get();
+            if (other != cable && (other->getServerIpv4() == pfx || other->getServerIpv6() == pfx))
+            {
+                mux_subnet_index_.insert(pfx, other);
+                break;
+            }
+        }
+    }
 }
 
 bool MuxOrch::isNeighborActive(const IpAddress& nbr, const MacAddress& mac, string& alias)
@@ -1043,6 +1227,13 @@ bool MuxOrch::getMuxPort(const MacAddress& mac, const string& alias, string& por
         return false;
     }
 
+    auto cached = fdb_port_cache_.find(std::make_pair(mac, rif.m_vlan_info.vlan_oid));
+    if (cached != fdb_port_cache_.end())
+    {
+        portName = cached->second;
+        return true;
+    }
+
     if (!gFdbOrch->getPort(mac, rif.m_vlan_info.vlan_id, port))
     {
         SWSS_LOG_INFO("FDB entry not found: Vlan %s, mac %s", alias.c_str(), mac.to_string().c_str());
@@ -1055,6 +1246,16 @@ bool MuxOrch::getMuxPort(const MacAddress& mac, const string& alias, string& por
 
 void MuxOrch::updateFdb(const FdbUpdate& update)
 {
+    auto key = std::make_pair(update.entry.mac, update.entry.bv_id);
+    if (update.add && !update.entry.port_name.empty())
+    {
+        fdb_port_cache_[key] = update.entry.port_name;
+    }
+    else
+    {
+        fdb_port_cache_.erase(key);
+    }
+
     if (!update.add)
     {
         /*
@@ -1097,6 +1298,14 @@ void MuxOrch::updateFdb(const FdbUpdate& update)
     }
 }
 
+void MuxOrch::updateFdbFlush(const FdbFlushUpdate& update)
+{
+    for (const auto& entry : update.entries)
+    {
+        fdb_port_cache_.erase(std::make_pair(entry.mac, entry.bv_id));
+    }
+}
+
 void MuxOrch::updateNeighbor(const NeighborUpdate& update)
 {
     if (mux_cable_tb_.empty())
@@ -1135,14 +1344,11 @@ void MuxOrch::updateNeighbor(const NeighborUpdate& update)
         removeStandaloneTunnelRoute(update.entry.ip_address);
     }
 
-    for (auto it = mux_cable_tb_.begin(); it != mux_cable_tb_.end(); it++)
+    MuxCable* cable = findMuxCableInSubnet(update.entry.ip_address);
+    if (cable)
     {
-        MuxCable* ptr = it->second.get();
-        if (ptr->isIpInSubnet(update.entry.ip_address))
-        {
-            ptr->updateNeighbor(update.entry, update.add);
-            return;
-        }
+        cable->updateNeighbor(update.entry, update.add);
+        return;
     }
 
     string port, old_port;
@@ -1251,6 +1457,12 @@ void MuxOrch::update(SubjectType type, void *cntx)
             updateFdb(*update);
             break;
         }
+        case SUBJECT_TYPE_FDB_FLUSH_CHANGE:
+        {
+            FdbFlushUpdate *update = static_cast<FdbFlushUpdate *>(cntx);
+            updateFdbFlush(*update);
+            break;
+        }
         default:
             /* Received update in which we are not interested
              * Ignore it
@@ -1326,6 +1538,7 @@ bool MuxOrch::handleMuxCfg(const Request& request)
 
         mux_cable_tb_[port_name] = std::make_unique<MuxCable>
                                    (MuxCable(port_name, srv_ip, srv_ip6, mux_peer_switch_, cable_type));
+        addSubnetIndex(mux_cable_tb_[port_name].get());
         addSkipNeighbors(skip_neighbors);
 
         SWSS_LOG_NOTICE("Mux entry for port '%s' was added, cable type %d", port_name.c_str(), cable_type);
@@ -1339,6 +1552,7 @@ bool MuxOrch::handleMuxCfg(const Request& request)
         }
 
         removeSkipNeighbors(skip_neighbors);
+        removeSubnetIndex(mux_cable_tb_[port_name].get());
         mux_cable_tb_.erase(port_name);
 
         SWSS_LOG_NOTICE("Mux cable for port '%s' was removed", port_name.c_str());
@@ -1521,6 +1735,11 @@ void MuxCableOrch::updateMuxMetricState(string portName, string muxState, bool s
     mux_metric_table_.hset(portName, msg, time);
 }
 
+void MuxCableOrch::updateMuxSwitchoverLatency(string portName, string muxState, uint64_t latencyUs)
+{
+    mux_metric_table_.hset(portName, "orch_switch_" + muxState + "_latency_us", to_string(latencyUs));
+}
+
 void MuxCableOrch::addTunnelRoute(const NextHopKey &nhKey)
 {
     vector<FieldValueTuple> data;
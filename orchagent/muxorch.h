@@ -10,6 +10,7 @@
 #include "tunneldecaporch.h"
 #include "aclorch.h"
 #include "neighorch.h"
+#include "ipprefixtrie.h"
 
 enum MuxState
 {
@@ -101,6 +102,8 @@ public:
     bool isStateChangeFailed() { return st_chg_failed_; }
 
     bool isIpInSubnet(IpAddress ip);
+    const IpPrefix& getServerIpv4() const { return srv_ip4_; }
+    const IpPrefix& getServerIpv6() const { return srv_ip6_; }
     void updateNeighbor(NextHopKey nh, bool add);
     sai_object_id_t getNextHopId(const NextHopKey nh)
     {
@@ -158,6 +161,10 @@ typedef std::unique_ptr<MuxCable> MuxCable_T;
 typedef std::map<std::string, MuxCable_T> MuxCableTb;
 typedef std::map<IpAddress, NHTunnel> MuxTunnelNHs;
 typedef std::map<NextHopKey, std::string> NextHopTb;
+// Server prefix -> mux cable, for the longest prefix match of neighbor IPs
+typedef IpPrefixTrie<MuxCable*> MuxSubnetIndex;
+// (MAC, vlan OID) -> port, as last notified by FdbOrch
+typedef std::map<std::pair<MacAddress, sai_object_id_t>, std::string> MuxFdbPortCache;
 
 class MuxCfgRequest : public Request
 {
@@ -211,6 +218,10 @@ private:
 
     void updateNeighbor(const NeighborUpdate&);
     void updateFdb(const FdbUpdate&);
+    void updateFdbFlush(const FdbFlushUpdate&);
+
+    void addSubnetIndex(MuxCable*);
+    void removeSubnetIndex(MuxCable*);
 
     bool getMuxPort(const MacAddress&, const string&, string&);
 
@@ -240,6 +251,8 @@ private:
     MuxCableTb mux_cable_tb_;
     MuxTunnelNHs mux_tunnel_nh_;
     NextHopTb mux_nexthop_tb_;
+    MuxSubnetIndex mux_subnet_index_;
+    MuxFdbPortCache fdb_port_cache_;
 
     handler_map handler_map_;
 
@@ -273,6 +286,8 @@ public:
 
     void updateMuxState(string portName, string muxState);
     void updateMuxMetricState(string portName, string muxState, bool start);
+    /* Time taken by orchagent to apply a switchover, written to STATE_DB */
+    void updateMuxSwitchoverLatency(string portName, string muxState, uint64_t latencyUs);
     void addTunnelRoute(const NextHopKey &nhKey);
     void removeTunnelRoute(const NextHopKey &nhKey);
 
@@ -15,6 +15,7 @@
  */
 
 #include <assert.h>
+#include <algorithm>
 #include <iostream>
 #include <vector>
 #include <unordered_map>
@@ -36,12 +37,25 @@ extern sai_object_id_t     gVirtualRouterId;
 extern sai_nat_api_t      *sai_nat_api;
 extern sai_hostif_api_t   *sai_hostif_api;
 extern bool               gIsNatSupported;
+extern size_t             gMaxBulkSize;
 #ifdef DEBUG_FRAMEWORK
 extern DebugDumpOrch      *gDebugDumpOrch;
 #endif
 uint32_t  natTimerTickCntr  = 0;
 bool      gNhTrackingSupported = false;
 
+/*
+ * Next hit bit query of an entry last seen active at 'active'. A set hit bit
+ * only tells the entry was used since its previous query, so the entries
+ * are queried at least every NAT_HITBIT_QUERY_PERIOD while active. An idle
+ * entry is then aged out at most 'timeout + NAT_HITBIT_QUERY_PERIOD' after
+ * its last use, while it is only queried again once its timeout expires.
+ */
+static inline time_t activeHitBitQueryTime(time_t active, int timeout)
+{
+    return active + std::min<time_t>(timeout, NAT_HITBIT_QUERY_PERIOD);
+}
+
 NatOrch::NatOrch(DBConnector *appDb, DBConnector *stateDb, vector<table_name_with_pri_t> &tableNames,
          RouteOrch *routeOrch, NeighOrch *neighOrch):
          Orch(appDb, tableNames),
@@ -57,7 +71,9 @@ NatOrch::NatOrch(DBConnector *appDb, DBConnector *stateDb, vector<table_name_wit
          m_naptQueryTable(appDb, APP_NAPT_TABLE_NAME),
          m_twiceNatQueryTable(appDb, APP_NAT_TWICE_TABLE_NAME),
          m_twiceNaptQueryTable(appDb, APP_NAPT_TWICE_TABLE_NAME),
-         nullIpv4Addr(0)
+         nullIpv4Addr(0),
+         m_natBulker(sai_nat_api, gMaxBulkSize),
+         m_natBulkDepth(0)
 {
     /* Set NAT admin mode to disabled */
     admin_mode = "disabled";
@@ -157,6 +173,8 @@ void NatOrch::update(SubjectType type, void *cntx)
 
     assert(cntx);
 
+    beginHwNatBulk();
+
     switch(type)
     {
         case SUBJECT_TYPE_NEXTHOP_CHANGE:
@@ -175,8 +193,10 @@ void NatOrch::update(SubjectType type, void *cntx)
             /* Received update in which we are not interested
              * Ignore it
              */
-            return;
+            break;
     }
+
+    endHwNatBulk();
 }
 
 bool NatOrch::isNextHopResolved(const NextHopUpdate &update)
@@ -733,13 +753,185 @@ void NatOrch::removeTwiceNaptFromNhCache(const IpAddress &translatedIp, const Tw
     }
 }
 
+/* Queue the NAT entry in the bulker, it is created in the hardware on the next flush */
+template <typename KeyType>
+bool NatOrch::queueHwNatEntry(std::deque<NatBulkContext<KeyType>> &bulkCtx, const KeyType &key,
+                              const sai_nat_entry_t &entry, const sai_attribute_t *attr_list, uint32_t attr_count)
+{
+    bulkCtx.emplace_back(key, entry, attr_list, attr_count);
+
+    auto &ctx = bulkCtx.back();
+    m_natBulker.create_entry(&ctx.status, &ctx.entry, (uint32_t)ctx.attrs.size(), ctx.attrs.data());
+    if (ctx.status == SAI_STATUS_ITEM_ALREADY_EXISTS)
+    {
+        /* Same entry is already queued for creation */
+        bulkCtx.pop_back();
+        return false;
+    }
+
+    return true;
+}
+
+template <typename KeyType>
+static sai_status_t getNatBulkCreateStatus(NatBulkContext<KeyType> &ctx)
+{
+    if ((ctx.status == SAI_STATUS_NOT_IMPLEMENTED) || (ctx.status == SAI_STATUS_NOT_SUPPORTED))
+    {
+        /* Bulk create isn't supported, fall back to the single entry create */
+        ctx.status = sai_nat_api->create_nat_entry(&ctx.entry, (uint32_t)ctx.attrs.size(), ctx.attrs.data());
+    }
+
+    return ctx.status;
+}
+
+/* Create the NAT entry in the hardware right away, outside of a NAT bulk scope */
+template <typename KeyType>
+static NatBulkContext<KeyType> createHwNatEntry(const KeyType &key, const sai_nat_entry_t &entry,
+                                                const sai_attribute_t *attr_list, uint32_t attr_count)
+{
+    NatBulkContext<KeyType> ctx(key, entry, attr_list, attr_count);
+
+    ctx.status = sai_nat_api->create_nat_entry(&ctx.entry, (uint32_t)ctx.attrs.size(), ctx.attrs.data());
+
+    return ctx;
+}
+
+static time_t getNatMonotonicTime(void)
+{
+    struct timespec  time_now;
+
+    if (clock_gettime (CLOCK_MONOTONIC, &time_now) < 0)
+    {
+        return 0;
+    }
+
+    return time_now.tv_sec;
+}
+
+/* The NAT entries added to the hardware within a bulk scope are queued and
+ * created on the flush of the outermost scope. Outside of a scope, they are
+ * created right away so that the result of the creation is returned. */
+void NatOrch::beginHwNatBulk(void)
+{
+    m_natBulkDepth++;
+}
+
+void NatOrch::endHwNatBulk(void)
+{
+    assert(m_natBulkDepth > 0);
+
+    if (--m_natBulkDepth == 0)
+    {
+        flushHwNatEntries();
+    }
+}
+
+/* Create the queued NAT entries in the hardware and update the entry caches
+ * and counters as per the status of each entry */
+void NatOrch::flushHwNatEntries(void)
+{
+    time_t  now;
+
+    SWSS_LOG_ENTER();
+
+    if ((m_natBulker.creating_entries_count() == 0) && (m_natBulker.removing_entries_count() == 0))
+    {
+        return;
+    }
+
+    m_natBulker.flush();
+
+    for (auto &ctx : m_natRemoveBulkCtx)
+    {
+        if ((ctx.status == SAI_STATUS_NOT_IMPLEMENTED) || (ctx.status == SAI_STATUS_NOT_SUPPORTED))
+        {
+            /* Bulk remove isn't supported, fall back to the single entry remove */
+            ctx.status = sai_nat_api->remove_nat_entry(&ctx.entry);
+        }
+        if (ctx.status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_INFO("Failed to remove NAT entry %s, rv:%d", sai_serialize_nat_entry(ctx.entry).c_str(), ctx.status);
+        }
+    }
+
+    now = getNatMonotonicTime();
+
+    for (auto &ctx : m_snatBulkCtx)
+    {
+        addHwSnatEntryPost(ctx, now);
+    }
+    for (auto &ctx : m_dnatBulkCtx)
+    {
+        addHwDnatEntryPost(ctx);
+    }
+    for (auto &ctx : m_snaptBulkCtx)
+    {
+        addHwSnaptEntryPost(ctx, now);
+    }
+    for (auto &ctx : m_dnaptBulkCtx)
+    {
+        addHwDnaptEntryPost(ctx);
+    }
+    for (auto &ctx : m_twiceNatBulkCtx)
+    {
+        addHwTwiceNatEntryPost(ctx, now);
+    }
+    for (auto &ctx : m_twiceNaptBulkCtx)
+    {
+        addHwTwiceNaptEntryPost(ctx, now);
+    }
+
+    SWSS_LOG_INFO("Removed %zu and created %zu SNAT, %zu DNAT, %zu SNAPT, %zu DNAPT, %zu Twice NAT, %zu Twice NAPT entries in bulk",
+                  m_natRemoveBulkCtx.size(), m_snatBulkCtx.size(), m_dnatBulkCtx.size(), m_snaptBulkCtx.size(),
+                  m_dnaptBulkCtx.size(), m_twiceNatBulkCtx.size(), m_twiceNaptBulkCtx.size());
+
+    m_natRemoveBulkCtx.clear();
+    m_snatBulkCtx.clear();
+    m_dnatBulkCtx.clear();
+    m_snaptBulkCtx.clear();
+    m_dnaptBulkCtx.clear();
+    m_twiceNatBulkCtx.clear();
+    m_twiceNaptBulkCtx.clear();
+}
+
+/* Queue the NAT entry removal in the bulker, it is removed from the hardware on the next flush */
+void NatOrch::queueHwNatEntryRemoval(const sai_nat_entry_t &entry)
+{
+    if (m_natBulker.creating_entries_count(entry))
+    {
+        /* Create the entry first, as the removal would cancel the queued creation
+         * after the entry cache and counters are already updated */
+        flushHwNatEntries();
+    }
+
+    if (m_natBulker.bulk_entry_pending_removal(entry))
+    {
+        return;
+    }
+
+    m_natRemoveBulkCtx.emplace_back();
+
+    auto &ctx = m_natRemoveBulkCtx.back();
+    ctx.entry = entry;
+    m_natBulker.remove_entry(&ctx.status, &ctx.entry);
+}
+
+/* Entries queued for creation are marked as added to the hardware only after
+ * the flush. Flush them before the entries are looked up for the removal. */
+void NatOrch::flushHwNatEntriesIfPending(void)
+{
+    if (m_natBulker.creating_entries_count() || m_natBulker.removing_entries_count())
+    {
+        flushHwNatEntries();
+    }
+}
+
 // Add the DNAT entry after nexthop resolution, to the hardware
 bool NatOrch::addHwDnatEntry(const IpAddress &ip_address)
 {
     uint32_t        attr_count;
     sai_nat_entry_t dnat_entry = {};
     sai_attribute_t nat_entry_attr[4] = {};
-    sai_status_t    status;
 
     SWSS_LOG_ENTER();
     SWSS_LOG_INFO("Create DNAT entry for ip %s, as nexthop is resolved", ip_address.to_string().c_str());
@@ -769,7 +961,31 @@ bool NatOrch::addHwDnatEntry(const IpAddress &ip_address)
     dnat_entry.data.key.dst_ip = ip_address.getV4Addr();
     dnat_entry.data.mask.dst_ip = 0xffffffff;
 
-    status = sai_nat_api->create_nat_entry(&dnat_entry, attr_count, nat_entry_attr);
+    if (m_natBulkDepth == 0)
+    {
+        auto ctx = createHwNatEntry(ip_address, dnat_entry, nat_entry_attr, attr_count);
+        return addHwDnatEntryPost(ctx);
+    }
+
+    queueHwNatEntry(m_dnatBulkCtx, ip_address, dnat_entry, nat_entry_attr, attr_count);
+
+    return true;
+}
+
+// Update the DNAT entry cache, once the DNAT entry is created in the hardware
+bool NatOrch::addHwDnatEntryPost(NatBulkContext<IpAddress> &ctx)
+{
+    const IpAddress &ip_address = ctx.key;
+    sai_status_t    status = getNatBulkCreateStatus(ctx);
+
+    if (m_natEntries.find(ip_address) == m_natEntries.end())
+    {
+        SWSS_LOG_ERROR("NAT entry isn't found for ip %s, after adding to the hardware", ip_address.to_string().c_str());
+        return false;
+    }
+
+    NatEntryValue entry = m_natEntries[ip_address];
+
     if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_ERROR("Failed to create %s DNAT NAT entry with ip %s and it's translated ip %s",
@@ -813,7 +1029,6 @@ bool NatOrch::addHwDnaptEntry(const NaptEntryKey &key)
     sai_nat_entry_t dnat_entry = {};
     sai_attribute_t nat_entry_attr[5] = {};
     uint8_t         ip_protocol = ((key.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
-    sai_status_t    status;
 
     SWSS_LOG_ENTER();
     SWSS_LOG_INFO("Create DNAPT entry for proto %s, dest-ip %s, l4-port %d, as nexthop is resolved",
@@ -851,7 +1066,32 @@ bool NatOrch::addHwDnaptEntry(const NaptEntryKey &key)
     dnat_entry.data.key.proto = ip_protocol;
     dnat_entry.data.mask.proto = 0xff;
 
-    status = sai_nat_api->create_nat_entry(&dnat_entry, attr_count, nat_entry_attr);
+    if (m_natBulkDepth == 0)
+    {
+        auto ctx = createHwNatEntry(key, dnat_entry, nat_entry_attr, attr_count);
+        return addHwDnaptEntryPost(ctx);
+    }
+
+    queueHwNatEntry(m_dnaptBulkCtx, key, dnat_entry, nat_entry_attr, attr_count);
+
+    return true;
+}
+
+// Update the DNAPT entry cache, once the DNAPT entry is created in the hardware
+bool NatOrch::addHwDnaptEntryPost(NatBulkContext<NaptEntryKey> &ctx)
+{
+    const NaptEntryKey &key = ctx.key;
+    sai_status_t       status = getNatBulkCreateStatus(ctx);
+
+    if (m_naptEntries.find(key) == m_naptEntries.end())
+    {
+        SWSS_LOG_ERROR("NAPT entry isn't found for Prototype - %s, ip - %s and port - %d, after adding to the hardware",
+                       key.prototype.c_str(), key.ip_address.to_string().c_str(), key.l4_port);
+        return false;
+    }
+
+    NaptEntryValue entry = m_naptEntries[key];
+
     if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_ERROR("Failed to create %s DNAT NAPT entry with ip %s, port %d, prototype %s and it's translated ip %s, translated port %d",
@@ -898,6 +1138,9 @@ bool NatOrch::removeHwDnatEntry(const IpAddress &dstIp)
     SWSS_LOG_ENTER();
     SWSS_LOG_INFO("Deleting DNAT entry ip %s from hardware", dstIp.to_string().c_str());
 
+    /* The entry may still be queued for creation in the bulk */
+    flushHwNatEntriesIfPending();
+
     /* Check the entry is present in cache */
     if (m_natEntries.find(dstIp) == m_natEntries.end())
     {
@@ -983,6 +1226,9 @@ bool NatOrch::removeHwTwiceNatEntry(const TwiceNatEntryKey &key)
     SWSS_LOG_INFO("Deleting Twice NAT entry src ip %s, dst ip %s from the hardware",
                    key.src_ip.to_string().c_str(), key.dst_ip.to_string().c_str());
 
+    /* The entry may still be queued for creation in the bulk */
+    flushHwNatEntriesIfPending();
+
     /* Check the entry is present in cache */
     if (m_twiceNatEntries.find(key) == m_twiceNatEntries.end())
     {
@@ -1079,6 +1325,9 @@ bool NatOrch::removeHwDnaptEntry(const NaptEntryKey &key)
     SWSS_LOG_INFO("Delete DNAPT entry for proto %s, dest-ip %s, l4-port %d",
                    key.prototype.c_str(), key.ip_address.to_string().c_str(), key.l4_port);
 
+    /* The entry may still be queued for creation in the bulk */
+    flushHwNatEntriesIfPending();
+
     /* Check the entry is present in cache */
     if (m_naptEntries.find(key) == m_naptEntries.end())
     {
@@ -1173,6 +1422,9 @@ bool NatOrch::removeHwTwiceNaptEntry(const TwiceNaptEntryKey &key)
                    key.prototype.c_str(), key.src_ip.to_string().c_str(), key.src_l4_port,
                    key.dst_ip.to_string().c_str(), key.dst_l4_port);
 
+    /* The entry may still be queued for creation in the bulk */
+    flushHwNatEntriesIfPending();
+
     /* Check the entry is present in cache */
     if (m_twiceNaptEntries.find(key) == m_twiceNaptEntries.end())
     {
@@ -1272,17 +1524,10 @@ bool NatOrch::addHwSnatEntry(const IpAddress &ip_address)
     uint32_t        attr_count;
     sai_nat_entry_t snat_entry = {};
     sai_attribute_t nat_entry_attr[4] = {};
-    sai_status_t    status;
-    struct timespec  time_now;
 
     SWSS_LOG_ENTER();
     SWSS_LOG_INFO("Create SNAT entry for ip %s", ip_address.to_string().c_str());
 
-    if (clock_gettime (CLOCK_MONOTONIC, &time_now) < 0)
-    {
-        return false;
-    }
-
     NatEntryValue entry = m_natEntries[ip_address];
 
     nat_entry_attr[0].id = SAI_NAT_ENTRY_ATTR_SRC_IP;
@@ -1302,7 +1547,31 @@ bool NatOrch::addHwSnatEntry(const IpAddress &ip_address)
     snat_entry.data.key.src_ip = ip_address.getV4Addr();
     snat_entry.data.mask.src_ip = 0xffffffff;
 
-    status = sai_nat_api->create_nat_entry(&snat_entry, attr_count, nat_entry_attr);
+    if (m_natBulkDepth == 0)
+    {
+        auto ctx = createHwNatEntry(ip_address, snat_entry, nat_entry_attr, attr_count);
+        return addHwSnatEntryPost(ctx, getNatMonotonicTime());
+    }
+
+    queueHwNatEntry(m_snatBulkCtx, ip_address, snat_entry, nat_entry_attr, attr_count);
+
+    return true;
+}
+
+// Update the SNAT entry cache, once the SNAT entry is created in the hardware
+bool NatOrch::addHwSnatEntryPost(NatBulkContext<IpAddress> &ctx, time_t now)
+{
+    const IpAddress &ip_address = ctx.key;
+    sai_status_t    status = getNatBulkCreateStatus(ctx);
+
+    if (m_natEntries.find(ip_address) == m_natEntries.end())
+    {
+        SWSS_LOG_ERROR("NAT entry isn't found for ip %s, after adding to the hardware", ip_address.to_string().c_str());
+        return false;
+    }
+
+    NatEntryValue entry = m_natEntries[ip_address];
+
     if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_ERROR("Failed to create %s SNAT NAT entry with ip %s and it's translated ip %s",
@@ -1320,7 +1589,11 @@ bool NatOrch::addHwSnatEntry(const IpAddress &ip_address)
 
     updateNatCounters(ip_address, 0, 0);
     m_natEntries[ip_address].addedToHw = true;
-    m_natEntries[ip_address].activeTime = time_now.tv_sec;
+    m_natEntries[ip_address].activeTime = now;
+    if (entry.entry_type != "static")
+    {
+        scheduleHitBitQuery(ip_address, m_natEntries[ip_address], activeHitBitQueryTime(now, timeout));
+    }
     gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_SNAT_ENTRY);
 
     if (entry.entry_type == "static")
@@ -1345,17 +1618,9 @@ bool NatOrch::addHwTwiceNatEntry(const TwiceNatEntryKey &key)
     sai_nat_entry_t dbl_nat_entry = {};
     sai_attribute_t nat_entry_attr[6] = {};
 
-    sai_status_t    status;
-    struct timespec  time_now;
-
     SWSS_LOG_ENTER();
     SWSS_LOG_INFO("Create Twice NAT entry for src ip %s, dst ip %s", key.src_ip.to_string().c_str(), key.dst_ip.to_string().c_str());
 
-    if (clock_gettime (CLOCK_MONOTONIC, &time_now) < 0)
-    {
-        return false;
-    }
-
     TwiceNatEntryValue value = m_twiceNatEntries[key];
 
     nat_entry_attr[0].id = SAI_NAT_ENTRY_ATTR_SRC_IP;
@@ -1381,7 +1646,31 @@ bool NatOrch::addHwTwiceNatEntry(const TwiceNatEntryKey &key)
     dbl_nat_entry.data.key.dst_ip = key.dst_ip.getV4Addr();
     dbl_nat_entry.data.mask.dst_ip = 0xffffffff;
 
-    status = sai_nat_api->create_nat_entry(&dbl_nat_entry, attr_count, nat_entry_attr);
+    if (m_natBulkDepth == 0)
+    {
+        auto ctx = createHwNatEntry(key, dbl_nat_entry, nat_entry_attr, attr_count);
+        return addHwTwiceNatEntryPost(ctx, getNatMonotonicTime());
+    }
+
+    queueHwNatEntry(m_twiceNatBulkCtx, key, dbl_nat_entry, nat_entry_attr, attr_count);
+
+    return true;
+}
+
+// Update the Twice NAT entry cache, once the Twice NAT entry is created in the hardware
+bool NatOrch::addHwTwiceNatEntryPost(NatBulkContext<TwiceNatEntryKey> &ctx, time_t now)
+{
+    const TwiceNatEntryKey &key = ctx.key;
+    sai_status_t           status = getNatBulkCreateStatus(ctx);
+
+    if (m_twiceNatEntries.find(key) == m_twiceNatEntries.end())
+    {
+        SWSS_LOG_ERROR("Twice NAT entry isn't found for src ip %s, dst ip %s, after adding to the hardware",
+                       key.src_ip.to_string().c_str(), key.dst_ip.to_string().c_str());
+        return false;
+    }
+
+    TwiceNatEntryValue value = m_twiceNatEntries[key];
 
     if (status != SAI_STATUS_SUCCESS)
     {
@@ -1402,7 +1691,11 @@ bool NatOrch::addHwTwiceNatEntry(const TwiceNatEntryKey &key)
 
     updateTwiceNatCounters(key, 0, 0);
     m_twiceNatEntries[key].addedToHw = true; 
-    m_twiceNatEntries[key].activeTime = time_now.tv_sec;
+    m_twiceNatEntries[key].activeTime = now;
+    if (value.entry_type != "static")
+    {
+        scheduleHitBitQuery(key, m_twiceNatEntries[key], activeHitBitQueryTime(now, timeout));
+    }
 
     totalDnatEntries++;
     updateDnatCounters(totalDnatEntries);
@@ -1433,18 +1726,11 @@ bool NatOrch::addHwSnaptEntry(const NaptEntryKey &keyEntry)
     sai_nat_entry_t snat_entry = {};
     sai_attribute_t nat_entry_attr[5] = {};
     uint8_t         ip_protocol = ((keyEntry.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
-    sai_status_t    status;
-    struct timespec  time_now;
 
     SWSS_LOG_ENTER();
     SWSS_LOG_INFO("Create SNAPT entry for proto %s, src-ip %s, l4-port %d",
                    keyEntry.prototype.c_str(), keyEntry.ip_address.to_string().c_str(), keyEntry.l4_port);
 
-    if (clock_gettime (CLOCK_MONOTONIC, &time_now) < 0)
-    {
-        return false;
-    }
-
     NaptEntryValue entry = m_naptEntries[keyEntry];
 
     nat_entry_attr[0].id = SAI_NAT_ENTRY_ATTR_SRC_IP;
@@ -1470,7 +1756,32 @@ bool NatOrch::addHwSnaptEntry(const NaptEntryKey &keyEntry)
     snat_entry.data.key.proto = ip_protocol;
     snat_entry.data.mask.proto = 0xff;
 
-    status = sai_nat_api->create_nat_entry(&snat_entry, attr_count, nat_entry_attr);
+    if (m_natBulkDepth == 0)
+    {
+        auto ctx = createHwNatEntry(keyEntry, snat_entry, nat_entry_attr, attr_count);
+        return addHwSnaptEntryPost(ctx, getNatMonotonicTime());
+    }
+
+    queueHwNatEntry(m_snaptBulkCtx, keyEntry, snat_entry, nat_entry_attr, attr_count);
+
+    return true;
+}
+
+// Update the SNAPT entry cache, once the SNAPT entry is created in the hardware
+bool NatOrch::addHwSnaptEntryPost(NatBulkContext<NaptEntryKey> &ctx, time_t now)
+{
+    const NaptEntryKey &keyEntry = ctx.key;
+    sai_status_t       status = getNatBulkCreateStatus(ctx);
+
+    if (m_naptEntries.find(keyEntry) == m_naptEntries.end())
+    {
+        SWSS_LOG_ERROR("NAPT entry isn't found for Prototype - %s, ip - %s and port - %d, after adding to the hardware",
+                       keyEntry.prototype.c_str(), keyEntry.ip_address.to_string().c_str(), keyEntry.l4_port);
+        return false;
+    }
+
+    NaptEntryValue entry = m_naptEntries[keyEntry];
+
     if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_ERROR("Failed to create %s SNAT NAPT entry with ip %s, port %d, prototype %s and it's translated ip %s, translated port %d",
@@ -1489,7 +1800,12 @@ bool NatOrch::addHwSnaptEntry(const NaptEntryKey &keyEntry)
                      entry.translated_ip.to_string().c_str(), entry.translated_l4_port);
 
      m_naptEntries[keyEntry].addedToHw = true;
-     m_naptEntries[keyEntry].activeTime = time_now.tv_sec;
+     m_naptEntries[keyEntry].activeTime = now;
+     if (entry.entry_type != "static")
+     {
+         int entryTimeout = ((keyEntry.prototype == "TCP") ? tcp_timeout : udp_timeout);
+         scheduleHitBitQuery(keyEntry, m_naptEntries[keyEntry], activeHitBitQueryTime(now, entryTimeout));
+     }
 
      updateNaptCounters(keyEntry.prototype.c_str(), keyEntry.ip_address, keyEntry.l4_port, 0, 0);
      gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_SNAT_ENTRY);
@@ -1516,19 +1832,12 @@ bool NatOrch::addHwTwiceNaptEntry(const TwiceNaptEntryKey &key)
     sai_nat_entry_t dbl_nat_entry = {};
     sai_attribute_t nat_entry_attr[8] = {};
     uint8_t         protoType = ((key.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
-    sai_status_t    status;
-    struct timespec  time_now;
 
     SWSS_LOG_ENTER();
     SWSS_LOG_INFO("Create Twice SNAPT entry for proto %s, src-ip %s, src port %d, dst-ip %s, dst port %d",
                    key.prototype.c_str(), key.src_ip.to_string().c_str(), key.src_l4_port,
                    key.dst_ip.to_string().c_str(), key.dst_l4_port);
 
-    if (clock_gettime (CLOCK_MONOTONIC, &time_now) < 0)
-    {
-        return false;
-    }
-
     TwiceNaptEntryValue value = m_twiceNaptEntries[key];
 
     nat_entry_attr[0].id = SAI_NAT_ENTRY_ATTR_SRC_IP;
@@ -1564,7 +1873,33 @@ bool NatOrch::addHwTwiceNaptEntry(const TwiceNaptEntryKey &key)
     dbl_nat_entry.data.key.proto = protoType;
     dbl_nat_entry.data.mask.proto = 0xff;
 
-    status = sai_nat_api->create_nat_entry(&dbl_nat_entry, attr_count, nat_entry_attr);
+    if (m_natBulkDepth == 0)
+    {
+        auto ctx = createHwNatEntry(key, dbl_nat_entry, nat_entry_attr, attr_count);
+        return addHwTwiceNaptEntryPost(ctx, getNatMonotonicTime());
+    }
+
+    queueHwNatEntry(m_twiceNaptBulkCtx, key, dbl_nat_entry, nat_entry_attr, attr_count);
+
+    return true;
+}
+
+// Update the Twice NAPT entry cache, once the Twice NAPT entry is created in the hardware
+bool NatOrch::addHwTwiceNaptEntryPost(NatBulkContext<TwiceNaptEntryKey> &ctx, time_t now)
+{
+    const TwiceNaptEntryKey &key = ctx.key;
+    sai_status_t            status = getNatBulkCreateStatus(ctx);
+
+    if (m_twiceNaptEntries.find(key) == m_twiceNaptEntries.end())
+    {
+        SWSS_LOG_ERROR("Twice NAPT entry isn't found for proto %s, src-ip %s, src port %d, dst-ip %s, dst port %d, after adding to the hardware",
+                       key.prototype.c_str(), key.src_ip.to_string().c_str(), key.src_l4_port, key.dst_ip.to_string().c_str(),
+                       key.dst_l4_port);
+        return false;
+    }
+
+    TwiceNaptEntryValue value = m_twiceNaptEntries[key];
+
     if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_ERROR("Failed to create %s Twice NAPT entry with src ip %s, src port %d, dst ip %s dst port %d, prototype %s and \
@@ -1589,7 +1924,12 @@ bool NatOrch::addHwTwiceNaptEntry(const TwiceNaptEntryKey &key)
 
      updateTwiceNaptCounters(key, 0, 0);
      m_twiceNaptEntries[key].addedToHw = true;
-     m_twiceNaptEntries[key].activeTime = time_now.tv_sec;
+     m_twiceNaptEntries[key].activeTime = now;
+     if (value.entry_type != "static")
+     {
+         int entryTimeout = ((key.prototype == "TCP") ? tcp_timeout : udp_timeout);
+         scheduleHitBitQuery(key, m_twiceNaptEntries[key], activeHitBitQueryTime(now, entryTimeout));
+     }
 
      totalDnatEntries++;
      updateDnatCounters(totalDnatEntries);
@@ -1617,7 +1957,6 @@ bool NatOrch::addHwTwiceNaptEntry(const TwiceNaptEntryKey &key)
 bool NatOrch::removeHwSnatEntry(const IpAddress &ip_address)
 {
     sai_nat_entry_t snat_entry = {};
-    sai_status_t    status;
 
     SWSS_LOG_ENTER();
     SWSS_LOG_INFO("Deleting SNAT entry ip %s from hardware", ip_address.to_string().c_str());
@@ -1630,17 +1969,10 @@ bool NatOrch::removeHwSnatEntry(const IpAddress &ip_address)
     snat_entry.data.key.src_ip = ip_address.getV4Addr();
     snat_entry.data.mask.src_ip = 0xffffffff;
 
-    status = sai_nat_api->remove_nat_entry(&snat_entry);
-    if (status != SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_INFO("Failed to removed %s SNAT NAT entry with ip %s and it's translated ip %s",
-                      entry.entry_type.c_str(), ip_address.to_string().c_str(), entry.translated_ip.to_string().c_str());
-    }
-    else
-    {
-        SWSS_LOG_NOTICE("Removed %s SNAT NAT entry with ip %s and it's translated ip %s",
-                        entry.entry_type.c_str(), ip_address.to_string().c_str(), entry.translated_ip.to_string().c_str());
-    }
+    queueHwNatEntryRemoval(snat_entry);
+
+    SWSS_LOG_NOTICE("Removing %s SNAT NAT entry with ip %s and it's translated ip %s",
+                    entry.entry_type.c_str(), ip_address.to_string().c_str(), entry.translated_ip.to_string().c_str());
     deleteNatCounters(ip_address);
     m_natEntries.erase(ip_address);
     gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_SNAT_ENTRY);
@@ -1690,7 +2022,6 @@ bool NatOrch::removeHwSnatEntry(const IpAddress &ip_address)
 bool NatOrch::removeHwSnaptEntry(const NaptEntryKey &keyEntry)
 {
     sai_nat_entry_t snat_entry = {};
-    sai_status_t    status;
     uint8_t         ip_protocol = ((keyEntry.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
 
     SWSS_LOG_ENTER();
@@ -1717,19 +2048,11 @@ bool NatOrch::removeHwSnaptEntry(const NaptEntryKey &keyEntry)
     snat_entry.data.key.proto = ip_protocol;
     snat_entry.data.mask.proto = 0xff;
 
-    status = sai_nat_api->remove_nat_entry(&snat_entry);
-    if (status != SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_INFO("Failed to removed %s SNAT NAPT entry with ip %s, port %d, prototype %s and it's translated ip %s, translated port %d",
-                      entry.entry_type.c_str(), keyEntry.ip_address.to_string().c_str(), keyEntry.l4_port, keyEntry.prototype.c_str(),
-                      entry.translated_ip.to_string().c_str(), entry.translated_l4_port);
-    }
-    else
-    {
-        SWSS_LOG_NOTICE("Removed %s SNAT NAPT entry with ip %s, port %d, prototype %s and it's translated ip %s, translated port %d",
-                      entry.entry_type.c_str(), keyEntry.ip_address.to_string().c_str(), keyEntry.l4_port, keyEntry.prototype.c_str(),
-                      entry.translated_ip.to_string().c_str(), entry.translated_l4_port);
-    }
+    queueHwNatEntryRemoval(snat_entry);
+
+    SWSS_LOG_NOTICE("Removing %s SNAT NAPT entry with ip %s, port %d, prototype %s and it's translated ip %s, translated port %d",
+                    entry.entry_type.c_str(), keyEntry.ip_address.to_string().c_str(), keyEntry.l4_port, keyEntry.prototype.c_str(),
+                    entry.translated_ip.to_string().c_str(), entry.translated_l4_port);
     deleteNaptCounters(keyEntry.prototype.c_str(), keyEntry.ip_address, keyEntry.l4_port);
     m_naptEntries.erase(keyEntry);
     gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_SNAT_ENTRY);
@@ -2362,6 +2685,8 @@ void NatOrch::clearAllDnatEntries(void)
     TwiceNaptEntryKey  twiceNaptKey;
     TwiceNaptEntryValue twiceNaptValue;
 
+    flushHwNatEntriesIfPending();
+
     NatEntry::iterator natIter = m_natEntries.begin();
     while (natIter != m_natEntries.end())
     {
@@ -2910,6 +3235,7 @@ void NatOrch::doNatGlobalTableTask(Consumer& consumer)
         string op = kfvOp(t);
         string mode;
         vector<string> keys = tokenize(key, ':');
+        int oldTimeout = timeout, oldTcpTimeout = tcp_timeout, oldUdpTimeout = udp_timeout;
          
         /* Example : APPL_DB
          * NAT_GLOBAL_TABLE:Values
@@ -2960,6 +3286,12 @@ void NatOrch::doNatGlobalTableTask(Consumer& consumer)
 
         SWSS_LOG_INFO("Global Values - Admin mode - %s, TCP - %d, UDP - %d and Both - %d", admin_mode.c_str(), tcp_timeout, udp_timeout, timeout);
 
+        if ((timeout != oldTimeout) || (tcp_timeout != oldTcpTimeout) || (udp_timeout != oldUdpTimeout))
+        {
+            /* Hit bit queries are scheduled as per the timeouts */
+            rebuildAgingWheel();
+        }
+
         it = consumer.m_toSync.erase(it);
     }
 }
@@ -3037,6 +3369,8 @@ void NatOrch::doTask(Consumer& consumer)
 
     unique_lock<mutex> lock(m_natMutex);
 
+    beginHwNatBulk();
+
     if (table_name == APP_NAT_TABLE_NAME)
     {
         SWSS_LOG_INFO("Received APP_NAT_TABLE_NAME update");
@@ -3070,8 +3404,10 @@ void NatOrch::doTask(Consumer& consumer)
     else
     {
         SWSS_LOG_INFO("Received unknown NAT Table - %s notification", table_name.c_str());
-        return;
     }
+
+    /* Program the NAT entries queued by the table tasks in bulk */
+    endHwNatBulk();
 }
 
 struct timespec getTimeDiff(const struct timespec &begin, const struct timespec &end)
@@ -3178,6 +3514,8 @@ void NatOrch::addAllNatEntries(void)
 {
     SWSS_LOG_ENTER();
 
+    beginHwNatBulk();
+
     NatEntry::iterator natIter = m_natEntries.begin();
     while (natIter != m_natEntries.end())
     {
@@ -3265,6 +3603,7 @@ void NatOrch::addAllNatEntries(void)
         }
         twiceNaptIter++;
     }
+    endHwNatBulk();
 }
 
 void NatOrch::clearCounters(void)
@@ -3300,132 +3639,574 @@ void NatOrch::clearCounters(void)
     }
 }
 
-void NatOrch::queryHitBits(void)
+void NatOrch::scheduleHitBitQuery(const IpAddress &key, NatEntryValue &entry, time_t when)
+{
+    entry.hitBitQueryTime = when;
+    m_agingWheel[when].nat.insert(key);
+}
+
+void NatOrch::scheduleHitBitQuery(const NaptEntryKey &key, NaptEntryValue &entry, time_t when)
+{
+    entry.hitBitQueryTime = when;
+    m_agingWheel[when].napt.insert(key);
+}
+
+void NatOrch::scheduleHitBitQuery(const TwiceNatEntryKey &key, TwiceNatEntryValue &entry, time_t when)
+{
+    entry.hitBitQueryTime = when;
+    m_agingWheel[when].twiceNat.insert(key);
+}
+
+void NatOrch::scheduleHitBitQuery(const TwiceNaptEntryKey &key, TwiceNaptEntryValue &entry, time_t when)
+{
+    entry.hitBitQueryTime = when;
+    m_agingWheel[when].twiceNapt.insert(key);
+}
+
+void NatOrch::rebuildAgingWheel(void)
 {
     SWSS_LOG_ENTER();
 
-    uint32_t         queried_entries = 0;
-    struct timespec  time_now, time_end, time_spent;
+    m_agingWheel.clear();
 
-    if (clock_gettime (CLOCK_MONOTONIC, &time_now) < 0)
+    for (auto &it : m_natEntries)
+    {
+        NatEntryValue &entry = it.second;
+        if ((entry.nat_type == "snat") and (entry.addedToHw == true) and (entry.entry_type != "static"))
+        {
+            scheduleHitBitQuery(it.first, entry, activeHitBitQueryTime(entry.activeTime, timeout));
+        }
+    }
+
+    for (auto &it : m_naptEntries)
+    {
+        NaptEntryValue &entry = it.second;
+        if ((entry.nat_type == "snat") and (entry.addedToHw == true) and (entry.entry_type != "static"))
+        {
+            int entryTimeout = ((it.first.prototype == "TCP") ? tcp_timeout : udp_timeout);
+            scheduleHitBitQuery(it.first, entry, activeHitBitQueryTime(entry.activeTime, entryTimeout));
+        }
+    }
+
+    for (auto &it : m_twiceNatEntries)
+    {
+        TwiceNatEntryValue &entry = it.second;
+        if ((entry.addedToHw == true) and (entry.entry_type != "static"))
+        {
+            scheduleHitBitQuery(it.first, entry, activeHitBitQueryTime(entry.activeTime, timeout));
+        }
+    }
+
+    for (auto &it : m_twiceNaptEntries)
+    {
+        TwiceNaptEntryValue &entry = it.second;
+        if ((entry.addedToHw == true) and (entry.entry_type != "static"))
+        {
+            int entryTimeout = ((it.first.prototype == "TCP") ? tcp_timeout : udp_timeout);
+            scheduleHitBitQuery(it.first, entry, activeHitBitQueryTime(entry.activeTime, entryTimeout));
+        }
+    }
+}
+
+static void initHitBitAttrs(NatHitBitQuery &query)
+{
+    query.attrs[0].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT;  /* Get the Hit bit */
+    query.attrs[0].value.booldata = 0;
+    query.attrs[1].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT_COR; /* clear the hit bit after returning the value */
+    query.attrs[1].value.booldata = 1;
+}
+
+static inline bool isHitBitSet(const NatHitBitQuery &query)
+{
+    return ((query.status == SAI_STATUS_SUCCESS) && query.attrs[0].value.booldata);
+}
+
+/* Query the hit bits of all the entries in one bulk call. The queries are not
+ * moved or resized until the bulker is flushed, as it holds pointers to them. */
+void NatOrch::getHitBits(std::vector<NatHitBitQuery> &queries)
+{
+    if (queries.empty())
     {
         return;
     }
 
-    /* Remove the NAT entries that are aged out.
-     * Query the NAT entries for their activity in the hardware
-     * and update the active timeout. */
-    NatEntry::iterator natIter = m_natEntries.begin();
-    while (natIter != m_natEntries.end())
+    /* Bulker is shared with the entry programming, don't flush the queued entries without their post processing */
+    flushHwNatEntriesIfPending();
+
+    for (auto &query : queries)
+    {
+        initHitBitAttrs(query);
+        m_natBulker.get_entry_attribute(&query.status, &query.entry, 2, query.attrs);
+    }
+    m_natBulker.flush();
+
+    for (auto &query : queries)
+    {
+        if ((query.status == SAI_STATUS_SUCCESS) || (query.status == SAI_STATUS_ITEM_ALREADY_EXISTS))
+        {
+            continue;
+        }
+
+        /* Bulk get is not supported or failed for the entry, fall back to the single entry get */
+        initHitBitAttrs(query);
+        query.status = sai_nat_api->get_nat_entry_attribute(&query.entry, 2, query.attrs);
+    }
+}
+
+void NatOrch::sendAgeOutNotifications(const string &op, const vector<string> &keys)
+{
+    /* The first aged out key is sent as the notification data and
+     * the rest of the batch as the fields of the same notification */
+    for (size_t i = 0; i < keys.size(); i += NAT_AGEOUT_NOTIFICATION_BATCH)
+    {
+        size_t end = min(keys.size(), i + NAT_AGEOUT_NOTIFICATION_BATCH);
+        std::vector<FieldValueTuple> fvVector;
+
+        for (size_t j = i + 1; j < end; j++)
+        {
+            fvVector.emplace_back(keys[j], "");
+        }
+        setTimeoutNotifier->send(op, keys[i], fvVector);
+    }
+}
+
+void NatOrch::queryNatHitBits(const std::set<IpAddress> &keys, time_t now)
+{
+    vector<NatEntry::iterator> entries;
+    vector<NatHitBitQuery>     snatQueries;
+    vector<NatHitBitQuery>     dnatQueries;
+    vector<size_t>             dnatIndex;
+    vector<bool>               active;
+    vector<string>             ageOutKeys;
+
+    if (keys.empty())
+    {
+        return;
+    }
+
+    entries.reserve(keys.size());
+    snatQueries.resize(keys.size());
+
+    for (const auto &key : keys)
+    {
+        sai_nat_entry_t &snat_entry = snatQueries[entries.size()].entry;
+
+        memset(&snat_entry, 0, sizeof(snat_entry));
+        snat_entry.vr_id                 = gVirtualRouterId;
+        snat_entry.switch_id             = gSwitchId;
+        snat_entry.nat_type              = SAI_NAT_TYPE_SOURCE_NAT;
+        snat_entry.data.key.src_ip       = key.getV4Addr();
+        snat_entry.data.mask.src_ip      = 0xffffffff;
+
+        entries.push_back(m_natEntries.find(key));
+    }
+    getHitBits(snatQueries);
+
+    /* If SNAT HitBit is not set, check for the HitBit in the reverse direction */
+    active.resize(entries.size(), false);
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        NatEntryValue &entry = entries[i]->second;
+
+        SWSS_LOG_DEBUG("SNAT HIT BIT for src-ip %s = %d", entries[i]->first.to_string().c_str(),
+                       snatQueries[i].attrs[0].value.booldata);
+
+        if (isHitBitSet(snatQueries[i]))
+        {
+            active[i] = true;
+            continue;
+        }
+        if (snatQueries[i].status != SAI_STATUS_SUCCESS)
+        {
+            continue;
+        }
+
+        auto dnatIter = m_natEntries.find(entry.translated_ip);
+        if ((dnatIter == m_natEntries.end()) || ((dnatIter->second).addedToHw == false))
+        {
+            continue;
+        }
+        dnatIndex.push_back(i);
+    }
+
+    dnatQueries.resize(dnatIndex.size());
+    for (size_t j = 0; j < dnatIndex.size(); j++)
+    {
+        sai_nat_entry_t &dnat_entry = dnatQueries[j].entry;
+
+        memset(&dnat_entry, 0, sizeof(dnat_entry));
+        dnat_entry.vr_id                 = gVirtualRouterId;
+        dnat_entry.switch_id             = gSwitchId;
+        dnat_entry.nat_type              = SAI_NAT_TYPE_DESTINATION_NAT;
+        dnat_entry.data.key.dst_ip       = entries[dnatIndex[j]]->second.translated_ip.getV4Addr();
+        dnat_entry.data.mask.dst_ip      = 0xffffffff;
+    }
+    getHitBits(dnatQueries);
+
+    for (size_t j = 0; j < dnatIndex.size(); j++)
+    {
+        SWSS_LOG_DEBUG("DNAT HIT BIT for dst-ip %s = %d", entries[dnatIndex[j]]->second.translated_ip.to_string().c_str(),
+                       dnatQueries[j].attrs[0].value.booldata);
+        active[dnatIndex[j]] = isHitBitSet(dnatQueries[j]);
+    }
+
+    for (size_t i = 0; i < entries.size(); i++)
     {
-        if (checkIfNatEntryIsActive(natIter, time_now.tv_sec))
+        NatEntryValue &entry = entries[i]->second;
+
+        if (active[i])
         {
             /* Since the entry is active in the hardware, reset the active time */
-            natIter->second.activeTime = time_now.tv_sec;
+            entry.activeTime = now;
+            entry.ageOutTime = now + timeout;
+            scheduleHitBitQuery(entries[i]->first, entry, activeHitBitQueryTime(now, timeout));
+        }
+        else if (now - entry.activeTime >= timeout)
+        {
+            ageOutKeys.push_back(entries[i]->first.to_string());
+
+            /* Keep querying until the entry is removed on the conntrack entry ageout */
+            scheduleHitBitQuery(entries[i]->first, entry, now + NAT_HITBIT_QUERY_PERIOD);
         }
         else
         {
-            if ((natIter->second.nat_type == "snat") and (natIter->second.addedToHw == true) and
-                (natIter->second.entry_type != "static"))
-            {
-                if (time_now.tv_sec - natIter->second.activeTime >= timeout)
-                {
-                    std::vector<FieldValueTuple> fvVector;
-                    std::string key = natIter->first.to_string();
-                    setTimeoutNotifier->send("AGEOUT-SINGLE-NAT", key, fvVector);
-                }
-            } 
+            scheduleHitBitQuery(entries[i]->first, entry, entry.activeTime + timeout);
         }
-        queried_entries++;
-        natIter++;
     }
+    sendAgeOutNotifications("AGEOUT-SINGLE-NAT", ageOutKeys);
+}
 
-    /* Remove the NAPT entries that are aged out.
-     * Query the NAPT entries for their activity in the hardware
-     * and update the active timeout. */
-    NaptEntry::iterator naptIter = m_naptEntries.begin();
-    while (naptIter != m_naptEntries.end())
+void NatOrch::queryNaptHitBits(const std::set<NaptEntryKey> &keys, time_t now)
+{
+    vector<NaptEntry::iterator> entries;
+    vector<NatHitBitQuery>      snatQueries;
+    vector<NatHitBitQuery>      dnatQueries;
+    vector<size_t>              dnatIndex;
+    vector<bool>                active;
+    vector<string>              ageOutKeys;
+
+    if (keys.empty())
+    {
+        return;
+    }
+
+    entries.reserve(keys.size());
+    snatQueries.resize(keys.size());
+
+    for (const auto &key : keys)
+    {
+        sai_nat_entry_t &snat_entry = snatQueries[entries.size()].entry;
+        int             protoType   = ((key.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
+
+        memset(&snat_entry, 0, sizeof(snat_entry));
+        snat_entry.vr_id                 = gVirtualRouterId;
+        snat_entry.switch_id             = gSwitchId;
+        snat_entry.nat_type              = SAI_NAT_TYPE_SOURCE_NAT;
+        snat_entry.data.key.src_ip       = key.ip_address.getV4Addr();
+        snat_entry.data.key.l4_src_port  = (uint16_t)(key.l4_port);
+        snat_entry.data.mask.src_ip      = 0xffffffff;
+        snat_entry.data.mask.l4_src_port = 0xffff;
+        snat_entry.data.key.proto        = (uint8_t)protoType;
+        snat_entry.data.mask.proto       = 0xff;
+
+        entries.push_back(m_naptEntries.find(key));
+    }
+    getHitBits(snatQueries);
+
+    /* If SNAPT HitBit is not set, check for the HitBit in the reverse direction */
+    active.resize(entries.size(), false);
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        const NaptEntryKey &naptKey = entries[i]->first;
+        NaptEntryValue     &entry   = entries[i]->second;
+
+        SWSS_LOG_DEBUG("SNAPT HIT BIT for proto %s, src-ip %s, src-port %d = %d", naptKey.prototype.c_str(),
+                       naptKey.ip_address.to_string().c_str(), naptKey.l4_port, snatQueries[i].attrs[0].value.booldata);
+
+        if (isHitBitSet(snatQueries[i]))
+        {
+            active[i] = true;
+            continue;
+        }
+        if (snatQueries[i].status != SAI_STATUS_SUCCESS)
+        {
+            continue;
+        }
+
+        NaptEntryKey dnaptKey;
+        dnaptKey.ip_address = entry.translated_ip;
+        dnaptKey.l4_port    = entry.translated_l4_port;
+        dnaptKey.prototype  = naptKey.prototype;
+
+        auto dnaptIter = m_naptEntries.find(dnaptKey);
+        if ((dnaptIter == m_naptEntries.end()) || ((dnaptIter->second).addedToHw == false))
+        {
+            continue;
+        }
+        dnatIndex.push_back(i);
+    }
+
+    dnatQueries.resize(dnatIndex.size());
+    for (size_t j = 0; j < dnatIndex.size(); j++)
+    {
+        const NaptEntryKey   &naptKey    = entries[dnatIndex[j]]->first;
+        const NaptEntryValue &entry      = entries[dnatIndex[j]]->second;
+        sai_nat_entry_t      &dnat_entry = dnatQueries[j].entry;
+        int                  protoType   = ((naptKey.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
+
+        memset(&dnat_entry, 0, sizeof(dnat_entry));
+        dnat_entry.vr_id                 = gVirtualRouterId;
+        dnat_entry.switch_id             = gSwitchId;
+        dnat_entry.nat_type              = SAI_NAT_TYPE_DESTINATION_NAT;
+        dnat_entry.data.key.dst_ip       = entry.translated_ip.getV4Addr();
+        dnat_entry.data.key.l4_dst_port  = (uint16_t)(entry.translated_l4_port);
+        dnat_entry.data.mask.dst_ip      = 0xffffffff;
+        dnat_entry.data.mask.l4_dst_port = 0xffff;
+        dnat_entry.data.key.proto        = (uint8_t)protoType;
+        dnat_entry.data.mask.proto       = 0xff;
+    }
+    getHitBits(dnatQueries);
+
+    for (size_t j = 0; j < dnatIndex.size(); j++)
+    {
+        const NaptEntryValue &entry = entries[dnatIndex[j]]->second;
+
+        SWSS_LOG_DEBUG("DNAPT HIT BIT for proto %s, dst-ip %s, dst-port %d = %d", entries[dnatIndex[j]]->first.prototype.c_str(),
+                       entry.translated_ip.to_string().c_str(), entry.translated_l4_port, dnatQueries[j].attrs[0].value.booldata);
+        active[dnatIndex[j]] = isHitBitSet(dnatQueries[j]);
+    }
+
+    for (size_t i = 0; i < entries.size(); i++)
     {
-        if (checkIfNaptEntryIsActive(naptIter, time_now.tv_sec))
+        const NaptEntryKey &naptKey      = entries[i]->first;
+        NaptEntryValue     &entry        = entries[i]->second;
+        int                entryTimeout  = ((naptKey.prototype == "TCP") ? tcp_timeout : udp_timeout);
+
+        if (active[i])
         {
             /* Since the entry is active in the hardware, reset the active time */
-            naptIter->second.activeTime = time_now.tv_sec;
+            entry.activeTime = now;
+            entry.ageOutTime = now + entryTimeout;
+            scheduleHitBitQuery(naptKey, entry, activeHitBitQueryTime(now, entryTimeout));
+        }
+        else if (now - entry.activeTime >= entryTimeout)
+        {
+            ageOutKeys.push_back(naptKey.prototype + ":" + naptKey.ip_address.to_string() + ":" + to_string(naptKey.l4_port));
+
+            /* Keep querying until the entry is removed on the conntrack entry ageout */
+            scheduleHitBitQuery(naptKey, entry, now + NAT_HITBIT_QUERY_PERIOD);
         }
         else
         {
-            if ((naptIter->second.nat_type == "snat") and (naptIter->second.addedToHw == true) and
-                (naptIter->second.entry_type != "static"))
-            {
-                int timeout = naptIter->first.prototype == string("TCP") ? tcp_timeout : udp_timeout;
-                if (time_now.tv_sec - naptIter->second.activeTime >= timeout)
-                {
-                    std::vector<FieldValueTuple> fvVector;
-                    std::string key = (naptIter->first.prototype + ":" + naptIter->first.ip_address.to_string() + ":" + to_string(naptIter->first.l4_port));
-                    setTimeoutNotifier->send("AGEOUT-SINGLE-NAPT", key, fvVector);
-                }
-            }
+            scheduleHitBitQuery(naptKey, entry, entry.activeTime + entryTimeout);
         }
-        queried_entries++;
-        naptIter++;
     }
+    sendAgeOutNotifications("AGEOUT-SINGLE-NAPT", ageOutKeys);
+}
 
-    /* Remove the Twice NAT entries that are aged out.
-     * Query the Twice NAT entries for their activity in the hardware
-     * and update the active timeout. */
-    TwiceNatEntry::iterator twiceNatIter = m_twiceNatEntries.begin();
-    while (twiceNatIter != m_twiceNatEntries.end())
+void NatOrch::queryTwiceNatHitBits(const std::set<TwiceNatEntryKey> &keys, time_t now)
+{
+    vector<TwiceNatEntry::iterator> entries;
+    vector<NatHitBitQuery>          queries;
+    vector<string>                  ageOutKeys;
+
+    if (keys.empty())
+    {
+        return;
+    }
+
+    entries.reserve(keys.size());
+    queries.resize(keys.size());
+
+    for (const auto &key : keys)
     {
-        if (checkIfTwiceNatEntryIsActive(twiceNatIter, time_now.tv_sec))
+        sai_nat_entry_t &dbl_nat_entry = queries[entries.size()].entry;
+
+        memset(&dbl_nat_entry, 0, sizeof(dbl_nat_entry));
+        dbl_nat_entry.vr_id = gVirtualRouterId;
+        dbl_nat_entry.switch_id = gSwitchId;
+        dbl_nat_entry.nat_type = SAI_NAT_TYPE_DOUBLE_NAT;
+        dbl_nat_entry.data.key.src_ip = key.src_ip.getV4Addr();
+        dbl_nat_entry.data.mask.src_ip = 0xffffffff;
+        dbl_nat_entry.data.key.dst_ip = key.dst_ip.getV4Addr();
+        dbl_nat_entry.data.mask.dst_ip = 0xffffffff;
+
+        entries.push_back(m_twiceNatEntries.find(key));
+    }
+    getHitBits(queries);
+
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        const TwiceNatEntryKey &key   = entries[i]->first;
+        TwiceNatEntryValue     &entry = entries[i]->second;
+
+        SWSS_LOG_DEBUG("Twice NAT HIT BIT for src-ip %s, dst-ip %s = %d",
+                       key.src_ip.to_string().c_str(), key.dst_ip.to_string().c_str(), queries[i].attrs[0].value.booldata);
+
+        if (isHitBitSet(queries[i]))
         {
             /* Since the entry is active in the hardware, reset the active time */
-            twiceNatIter->second.activeTime = time_now.tv_sec;
+            entry.activeTime = now;
+            entry.ageOutTime = now + timeout;
+            scheduleHitBitQuery(key, entry, activeHitBitQueryTime(now, timeout));
+        }
+        else if (now - entry.activeTime >= timeout)
+        {
+            ageOutKeys.push_back(key.src_ip.to_string() + ":" + key.dst_ip.to_string());
+
+            /* Keep querying until the entry is removed on the conntrack entry ageout */
+            scheduleHitBitQuery(key, entry, now + NAT_HITBIT_QUERY_PERIOD);
         }
         else
         {
-            if ((twiceNatIter->second.addedToHw == true) and
-                (twiceNatIter->second.entry_type != "static"))
-            {
-                if (time_now.tv_sec - twiceNatIter->second.activeTime >= timeout)
-                {
-                    std::vector<FieldValueTuple> fvVector;
-                    std::string key = (twiceNatIter->first.src_ip.to_string() + ":" + twiceNatIter->first.dst_ip.to_string());
-                    setTimeoutNotifier->send("AGEOUT-TWICE-NAT", key, fvVector);
-                }
-            }
+            scheduleHitBitQuery(key, entry, entry.activeTime + timeout);
         }
-        queried_entries++;
-        twiceNatIter++;
     }
+    sendAgeOutNotifications("AGEOUT-TWICE-NAT", ageOutKeys);
+}
 
-    /* Remove the Twice NAPT entries that are aged out.
-     * Query the Twice NAPT entries for their activity in the hardware
-     * and update the active timeout. */
-    TwiceNaptEntry::iterator twiceNaptIter = m_twiceNaptEntries.begin();
-    while (twiceNaptIter != m_twiceNaptEntries.end())
+void NatOrch::queryTwiceNaptHitBits(const std::set<TwiceNaptEntryKey> &keys, time_t now)
+{
+    vector<TwiceNaptEntry::iterator> entries;
+    vector<NatHitBitQuery>           queries;
+    vector<string>                   ageOutKeys;
+
+    if (keys.empty())
     {
-        if (checkIfTwiceNaptEntryIsActive(twiceNaptIter, time_now.tv_sec))
+        return;
+    }
+
+    entries.reserve(keys.size());
+    queries.resize(keys.size());
+
+    for (const auto &key : keys)
+    {
+        sai_nat_entry_t &dbl_nat_entry = queries[entries.size()].entry;
+        uint8_t         protoType      = ((key.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
+
+        memset(&dbl_nat_entry, 0, sizeof(dbl_nat_entry));
+        dbl_nat_entry.vr_id = gVirtualRouterId;
+        dbl_nat_entry.switch_id = gSwitchId;
+        dbl_nat_entry.nat_type = SAI_NAT_TYPE_DOUBLE_NAT;
+        dbl_nat_entry.data.key.src_ip = key.src_ip.getV4Addr();
+        dbl_nat_entry.data.mask.src_ip = 0xffffffff;
+        dbl_nat_entry.data.key.l4_src_port = (uint16_t)(key.src_l4_port);
+        dbl_nat_entry.data.mask.l4_src_port = 0xffff;
+        dbl_nat_entry.data.key.dst_ip = key.dst_ip.getV4Addr();
+        dbl_nat_entry.data.mask.dst_ip = 0xffffffff;
+        dbl_nat_entry.data.key.l4_dst_port = (uint16_t)(key.dst_l4_port);
+        dbl_nat_entry.data.mask.l4_dst_port = 0xffff;
+        dbl_nat_entry.data.key.proto = protoType;
+        dbl_nat_entry.data.mask.proto = 0xff;
+
+        entries.push_back(m_twiceNaptEntries.find(key));
+    }
+    getHitBits(queries);
+
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        const TwiceNaptEntryKey &key          = entries[i]->first;
+        TwiceNaptEntryValue     &entry        = entries[i]->second;
+        int                     entryTimeout  = ((key.prototype == "TCP") ? tcp_timeout : udp_timeout);
+
+        SWSS_LOG_DEBUG("Twice NAPT HIT BIT for [proto %s, src ip %s, src port %d, dst ip %s, dst port %d] = %d",
+                       key.prototype.c_str(), key.src_ip.to_string().c_str(), key.src_l4_port, key.dst_ip.to_string().c_str(), key.dst_l4_port,
+                       queries[i].attrs[0].value.booldata);
+
+        if (isHitBitSet(queries[i]))
         {
             /* Since the entry is active in the hardware, reset the active time */
-            twiceNaptIter->second.activeTime = time_now.tv_sec;
+            entry.activeTime = now;
+            entry.ageOutTime = now + entryTimeout;
+            scheduleHitBitQuery(key, entry, activeHitBitQueryTime(now, entryTimeout));
+        }
+        else if (now - entry.activeTime >= entryTimeout)
+        {
+            ageOutKeys.push_back(key.prototype + ":" + key.src_ip.to_string() + ":" + to_string(key.src_l4_port) +
+                                 ":" + key.dst_ip.to_string() + ":" + to_string(key.dst_l4_port));
+
+            /* Keep querying until the entry is removed on the conntrack entry ageout */
+            scheduleHitBitQuery(key, entry, now + NAT_HITBIT_QUERY_PERIOD);
         }
         else
         {
-            if ((twiceNaptIter->second.addedToHw == true) and
-                (twiceNaptIter->second.entry_type != "static"))
+            scheduleHitBitQuery(key, entry, entry.activeTime + entryTimeout);
+        }
+    }
+    sendAgeOutNotifications("AGEOUT-TWICE-NAPT", ageOutKeys);
+}
+
+void NatOrch::queryHitBits(void)
+{
+    SWSS_LOG_ENTER();
+
+    uint32_t         queried_entries = 0;
+    struct timespec  time_now, time_end, time_spent;
+    NatAgingBucket   due;
+
+    if (clock_gettime (CLOCK_MONOTONIC, &time_now) < 0)
+    {
+        return;
+    }
+
+    /* Collect the dynamic entries that are due for the hit bit query.
+     * Skip the keys of the entries that are removed, no longer in the
+     * hardware or rescheduled to a different time. */
+    while (!m_agingWheel.empty() && (m_agingWheel.begin()->first <= time_now.tv_sec))
+    {
+        auto          bucket    = m_agingWheel.begin();
+        time_t        queryTime = bucket->first;
+
+        for (const auto &key : bucket->second.nat)
+        {
+            auto iter = m_natEntries.find(key);
+            if ((iter != m_natEntries.end()) and (iter->second.nat_type == "snat") and
+                (iter->second.addedToHw == true) and (iter->second.entry_type != "static") and
+                (iter->second.hitBitQueryTime == queryTime))
             {
-                int timeout = twiceNaptIter->first.prototype == string("TCP") ? tcp_timeout : udp_timeout;
-                if (time_now.tv_sec - twiceNaptIter->second.activeTime >= timeout)
-                {
-                    std::vector<FieldValueTuple> fvVector;
-                    std::string key = (twiceNaptIter->first.prototype + ":" + twiceNaptIter->first.src_ip.to_string() + ":" + to_string(twiceNaptIter->first.src_l4_port) + 
-                                       ":" + twiceNaptIter->first.dst_ip.to_string() + ":" + to_string(twiceNaptIter->first.dst_l4_port));
-                    setTimeoutNotifier->send("AGEOUT-TWICE-NAPT", key, fvVector);
-                }
+                due.nat.insert(key);
             }
         }
-        queried_entries++;
-        twiceNaptIter++;
+        for (const auto &key : bucket->second.napt)
+        {
+            auto iter = m_naptEntries.find(key);
+            if ((iter != m_naptEntries.end()) and (iter->second.nat_type == "snat") and
+                (iter->second.addedToHw == true) and (iter->second.entry_type != "static") and
+                (iter->second.hitBitQueryTime == queryTime))
+            {
+                due.napt.insert(key);
+            }
+        }
+        for (const auto &key : bucket->second.twiceNat)
+        {
+            auto iter = m_twiceNatEntries.find(key);
+            if ((iter != m_twiceNatEntries.end()) and (iter->second.addedToHw == true) and
+                (iter->second.entry_type != "static") and (iter->second.hitBitQueryTime == queryTime))
+            {
+                due.twiceNat.insert(key);
+            }
+        }
+        for (const auto &key : bucket->second.twiceNapt)
+        {
+            auto iter = m_twiceNaptEntries.find(key);
+            if ((iter != m_twiceNaptEntries.end()) and (iter->second.addedToHw == true) and
+                (iter->second.entry_type != "static") and (iter->second.hitBitQueryTime == queryTime))
+            {
+                due.twiceNapt.insert(key);
+            }
+        }
+        m_agingWheel.erase(bucket);
     }
+
+    queried_entries = (uint32_t)(due.nat.size() + due.napt.size() + due.twiceNat.size() + due.twiceNapt.size());
+
+    /* Query the due entries for their activity in the hardware, update the
+     * active timeout and notify the entries that are aged out. */
+    queryNatHitBits(due.nat, time_now.tv_sec);
+    queryNaptHitBits(due.napt, time_now.tv_sec);
+    queryTwiceNatHitBits(due.twiceNat, time_now.tv_sec);
+    queryTwiceNaptHitBits(due.twiceNapt, time_now.tv_sec);
+
     if (clock_gettime (CLOCK_MONOTONIC, &time_end) < 0)
     {
         return;
@@ -4133,319 +4914,6 @@ void NatOrch::updateTwiceNaptCounters(const TwiceNaptEntryKey &key,
     m_countersTwiceNaptTable.set(naptKey, values);
 }
 
-bool NatOrch::checkIfNatEntryIsActive(const NatEntry::iterator &iter, time_t now)
-{
-    const IpAddress   &ipAddr = iter->first;
-    NatEntryValue     &entry  = iter->second;
-    uint32_t          attr_count;
-    IpAddress         srcIp;
-    sai_attribute_t   nat_entry_attr[4] = {};
-    sai_nat_entry_t   snat_entry = {};
-    sai_nat_entry_t   dnat_entry;
-    sai_status_t      status;
-
-    if (entry.nat_type == "dnat")
-    {
-        /* Hitbits are queried for both directions when SNAT entry is checked */
-        return 0;
-    }
-
-    if (entry.addedToHw == false)
-    {
-        SWSS_LOG_DEBUG("Skip get hitbits for %s NAT entry [ip %s], as not yet added to HW", entry.nat_type.c_str(), ipAddr.to_string().c_str());
-        return 0;
-    }
-
-    if (entry.entry_type == "static")
-    {
-        /* Static NAT entries are always treated active */ 
-        return 1;
-    }
-
-    nat_entry_attr[0].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT;  /* Get the Hit bit */
-    nat_entry_attr[0].value.booldata = 0;
-    nat_entry_attr[1].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT_COR; /* clear the hit bit after returning the value */
-    nat_entry_attr[1].value.booldata = 1;
-
-    attr_count = 2;
-
-    snat_entry.vr_id                 = gVirtualRouterId;
-    snat_entry.switch_id             = gSwitchId;
-    snat_entry.nat_type              = SAI_NAT_TYPE_SOURCE_NAT;
-    srcIp     = ipAddr;
-    snat_entry.data.key.src_ip   = srcIp.getV4Addr();
-    snat_entry.data.mask.src_ip  = 0xffffffff;
-
-    status = sai_nat_api->get_nat_entry_attribute(&snat_entry, attr_count, nat_entry_attr);
-    if (status == SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_DEBUG("SNAT HIT BIT for src-ip %s = %d", srcIp.to_string().c_str(),
-                      nat_entry_attr[0].value.booldata);
-
-        if (nat_entry_attr[0].value.booldata)
-        {
-            entry.ageOutTime = now + timeout;
-            return 1;
-        }
-        else
-        {
-            auto dnatIter = m_natEntries.find(entry.translated_ip);
-            if (dnatIter == m_natEntries.end())
-            {
-                return 0;
-            }
-            if ((dnatIter->second).addedToHw == false)
-            {
-                return 0;
-            }
-
-            /* If SNAT HitBit is not set, check for the HitBit in the reverse direction */
-            memset(&dnat_entry, 0, sizeof(dnat_entry));
-
-            dnat_entry.vr_id             = gVirtualRouterId;
-            dnat_entry.switch_id         = gSwitchId;
-            dnat_entry.nat_type          = SAI_NAT_TYPE_DESTINATION_NAT;
-            dnat_entry.data.key.dst_ip   = entry.translated_ip.getV4Addr();
-            dnat_entry.data.mask.dst_ip  = 0xffffffff;
-
-            status = sai_nat_api->get_nat_entry_attribute(&dnat_entry, attr_count, nat_entry_attr);
-            if (status == SAI_STATUS_SUCCESS)
-            {
-                SWSS_LOG_DEBUG("DNAT HIT BIT for dst-ip %s = %d", entry.translated_ip.to_string().c_str(),
-                                nat_entry_attr[0].value.booldata);
-                if (nat_entry_attr[0].value.booldata)
-                {
-                    entry.ageOutTime = now + timeout;
-                    return 1;
-                }
-            }
-        }
-    }
-    return 0;
-}
-
-bool NatOrch::checkIfNaptEntryIsActive(const NaptEntry::iterator &iter, time_t now)
-{
-    const NaptEntryKey &naptKey    = iter->first;
-    NaptEntryValue     &entry      = iter->second;
-    int                protoType   = ((naptKey.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
-    uint32_t           attr_count;
-    IpAddress          srcIp;
-    uint16_t           srcPort;
-    sai_attribute_t    nat_entry_attr[4] = {};
-    sai_nat_entry_t    snat_entry = {};
-    sai_nat_entry_t    dnat_entry;
-    sai_status_t       status;
-
-    if (entry.nat_type == "dnat")
-    {
-        /* Hitbits are queried for both directions when SNAT entry is checked */
-        return 0;
-    }
-
-    if (entry.addedToHw == false)
-    {
-        SWSS_LOG_DEBUG("Skip get hitbits for %s NAPT entry for [proto %s, ip %s, port %d], as not yet added to HW",
-                       entry.nat_type.c_str(), naptKey.prototype.c_str(), naptKey.ip_address.to_string().c_str(), naptKey.l4_port);
-        return 0;
-    }
-
-    if (entry.entry_type == "static")
-    {
-        /* Static NAPT entries are always treated active */
-        return 1;
-    }
-
-    nat_entry_attr[0].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT;  /* Get the Hit bit */
-    nat_entry_attr[0].value.booldata = 0;
-    nat_entry_attr[1].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT_COR; /* clear the hit bit after returning the value */
-    nat_entry_attr[1].value.booldata = 1;
-
-    attr_count = 2;
-
-    snat_entry.vr_id                 = gVirtualRouterId;
-    snat_entry.switch_id             = gSwitchId;
-    snat_entry.nat_type              = SAI_NAT_TYPE_SOURCE_NAT;
-
-    srcIp     = naptKey.ip_address;
-    srcPort   = (uint16_t)(naptKey.l4_port);
-    snat_entry.data.key.src_ip       = srcIp.getV4Addr();
-    snat_entry.data.key.l4_src_port  = srcPort;
-
-    snat_entry.data.mask.src_ip      = 0xffffffff;
-    snat_entry.data.mask.l4_src_port = 0xffff;
-    snat_entry.data.key.proto        = (uint8_t)protoType;
-    snat_entry.data.mask.proto       = 0xff;
-
-    status = sai_nat_api->get_nat_entry_attribute(&snat_entry, attr_count, nat_entry_attr);
-    if (status == SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_DEBUG("SNAPT HIT BIT for proto %s, src-ip %s, src-port %d = %d", naptKey.prototype.c_str(),
-                      srcIp.to_string().c_str(), srcPort, nat_entry_attr[0].value.booldata);
-        if (nat_entry_attr[0].value.booldata)
-        {
-            entry.ageOutTime = now + ((protoType == IPPROTO_TCP) ? tcp_timeout : udp_timeout);
-            return 1;
-        }
-        else
-        {
-            NaptEntryKey dnaptKey;
-            dnaptKey.ip_address = entry.translated_ip;
-            dnaptKey.l4_port    = entry.translated_l4_port;
-            dnaptKey.prototype  = naptKey.prototype;
-
-            auto dnaptIter = m_naptEntries.find(dnaptKey);
-            if (dnaptIter == m_naptEntries.end())
-            {
-                return 0;
-            }
-            if ((dnaptIter->second).addedToHw == false)
-            {
-                return 0;
-            }
-
-
-            /* If SNAPT HitBit is not set, check for the HitBit in the reverse direction */
-            memset(&dnat_entry, 0, sizeof(dnat_entry));
-
-            dnat_entry.vr_id                 = gVirtualRouterId;
-            dnat_entry.switch_id             = gSwitchId;
-            dnat_entry.nat_type              = SAI_NAT_TYPE_DESTINATION_NAT;
-
-            dnat_entry.data.key.dst_ip       = entry.translated_ip.getV4Addr();
-            dnat_entry.data.key.l4_dst_port  = (uint16_t)(entry.translated_l4_port);
-
-            dnat_entry.data.mask.dst_ip      = 0xffffffff;
-            dnat_entry.data.mask.l4_dst_port = 0xffff;
-            dnat_entry.data.key.proto        = (uint8_t)protoType;
-            dnat_entry.data.mask.proto       = 0xff;
-
-            status = sai_nat_api->get_nat_entry_attribute(&dnat_entry, attr_count, nat_entry_attr);
-            if (status == SAI_STATUS_SUCCESS)
-            {
-                SWSS_LOG_DEBUG("DNAPT HIT BIT for proto %s, dst-ip %s, dst-port %d = %d", naptKey.prototype.c_str(),
-                              entry.translated_ip.to_string().c_str(), entry.translated_l4_port, nat_entry_attr[0].value.booldata);
-                if (nat_entry_attr[0].value.booldata)
-                {
-                    entry.ageOutTime = now + ((protoType == IPPROTO_TCP) ? tcp_timeout : udp_timeout);
-                    return 1;
-                }
-            }
-        }
-    }
-    return 0;
-}
-
-bool NatOrch::checkIfTwiceNatEntryIsActive(const TwiceNatEntry::iterator &iter, time_t now)
-{
-    const TwiceNatEntryKey &key    = iter->first;
-    TwiceNatEntryValue     &entry  = iter->second;
-    uint32_t           attr_count;
-    sai_attribute_t    nat_entry_attr[4] = {};
-    sai_nat_entry_t    dbl_nat_entry = {};
-    sai_status_t       status;
-
-    if (entry.entry_type == "static")
-    {
-        /* Static NAPT entries are always treated active */
-        return 1;
-    }
-
-    if (entry.addedToHw == false)
-    {
-        SWSS_LOG_DEBUG("Skip get hitbits for Twice NAPT entry for [src ip %s, dst-ip %s], as not yet added to HW",
-                       key.src_ip.to_string().c_str(), key.dst_ip.to_string().c_str());
-        return 0;
-    }
-
-    nat_entry_attr[0].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT;  /* Get the Hit bit */
-    nat_entry_attr[0].value.booldata = 0;
-    nat_entry_attr[1].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT_COR; /* clear the hit bit after returning the value */
-    nat_entry_attr[1].value.booldata = 1;
-
-    attr_count = 2;
-
-    dbl_nat_entry.vr_id = gVirtualRouterId;
-    dbl_nat_entry.switch_id = gSwitchId;
-    dbl_nat_entry.nat_type = SAI_NAT_TYPE_DOUBLE_NAT;
-    dbl_nat_entry.data.key.src_ip = key.src_ip.getV4Addr();
-    dbl_nat_entry.data.mask.src_ip = 0xffffffff;
-    dbl_nat_entry.data.key.dst_ip = key.dst_ip.getV4Addr();
-    dbl_nat_entry.data.mask.dst_ip = 0xffffffff;
-
-    status = sai_nat_api->get_nat_entry_attribute(&dbl_nat_entry, attr_count, nat_entry_attr);
-    if (status == SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_DEBUG("Twice NAT HIT BIT for src-ip %s, dst-ip %s = %d",
-                       key.src_ip.to_string().c_str(), key.dst_ip.to_string().c_str(), nat_entry_attr[0].value.booldata);
-        if (nat_entry_attr[0].value.booldata)
-        {
-            entry.ageOutTime = now + timeout;
-            return 1;
-        }
-    }
-    return 0;
-}
-
-bool NatOrch::checkIfTwiceNaptEntryIsActive(const TwiceNaptEntry::iterator &iter, time_t now)
-{
-    const TwiceNaptEntryKey &key   = iter->first;
-    TwiceNaptEntryValue     &entry = iter->second;
-    uint8_t            protoType   = ((key.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
-    uint32_t           attr_count;
-    sai_attribute_t    nat_entry_attr[4] = {};
-    sai_nat_entry_t    dbl_nat_entry = {};
-    sai_status_t       status;
-
-    if (entry.addedToHw == false)
-    {
-        SWSS_LOG_DEBUG("Skip get hitbits for Twice NAPT entry for [proto %s, src ip %s, src port %d, dst ip %s, dst port %d], as not yet added to HW",
-                        key.prototype.c_str(), key.src_ip.to_string().c_str(), key.src_l4_port, key.dst_ip.to_string().c_str(), key.dst_l4_port);
-        return 0;
-    }
-
-    if (entry.entry_type == "static")
-    {
-        /* Static NAPT entries are always treated active */
-        return 1;
-    }
-
-    nat_entry_attr[0].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT;  /* Get the Hit bit */
-    nat_entry_attr[0].value.booldata = 0;
-    nat_entry_attr[1].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT_COR; /* clear the hit bit after returning the value */
-    nat_entry_attr[1].value.booldata = 1;
-
-    attr_count = 2;
-
-    dbl_nat_entry.vr_id = gVirtualRouterId;
-    dbl_nat_entry.switch_id = gSwitchId;
-    dbl_nat_entry.nat_type = SAI_NAT_TYPE_DOUBLE_NAT;
-    dbl_nat_entry.data.key.src_ip = key.src_ip.getV4Addr();
-    dbl_nat_entry.data.mask.src_ip = 0xffffffff;
-    dbl_nat_entry.data.key.l4_src_port = (uint16_t)(key.src_l4_port);
-    dbl_nat_entry.data.mask.l4_src_port = 0xffff;
-    dbl_nat_entry.data.key.dst_ip = key.dst_ip.getV4Addr();
-    dbl_nat_entry.data.mask.dst_ip = 0xffffffff;
-    dbl_nat_entry.data.key.l4_dst_port = (uint16_t)(key.dst_l4_port);
-    dbl_nat_entry.data.mask.l4_dst_port = 0xffff;
-    dbl_nat_entry.data.key.proto = protoType;
-    dbl_nat_entry.data.mask.proto = 0xff;
-
-    status = sai_nat_api->get_nat_entry_attribute(&dbl_nat_entry, attr_count, nat_entry_attr);
-    if (status == SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_DEBUG("Twice NAPT HIT BIT for [proto %s, src ip %s, src port %d, dst ip %s, dst port %d] = %d",
-                        key.prototype.c_str(), key.src_ip.to_string().c_str(), key.src_l4_port, key.dst_ip.to_string().c_str(), key.dst_l4_port,
-                        nat_entry_attr[0].value.booldata);
-        if (nat_entry_attr[0].value.booldata)
-        {
-            entry.ageOutTime = now + ((protoType == IPPROTO_TCP) ? tcp_timeout : udp_timeout);
-            return 1;
-        }
-    }
-    return 0;
-}
-
 void NatOrch::doTask(NotificationConsumer& consumer)
 {
     SWSS_LOG_ENTER();
@@ -4473,7 +4941,9 @@ void NatOrch::doTask(NotificationConsumer& consumer)
     else if (&consumer == m_cleanupNotificationConsumer)
     {
         SWSS_LOG_NOTICE("Received RedisDB and ASIC  cleanup notification on NAT docker stop");
+        beginHwNatBulk();
         cleanupAppDbEntries();
+        endHwNatBulk();
     }
 }
 
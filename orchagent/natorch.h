@@ -17,6 +17,8 @@
 #ifndef SWSS_NATORCH_H
 #define SWSS_NATORCH_H
 
+#include <deque>
+
 #include "orch.h"
 #include "observer.h"
 #include "portsorch.h"
@@ -29,6 +31,7 @@
 #include "routeorch.h"
 #include "nexthopgroupkey.h"
 #include "notificationproducer.h"
+#include "bulker.h"
 #ifdef DEBUG_FRAMEWORK
 #include "debugdumporch.h"
 #endif
@@ -37,6 +40,8 @@
 #define NAT_HITBIT_N_CNTRS_QUERY_PERIOD   5        // 5 secs
 #define NAT_CONNTRACK_TIMEOUT_PERIOD      86400    // 1 day
 #define NAT_HITBIT_QUERY_MULTIPLE         6        // Hit bits are queried every 30 secs
+#define NAT_HITBIT_QUERY_PERIOD           (NAT_HITBIT_N_CNTRS_QUERY_PERIOD * NAT_HITBIT_QUERY_MULTIPLE)
+#define NAT_AGEOUT_NOTIFICATION_BATCH     256      // Max aged out keys sent in one notification
 
 struct NatEntryValue
 {
@@ -45,6 +50,7 @@ struct NatEntryValue
     string         entry_type;         // Entry type - Static or Dynamic 
     time_t         activeTime;         // Timestamp in secs when the entry was last seen as active
     time_t         ageOutTime;         // Timestamp in secs when the entry expires
+    time_t         hitBitQueryTime;    // Timestamp in secs when the hit bit is queried next
     bool           addedToHw;          // Boolean to represent added to hardware
 
     bool operator<(const NatEntryValue& other) const
@@ -73,6 +79,7 @@ struct NaptEntryValue
     string         entry_type;         // Entry type - Static or Dynamic
     time_t         activeTime;         // Timestamp in secs when the entry was last seen as active
     time_t         ageOutTime;         // Timestamp in secs when the entry expires
+    time_t         hitBitQueryTime;    // Timestamp in secs when the hit bit is queried next
     bool           addedToHw;          // Boolean to represent added to hardware
 
     bool operator<(const NaptEntryValue& other) const
@@ -99,6 +106,7 @@ struct TwiceNatEntryValue
     string         entry_type;         // Entry type - Static or Dynamic 
     time_t         activeTime;         // Timestamp in secs when the entry was last seen as active
     time_t         ageOutTime;         // Timestamp in secs when the entry expires
+    time_t         hitBitQueryTime;    // Timestamp in secs when the hit bit is queried next
     bool           addedToHw;          // Boolean to represent added to hardware
 
     bool operator<(const TwiceNatEntryValue& other) const
@@ -130,6 +138,7 @@ struct TwiceNaptEntryValue
     string         entry_type;         // Entry type - Static or Dynamic
     time_t         activeTime;         // Timestamp in secs when the entry was last seen as active
     time_t         ageOutTime;         // Timestamp in secs when the entry expires
+    time_t         hitBitQueryTime;    // Timestamp in secs when the hit bit is queried next
     bool           addedToHw;          // Boolean to represent added to hardware
 
     bool operator<(const TwiceNaptEntryValue& other) const
@@ -176,6 +185,51 @@ struct DnatEntries
 
 typedef std::map<IpAddress, DnatEntries> DnatNhResolvCache;
 
+/* Dynamic entries whose hit bits are due to be queried at the same time */
+struct NatAgingBucket
+{
+    std::set<IpAddress>          nat;
+    std::set<NaptEntryKey>       napt;
+    std::set<TwiceNatEntryKey>   twiceNat;
+    std::set<TwiceNaptEntryKey>  twiceNapt;
+};
+
+/* Aging wheel keyed by the time of the next hit bit query. An entry is only
+ * queried when it can age out, instead of walking all the entries every period.
+ * Stale keys (entry removed or rescheduled) are skipped when the bucket expires.
+ */
+typedef std::map<time_t, NatAgingBucket> NatAgingWheel;
+
+/* NAT entry queued in the bulker for creation. The entry caches and
+ * counters are updated once the bulk is flushed to the hardware. */
+template <typename KeyType>
+struct NatBulkContext
+{
+    KeyType                       key;
+    sai_nat_entry_t               entry;
+    std::vector<sai_attribute_t>  attrs;
+    sai_status_t                  status;
+
+    NatBulkContext(const KeyType &key, const sai_nat_entry_t &entry, const sai_attribute_t *attr_list, uint32_t attr_count)
+        : key(key), entry(entry), attrs(attr_list, attr_list + attr_count), status(SAI_STATUS_NOT_EXECUTED)
+    {
+    }
+};
+
+/* NAT entry queued in the bulker for removal */
+struct NatBulkRemoveContext
+{
+    sai_nat_entry_t  entry;
+    sai_status_t     status;
+};
+
+struct NatHitBitQuery
+{
+    sai_nat_entry_t  entry;
+    sai_attribute_t  attrs[2];
+    sai_status_t     status;
+};
+
 class NatOrch: public Orch, public Subject, public Observer
 {
 public:
@@ -218,6 +272,18 @@ private:
     string                  m_dbgCompName;
     IpAddress               nullIpv4Addr;
     DnatPoolEntry           m_dnatPoolEntries;
+    NatAgingWheel           m_agingWheel;
+
+    EntityBulker<sai_nat_api_t>  m_natBulker;
+    uint32_t                     m_natBulkDepth;      // Nesting depth of the NAT bulk scopes
+
+    std::deque<NatBulkContext<IpAddress>>          m_snatBulkCtx;
+    std::deque<NatBulkContext<IpAddress>>          m_dnatBulkCtx;
+    std::deque<NatBulkContext<NaptEntryKey>>       m_snaptBulkCtx;
+    std::deque<NatBulkContext<NaptEntryKey>>       m_dnaptBulkCtx;
+    std::deque<NatBulkContext<TwiceNatEntryKey>>   m_twiceNatBulkCtx;
+    std::deque<NatBulkContext<TwiceNaptEntryKey>>  m_twiceNaptBulkCtx;
+    std::deque<NatBulkRemoveContext>               m_natRemoveBulkCtx;
 
     std::shared_ptr<NotificationProducer> setTimeoutNotifier;
 
@@ -287,12 +353,33 @@ private:
     bool removeHwDnatEntry(const IpAddress &dstIp);
     bool removeHwDnaptEntry(const NaptEntryKey &key);
     bool addHwDnatPoolEntry(const IpAddress &dstIp);
+    bool addHwSnatEntryPost(NatBulkContext<IpAddress> &ctx, time_t now);
+    bool addHwSnaptEntryPost(NatBulkContext<NaptEntryKey> &ctx, time_t now);
+    bool addHwTwiceNatEntryPost(NatBulkContext<TwiceNatEntryKey> &ctx, time_t now);
+    bool addHwTwiceNaptEntryPost(NatBulkContext<TwiceNaptEntryKey> &ctx, time_t now);
+    bool addHwDnatEntryPost(NatBulkContext<IpAddress> &ctx);
+    bool addHwDnaptEntryPost(NatBulkContext<NaptEntryKey> &ctx);
+    template <typename KeyType>
+    bool queueHwNatEntry(std::deque<NatBulkContext<KeyType>> &bulkCtx, const KeyType &key,
+                         const sai_nat_entry_t &entry, const sai_attribute_t *attr_list, uint32_t attr_count);
+    void queueHwNatEntryRemoval(const sai_nat_entry_t &entry);
+    void flushHwNatEntries(void);
+    void flushHwNatEntriesIfPending(void);
+    void beginHwNatBulk(void);
+    void endHwNatBulk(void);
     bool removeHwDnatPoolEntry(const IpAddress &dstIp);
 
-    bool checkIfNatEntryIsActive(const NatEntry::iterator &iter, time_t now);
-    bool checkIfNaptEntryIsActive(const NaptEntry::iterator &iter, time_t now);
-    bool checkIfTwiceNatEntryIsActive(const TwiceNatEntry::iterator &iter, time_t now);
-    bool checkIfTwiceNaptEntryIsActive(const TwiceNaptEntry::iterator &iter, time_t now);
+    void scheduleHitBitQuery(const IpAddress &key, NatEntryValue &entry, time_t when);
+    void scheduleHitBitQuery(const NaptEntryKey &key, NaptEntryValue &entry, time_t when);
+    void scheduleHitBitQuery(const TwiceNatEntryKey &key, TwiceNatEntryValue &entry, time_t when);
+    void scheduleHitBitQuery(const TwiceNaptEntryKey &key, TwiceNaptEntryValue &entry, time_t when);
+    void rebuildAgingWheel(void);
+    void getHitBits(std::vector<NatHitBitQuery> &queries);
+    void queryNatHitBits(const std::set<IpAddress> &keys, time_t now);
+    void queryNaptHitBits(const std::set<NaptEntryKey> &keys, time_t now);
+    void queryTwiceNatHitBits(const std::set<TwiceNatEntryKey> &keys, time_t now);
+    void queryTwiceNaptHitBits(const std::set<TwiceNaptEntryKey> &keys, time_t now);
+    void sendAgeOutNotifications(const string &op, const vector<string> &keys);
 
     void enableNatFeature(void);
     void disableNatFeature(void);
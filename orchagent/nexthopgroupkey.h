@@ -2,6 +2,8 @@
 #define SWSS_NEXTHOPGROUPKEY_H
 
 #include "nexthopkey.h"
+#include <memory>
+#include <unordered_map>
 
 class NextHopGroupKey
 {
@@ -13,11 +15,18 @@ public:
     {
         m_overlay_nexthops = false;
         m_srv6_nexthops = false;
+        if (findInterned(nexthops))
+        {
+            return;
+        }
+
         auto nhv = tokenize(nexthops, NHG_DELIMITER);
+        std::set<NextHopKey> nhs;
         for (const auto &nh : nhv)
         {
-            m_nexthops.insert(nh);
+            nhs.insert(nh);
         }
+        setNextHops(nexthops, nhv, std::move(nhs));
     }
 
     /* ip_string|if_alias|vni|router_mac separated by ',' */
@@ -28,10 +37,11 @@ public:
             m_overlay_nexthops = true;
             m_srv6_nexthops = false;
             auto nhv = tokenize(nexthops, NHG_DELIMITER);
+            auto &nhs = mutableNextHops();
             for (const auto &nh_str : nhv)
             {
                 auto nh = NextHopKey(nh_str, overlay_nh, srv6_nh);
-                m_nexthops.insert(nh);
+                nhs.insert(nh);
             }
         }
         else if (srv6_nh)
@@ -39,10 +49,11 @@ public:
             m_overlay_nexthops = false;
             m_srv6_nexthops = true;
             auto nhv = tokenize(nexthops, NHG_DELIMITER);
+            auto &nhs = mutableNextHops();
             for (const auto &nh_str : nhv)
             {
                 auto nh = NextHopKey(nh_str, overlay_nh, srv6_nh);
-                m_nexthops.insert(nh);
+                nhs.insert(nh);
             }
         }
     }
@@ -51,37 +62,79 @@ public:
     {
         m_overlay_nexthops = false;
         m_srv6_nexthops = false;
+        std::string interned_key = nexthops + "|" + weights;
+        if (findInterned(interned_key))
+        {
+            return;
+        }
+
         std::vector<std::string> nhv = tokenize(nexthops, NHG_DELIMITER);
         std::vector<std::string> wtv = tokenize(weights, NHG_DELIMITER);
         bool set_weight = wtv.size() == nhv.size();
+        std::set<NextHopKey> nhs;
         for (uint32_t i = 0; i < nhv.size(); i++)
         {
             NextHopKey nh(nhv[i]);
             nh.weight = set_weight? (uint32_t)std::stoi(wtv[i]) : 0;
-            m_nexthops.insert(nh);
+            nhs.insert(nh);
         }
+        setNextHops(interned_key, nhv, std::move(nhs));
     }
 
     inline const std::set<NextHopKey> &getNextHops() const
     {
-        return m_nexthops;
+        static const std::set<NextHopKey> empty;
+        return m_nexthops ? m_nexthops->nexthops : empty;
     }
 
     inline size_t getSize() const
     {
-        return m_nexthops.size();
+        return m_nexthops ? m_nexthops->nexthops.size() : 0;
+    }
+
+    /* Hash of the next hops and weights, computed once per next hop set */
+    size_t hash() const
+    {
+        if (!m_nexthops)
+        {
+            return 0;
+        }
+
+        if (!m_nexthops->hashed)
+        {
+            size_t seed = 0;
+            for (const auto &nh : m_nexthops->nexthops)
+            {
+                size_t nh_hash = std::hash<std::string>()(nh.ip_address.to_string()) ^
+                                 (std::hash<std::string>()(nh.alias) << 1) ^
+                                 ((size_t)nh.weight << 2);
+                seed ^= nh_hash + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+            }
+            m_nexthops->hash = seed;
+            m_nexthops->hashed = true;
+        }
+
+        return m_nexthops->hash;
     }
 
     inline bool operator<(const NextHopGroupKey &o) const
     {
-        if (m_nexthops < o.m_nexthops)
+        const auto &nhs = getNextHops();
+        const auto &o_nhs = o.getNextHops();
+
+        if (m_nexthops == o.m_nexthops)
+        {
+            return false;
+        }
+
+        if (nhs < o_nhs)
         {
             return true;
         }
-        else if (m_nexthops == o.m_nexthops)
+        else if (nhs == o_nhs)
         {
-            auto it1 = m_nexthops.begin();
-            for (auto& it2 : o.m_nexthops)
+            auto it1 = nhs.begin();
+            for (auto& it2 : o_nhs)
             {
                 if (it1->weight < it2.weight)
                 {
@@ -99,12 +152,31 @@ public:
 
     inline bool operator==(const NextHopGroupKey &o) const
     {
-        if (m_nexthops != o.m_nexthops)
+        /* Keys sharing the same storage are equal */
+        if (m_nexthops == o.m_nexthops)
+        {
+            return true;
+        }
+
+        if (getSize() != o.getSize())
+        {
+            return false;
+        }
+
+        if (m_nexthops && o.m_nexthops && m_nexthops->hashed && o.m_nexthops->hashed &&
+            m_nexthops->hash != o.m_nexthops->hash)
         {
             return false;
         }
-        auto it1 = m_nexthops.begin();
-        for (auto& it2 : o.m_nexthops)
+
+        const auto &nhs = getNextHops();
+        const auto &o_nhs = o.getNextHops();
+        if (nhs != o_nhs)
+        {
+            return false;
+        }
+        auto it1 = nhs.begin();
+        for (auto& it2 : o_nhs)
         {
             if (it2.weight != it1->weight)
             {
@@ -122,33 +194,33 @@ public:
 
     void add(const std::string &ip, const std::string &alias)
     {
-        m_nexthops.emplace(ip, alias);
+        mutableNextHops().emplace(ip, alias);
     }
 
     void add(const std::string &nh)
     {
-        m_nexthops.insert(nh);
+        mutableNextHops().insert(nh);
     }
 
     void add(const NextHopKey &nh)
     {
-        m_nexthops.insert(nh);
+        mutableNextHops().insert(nh);
     }
 
     bool contains(const std::string &ip, const std::string &alias) const
     {
         NextHopKey nh(ip, alias);
-        return m_nexthops.find(nh) != m_nexthops.end();
+        return getNextHops().find(nh) != getNextHops().end();
     }
 
     bool contains(const std::string &nh) const
     {
-        return m_nexthops.find(nh) != m_nexthops.end();
+        return getNextHops().find(nh) != getNextHops().end();
     }
 
     bool contains(const NextHopKey &nh) const
     {
-        return m_nexthops.find(nh) != m_nexthops.end();
+        return getNextHops().find(nh) != getNextHops().end();
     }
 
     bool contains(const NextHopGroupKey &nhs) const
@@ -165,7 +237,7 @@ public:
 
     bool hasIntfNextHop() const
     {
-        for (const auto &nh : m_nexthops)
+        for (const auto &nh : getNextHops())
         {
             if (nh.isIntfNextHop())
             {
@@ -178,26 +250,27 @@ public:
     void remove(const std::string &ip, const std::string &alias)
     {
         NextHopKey nh(ip, alias);
-        m_nexthops.erase(nh);
+        mutableNextHops().erase(nh);
     }
 
     void remove(const std::string &nh)
     {
-        m_nexthops.erase(nh);
+        mutableNextHops().erase(nh);
     }
 
     void remove(const NextHopKey &nh)
     {
-        m_nexthops.erase(nh);
+        mutableNextHops().erase(nh);
     }
 
     const std::string to_string() const
     {
         string nhs_str;
+        const auto &nhs = getNextHops();
 
-        for (auto it = m_nexthops.begin(); it != m_nexthops.end(); ++it)
+        for (auto it = nhs.begin(); it != nhs.end(); ++it)
         {
-            if (it != m_nexthops.begin())
+            if (it != nhs.begin())
             {
                 nhs_str += NHG_DELIMITER;
             }
@@ -223,13 +296,122 @@ public:
 
     void clear()
     {
-        m_nexthops.clear();
+        m_nexthops.reset();
     }
 
 private:
-    std::set<NextHopKey> m_nexthops;
-    bool m_overlay_nexthops;
-    bool m_srv6_nexthops;
+    struct NextHops
+    {
+        std::set<NextHopKey> nexthops;
+        size_t hash = 0;
+        bool hashed = false;
+        /* Set when referenced by the intern table, such next hops are never modified */
+        bool interned = false;
+    };
+
+    /* Next hop group strings parsed so far, entries are removed with their next hops */
+    typedef std::unordered_map<std::string, std::weak_ptr<NextHops>> InternTable;
+
+    static InternTable &internTable()
+    {
+        /* Never destroyed, interned keys may outlive it at exit otherwise */
+        static InternTable *table = new InternTable;
+        return *table;
+    }
+
+    bool findInterned(const std::string &str)
+    {
+        auto &table = internTable();
+        auto it = table.find(str);
+        if (it == table.end())
+        {
+            return false;
+        }
+
+        m_nexthops = it->second.lock();
+        return m_nexthops != nullptr;
+    }
+
+    /*
+     * Interns the next hops parsed from str. Next hops without an explicit
+     * interface, or with a VRF, resolve their alias from the current router
+     * interfaces and are not interned.
+     */
+    void setNextHops(const std::string &str, const std::vector<std::string> &nhv, std::set<NextHopKey> &&nhs)
+    {
+        bool internable = true;
+        for (const auto &nh : nhv)
+        {
+            auto pos = nh.find(NH_DELIMITER);
+            if (pos == std::string::npos || !nh.compare(pos + 1, strlen(VRF_PREFIX), VRF_PREFIX))
+            {
+                internable = false;
+                break;
+            }
+        }
+
+        if (!internable)
+        {
+            m_nexthops = std::make_shared<NextHops>();
+            m_nexthops->nexthops = std::move(nhs);
+            return;
+        }
+
+        auto &table = internTable();
+        auto rc = table.emplace(str, std::weak_ptr<NextHops>());
+        const std::string *interned_key = &rc.first->first;
+
+        auto data = new NextHops();
+        data->nexthops = std::move(nhs);
+        data->interned = true;
+        m_nexthops = std::shared_ptr<NextHops>(data, [interned_key](NextHops *p) {
+            auto &table = internTable();
+            auto it = table.find(*interned_key);
+            if (it != table.end())
+            {
+                table.erase(it);
+            }
+            delete p;
+        });
+        rc.first->second = m_nexthops;
+    }
+
+    /*
+     * Copies of a key share the next hop set, it is only duplicated when a
+     * shared or interned key is modified. This keeps tables holding the same
+     * next hops for many entries, e.g. routes, from storing a set per entry.
+     */
+    std::set<NextHopKey> &mutableNextHops()
+    {
+        if (!m_nexthops)
+        {
+            m_nexthops = std::make_shared<NextHops>();
+        }
+        else if (m_nexthops.use_count() > 1 || m_nexthops->interned)
+        {
+            auto data = std::make_shared<NextHops>();
+            data->nexthops = m_nexthops->nexthops;
+            m_nexthops = data;
+        }
+        m_nexthops->hashed = false;
+        return m_nexthops->nexthops;
+    }
+
+    std::shared_ptr<NextHops> m_nexthops;
+    bool m_overlay_nexthops = false;
+    bool m_srv6_nexthops = false;
 };
 
+namespace std
+{
+    template <>
+    struct hash<NextHopGroupKey>
+    {
+        size_t operator()(const NextHopGroupKey &key) const
+        {
+            return key.hash();
+        }
+    };
+}
+
 #endif /* SWSS_NEXTHOPGROUPKEY_H */
@@ -23,6 +23,8 @@ extern ofstream gRecordOfs;
 extern bool gLogRotate;
 extern string gRecordFile;
 
+constexpr uint64_t ConsumerStats::latencyBucketBounds[];
+
 Orch::Orch(DBConnector *db, const string tableName, int pri)
 {
     addConsumer(db, tableName, pri);
@@ -94,13 +96,19 @@ void Consumer::addToSync(const KeyOpFieldsValuesTuple &entry)
     if (m_toSync.find(key) == m_toSync.end())
     {
         m_toSync.emplace(key, entry);
+        m_pendingSince[key] = chrono::steady_clock::now();
     }
 
     /* if a DEL task comes, we overwrite the old key */
     else if (op == DEL_COMMAND)
     {
-        m_toSync.erase(key);
-        m_toSync.emplace(key, entry);
+        /* Insert the DEL ahead of erasing the old tasks, the key stays pending */
+        auto ret = m_toSync.equal_range(key);
+        auto del = m_toSync.emplace_hint(ret.second, key, entry);
+        while (ret.first != del)
+        {
+            ret.first = m_toSync.erase(ret.first);
+        }
     }
     else
     {
@@ -232,13 +240,83 @@ void Consumer::execute()
         update_size = addToSync(entries);
     } while (update_size != 0);
 
+    m_stats.executions++;
     drain();
 }
 
 void Consumer::drain()
 {
     if (!m_toSync.empty())
+    {
+        auto start = chrono::steady_clock::now();
         m_orch->doTask(*this);
+        updateStats(start, chrono::steady_clock::now());
+    }
+}
+
+void Consumer::completeTask(const string &key)
+{
+    auto it = m_pendingSince.find(key);
+    if (it == m_pendingSince.end())
+    {
+        return;
+    }
+
+    auto latency = chrono::steady_clock::now() - it->second;
+    auto latencyUs = static_cast<uint64_t>(chrono::duration_cast<chrono::microseconds>(latency).count());
+    size_t bucket = 0;
+    while (bucket < ConsumerStats::LATENCY_BUCKETS - 1 && latencyUs >= ConsumerStats::latencyBucketBounds[bucket])
+    {
+        bucket++;
+    }
+    m_stats.latency[bucket]++;
+    m_stats.completed++;
+
+    m_pendingSince.erase(it);
+}
+
+void Consumer::updateStats(chrono::steady_clock::time_point start, chrono::steady_clock::time_point end)
+{
+    auto drainTimeUs = static_cast<uint64_t>(chrono::duration_cast<chrono::microseconds>(end - start).count());
+    m_stats.drains++;
+    m_stats.drainTimeUs += drainTimeUs;
+    m_stats.maxDrainTimeUs = max(m_stats.maxDrainTimeUs, drainTimeUs);
+
+    /*
+     * The tasks which left m_toSync were accounted as they were erased, the
+     * ones dropped in other ways are accounted once nothing is pending
+     */
+    if (m_toSync.empty())
+    {
+        while (!m_pendingSince.empty())
+        {
+            completeTask(m_pendingSince.begin()->first);
+        }
+    }
+
+    m_stats.retries += m_toSync.size();
+}
+
+void Consumer::dumpStats(vector<FieldValueTuple> &fvs)
+{
+    static const char *latencyFields[ConsumerStats::LATENCY_BUCKETS] = {
+        "latency_lt_1ms", "latency_lt_10ms", "latency_lt_100ms", "latency_lt_1s", "latency_lt_10s", "latency_ge_10s"
+    };
+
+    fvs.emplace_back("pending", to_string(m_toSync.size()));
+    fvs.emplace_back("executions", to_string(m_stats.executions));
+    fvs.emplace_back("drains", to_string(m_stats.drains));
+    fvs.emplace_back("drain_time_us", to_string(m_stats.drainTimeUs));
+    fvs.emplace_back("max_drain_time_us", to_string(m_stats.maxDrainTimeUs));
+    fvs.emplace_back("retries", to_string(m_stats.retries));
+    fvs.emplace_back("completed", to_string(m_stats.completed));
+    for (size_t i = 0; i < ConsumerStats::LATENCY_BUCKETS; i++)
+    {
+        fvs.emplace_back(latencyFields[i], to_string(m_stats.latency[i]));
+    }
+
+    /* The maximum is reported per export interval */
+    m_stats.maxDrainTimeUs = 0;
 }
 
 string Consumer::dumpTuple(const KeyOpFieldsValuesTuple &tuple)
@@ -562,6 +640,24 @@ void Orch::dumpPendingTasks(vector<string> &ts)
     }
 }
 
+void Orch::dumpConsumerStats(vector<KeyOpFieldsValuesTuple> &stats)
+{
+    for (auto &it : m_consumerMap)
+    {
+        Consumer* consumer = dynamic_cast<Consumer *>(it.second.get());
+        if (consumer == NULL)
+        {
+            continue;
+        }
+
+        KeyOpFieldsValuesTuple entry;
+        kfvKey(entry) = consumer->getDbName() + ":" + consumer->getTableName();
+        kfvOp(entry) = SET_COMMAND;
+        consumer->dumpStats(kfvFieldsValues(entry));
+        stats.push_back(move(entry));
+    }
+}
+
 void Orch::flushResponses()
 {
     m_publisher.flush();
@@ -861,59 +957,185 @@ Executor *Orch::getExecutor(string executorName)
     return NULL;
 }
 
+void Orch2::logRequestException()
+{
+    try
+    {
+        throw;
+    }
+    catch (const std::invalid_argument& e)
+    {
+        SWSS_LOG_ERROR("Parse error: %s", e.what());
+    }
+    catch (const std::logic_error& e)
+    {
+        SWSS_LOG_ERROR("Logic error: %s", e.what());
+    }
+    catch (const std::exception& e)
+    {
+        SWSS_LOG_ERROR("Exception was catched in the request parser: %s", e.what());
+    }
+    catch (...)
+    {
+        SWSS_LOG_ERROR("Unknown exception was catched in the request parser");
+    }
+}
+
+void Orch2::logBulkResult(const Request& request, size_t queued, size_t failed)
+{
+    SWSS_LOG_INFO("Programmed %zu %s entries in bulk, %zu failed",
+                  queued, request.getTableName().c_str(), failed);
+}
+
+bool Orch2::doRequest(Consumer &consumer, const KeyOpFieldsValuesTuple &tuple)
+{
+    bool erase_from_queue = true;
+    try
+    {
+        request_.parse(tuple);
+        auto table_name = consumer.getTableName();
+        request_.setTableName(table_name);
+
+        auto op = request_.getOperation();
+        if (op == SET_COMMAND)
+        {
+            erase_from_queue = addOperation(request_);
+        }
+        else if (op == DEL_COMMAND)
+        {
+            erase_from_queue = delOperation(request_);
+        }
+        else
+        {
+            SWSS_LOG_ERROR("Wrong operation. Check RequestParser: %s", op.c_str());
+        }
+    }
+    catch (...)
+    {
+        logRequestException();
+    }
+    request_.clear();
+
+    return erase_from_queue;
+}
+
 void Orch2::doTask(Consumer &consumer)
 {
     SWSS_LOG_ENTER();
 
+    if (m_bulkMode)
+    {
+        doBulkTask(consumer);
+        return;
+    }
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
-        bool erase_from_queue = true;
+        if (doRequest(consumer, it->second))
+        {
+            it = consumer.m_toSync.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void Orch2::addOperations(std::vector<Orch2BulkRequest>& requests)
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& request : requests)
+    {
         try
         {
-            request_.parse(it->second);
-            auto table_name = consumer.getTableName();
-            request_.setTableName(table_name);
+            request.erase = addOperation(request.request);
+        }
+        catch (...)
+        {
+            logRequestException();
+            request.erase = true;
+        }
+    }
+}
 
-            auto op = request_.getOperation();
-            if (op == SET_COMMAND)
-            {
-                erase_from_queue = addOperation(request_);
-            }
-            else if (op == DEL_COMMAND)
-            {
-                erase_from_queue = delOperation(request_);
-            }
-            else
-            {
-                SWSS_LOG_ERROR("Wrong operation. Check RequestParser: %s", op.c_str());
-            }
+void Orch2::doBulkTask(Consumer &consumer)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<SyncMap::iterator> tasks;
+    std::vector<Orch2BulkRequest> requests;
+    std::set<std::string> keys;
+
+    auto run_batch = [&] () {
+        if (requests.empty())
+        {
+            return;
         }
-        catch (const std::invalid_argument& e)
+
+        addOperations(requests);
+
+        for (size_t i = 0; i < requests.size(); i++)
         {
-            SWSS_LOG_ERROR("Parse error: %s", e.what());
+            if (requests[i].erase)
+            {
+                consumer.m_toSync.erase(tasks[i]);
+            }
+            m_bulkRequests[i].clear();
         }
-        catch (const std::logic_error& e)
+
+        tasks.clear();
+        requests.clear();
+        keys.clear();
+    };
+
+    auto it = consumer.m_toSync.begin();
+    while (it != consumer.m_toSync.end())
+    {
+        auto task = it++;
+        const auto& key = kfvKey(task->second);
+        bool is_set = kfvOp(task->second) == SET_COMMAND;
+
+        if (!is_set || keys.find(key) != keys.end())
         {
-            SWSS_LOG_ERROR("Logic error: %s", e.what());
+            run_batch();
         }
-        catch (const std::exception& e)
+
+        if (!is_set)
         {
-            SWSS_LOG_ERROR("Exception was catched in the request parser: %s", e.what());
+            if (doRequest(consumer, task->second))
+            {
+                consumer.m_toSync.erase(task);
+            }
+            continue;
         }
-        catch (...)
+
+        if (m_bulkRequests.size() == requests.size())
         {
-            SWSS_LOG_ERROR("Unknown exception was catched in the request parser");
+            m_bulkRequests.emplace_back(request_);
         }
-        request_.clear();
+        Request& request = m_bulkRequests[requests.size()];
 
-        if (erase_from_queue)
+        try
         {
-            it = consumer.m_toSync.erase(it);
+            request.parse(task->second);
+            auto table_name = consumer.getTableName();
+            request.setTableName(table_name);
         }
-        else
+        catch (...)
         {
-            ++it;
+            logRequestException();
+            request.clear();
+            consumer.m_toSync.erase(task);
+            continue;
         }
+
+        tasks.push_back(task);
+        requests.emplace_back(request);
+        keys.insert(key);
     }
+
+    run_batch();
 }
@@ -7,6 +7,10 @@
 #include <set>
 #include <memory>
 #include <utility>
+#include <chrono>
+#include <deque>
+#include <vector>
+#include <functional>
 
 extern "C" {
 #include "sai.h"
@@ -79,7 +83,54 @@ typedef std::pair<std::string, sai_object_id_t> object_map_pair;
 // Use multimap to support multiple OpFieldsValues for the same key (e,g, DEL and SET)
 // The order of the key-value pairs whose keys compare equivalent is the order of
 // insertion and does not change. (since C++11)
-typedef std::multimap<std::string, swss::KeyOpFieldsValuesTuple> SyncMap;
+// Erasing through SyncMap reports every key whose last task leaves the map.
+class SyncMap : public std::multimap<std::string, swss::KeyOpFieldsValuesTuple>
+{
+public:
+    typedef std::multimap<std::string, swss::KeyOpFieldsValuesTuple> base_type;
+    typedef std::function<void(const std::string &)> KeyErasedCallback;
+
+    void setKeyErasedCallback(KeyErasedCallback callback)
+    {
+        m_keyErased = std::move(callback);
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        if (m_keyErased && !hasOtherTask(pos))
+        {
+            m_keyErased(pos->first);
+        }
+        return base_type::erase(pos);
+    }
+
+    iterator erase(iterator pos)
+    {
+        return erase(const_iterator(pos));
+    }
+
+    size_type erase(const key_type &key)
+    {
+        auto range = equal_range(key);
+        size_type count = 0;
+        while (range.first != range.second)
+        {
+            range.first = erase(range.first);
+            count++;
+        }
+        return count;
+    }
+
+private:
+    KeyErasedCallback m_keyErased;
+
+    bool hasOtherTask(const_iterator pos) const
+    {
+        auto next = std::next(pos);
+        return (next != end() && next->first == pos->first) ||
+               (pos != begin() && std::prev(pos)->first == pos->first);
+    }
+};
 
 typedef std::pair<std::string, int> table_name_with_pri_t;
 
@@ -132,11 +183,31 @@ protected:
     swss::Selectable *getSelectable() const { return m_selectable; }
 };
 
+/*
+ * Consumer instrumentation, exported periodically by OrchDaemon.
+ * Latency is measured from the time a key enters m_toSync until it leaves it.
+ */
+struct ConsumerStats
+{
+    // Upper bounds of the latency histogram buckets in microseconds, the last bucket is unbounded
+    static constexpr uint64_t latencyBucketBounds[] = { 1000, 10000, 100000, 1000000, 10000000 };
+    static constexpr size_t LATENCY_BUCKETS = sizeof(latencyBucketBounds) / sizeof(latencyBucketBounds[0]) + 1;
+
+    uint64_t executions = 0;        // select wakeups handled by execute()
+    uint64_t drains = 0;            // doTask() runs with pending entries
+    uint64_t drainTimeUs = 0;       // total time spent in those runs
+    uint64_t maxDrainTimeUs = 0;    // longest run since the last export
+    uint64_t retries = 0;           // entries left pending after a run
+    uint64_t completed = 0;         // entries which left m_toSync
+    uint64_t latency[LATENCY_BUCKETS] = {};
+};
+
 class Consumer : public Executor {
 public:
     Consumer(swss::ConsumerTableBase *select, Orch *orch, const std::string &name)
         : Executor(select, orch, name)
     {
+        m_toSync.setKeyErasedCallback([this](const std::string &key) { completeTask(key); });
     }
 
     swss::ConsumerTableBase *getConsumerTable() const
@@ -162,6 +233,12 @@ public:
     std::string dumpTuple(const swss::KeyOpFieldsValuesTuple &tuple);
     void dumpPendingTasks(std::vector<std::string> &ts);
 
+    const ConsumerStats &getStats() const
+    {
+        return m_stats;
+    }
+    void dumpStats(std::vector<swss::FieldValueTuple> &fvs);
+
     size_t refillToSync();
     size_t refillToSync(swss::Table* table);
     void execute();
@@ -175,6 +252,15 @@ public:
 
     // Returns: the number of entries added to m_toSync
     size_t addToSync(const std::deque<swss::KeyOpFieldsValuesTuple> &entries);
+
+private:
+    ConsumerStats m_stats;
+
+    // Time each pending key entered m_toSync
+    std::unordered_map<std::string, std::chrono::steady_clock::time_point> m_pendingSince;
+
+    void completeTask(const std::string &key);
+    void updateStats(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end);
 };
 
 typedef std::map<std::string, std::shared_ptr<Executor>> ConsumerMap;
@@ -224,6 +310,9 @@ public:
 
     void dumpPendingTasks(std::vector<std::string> &ts);
 
+    // Collect the statistics of all consumers, keyed by "<db>:<table>"
+    void dumpConsumerStats(std::vector<swss::KeyOpFieldsValuesTuple> &stats);
+
     /**
      * @brief Flush pending responses
      */
@@ -258,6 +347,18 @@ private:
 
 #include "request_parser.h"
 
+/* SET request of a batch, see Orch2::addOperations() */
+struct Orch2BulkRequest
+{
+    Orch2BulkRequest(const Request& request) : request(request)
+    {
+    }
+
+    const Request& request;
+    /* Set to false to keep the task in the queue and retry it later */
+    bool erase = true;
+};
+
 class Orch2 : public Orch
 {
 public:
@@ -277,8 +378,99 @@ protected:
     virtual bool addOperation(const Request& request)=0;
     virtual bool delOperation(const Request& request)=0;
 
+    /*
+     * In bulk mode the consecutive SET requests of a drain are parsed first
+     * and handed to addOperations() together, so their SAI objects can be
+     * created by one bulk call. A DEL request, or a SET request for a key
+     * which is already in the batch, ends the batch, which keeps the requests
+     * of a key in order.
+     */
+    void setBulkMode(bool enable)
+    {
+        m_bulkMode = enable;
+    }
+
+    /* Complete every request of the batch, calls addOperation() one by one by default */
+    virtual void addOperations(std::vector<Orch2BulkRequest>& requests);
+
+    /*
+     * Helper for addOperations(): stage(request, ctx) validates a request and
+     * queues its objects into the bulkers of the orch, setting ctx.queued, or
+     * completes it right away and returns whether to erase it. flush() then
+     * creates the queued objects and complete(ctx) finishes the requests whose
+     * objects were queued. The contexts live until complete(), the bulkers
+     * keep pointers to the object ids they hold.
+     */
+    template <typename Ctx, typename Stage, typename Flush, typename Complete>
+    void addOperationsInBulk(std::vector<Orch2BulkRequest>& requests, Stage stage, Flush flush, Complete complete)
+    {
+        std::vector<Ctx> contexts(requests.size());
+        size_t queued = 0;
+
+        for (size_t i = 0; i < requests.size(); i++)
+        {
+            try
+            {
+                requests[i].erase = stage(requests[i].request, contexts[i]);
+            }
+            catch (...)
+            {
+                logRequestException();
+            }
+
+            /* Objects queued before an exception are still completed after the flush */
+            if (contexts[i].queued)
+            {
+                queued++;
+            }
+        }
+
+        if (queued == 0)
+        {
+            return;
+        }
+
+        flush();
+
+        size_t failed = 0;
+        for (size_t i = 0; i < requests.size(); i++)
+        {
+            if (!contexts[i].queued)
+            {
+                continue;
+            }
+
+            try
+            {
+                requests[i].erase = complete(contexts[i]);
+            }
+            catch (...)
+            {
+                logRequestException();
+                requests[i].erase = true;
+            }
+
+            if (!requests[i].erase)
+            {
+                failed++;
+            }
+        }
+
+        logBulkResult(requests.front().request, queued, failed);
+    }
+
+    /* Log the exception being handled, with the same messages as doTask() */
+    static void logRequestException();
+
 private:
+    void doBulkTask(Consumer& consumer);
+    bool doRequest(Consumer& consumer, const swss::KeyOpFieldsValuesTuple& tuple);
+    static void logBulkResult(const Request& request, size_t queued, size_t failed);
+
     Request& request_;
+    bool m_bulkMode = false;
+    /* Parsed requests of the current batch, reused from one batch to the next */
+    std::deque<Request> m_bulkRequests;
 };
 
 #endif /* SWSS_ORCH_H */
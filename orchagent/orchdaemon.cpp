@@ -16,6 +16,10 @@ using namespace swss;
 
 /* select() function timeout retry time */
 #define SELECT_TIMEOUT 1000
+#define STATS_PUBLISH_INTERVAL 10000
+
+#define ORCH_CONSUMER_STATS_TABLE "ORCH_CONSUMER_STATS"
+#define ORCH_DAEMON_STATS_TABLE   "ORCH_DAEMON_STATS"
 #define PFC_WD_POLL_MSECS 100
 
 extern sai_switch_api_t*           sai_switch_api;
@@ -55,6 +59,7 @@ BfdOrch *gBfdOrch;
 Srv6Orch *gSrv6Orch;
 FlowCounterRouteOrch *gFlowCounterRouteOrch;
 DebugCounterOrch *gDebugCounterOrch;
+CounterRateOrch *gCounterRateOrch;
 
 bool gIsNatSupported = false;
 bool gSaiRedisLogRotate = false;
@@ -62,6 +67,7 @@ event_handle_t g_events_handle;
 
 #define DEFAULT_MAX_BULK_SIZE 1000
 size_t gMaxBulkSize = DEFAULT_MAX_BULK_SIZE;
+bool gNativeCounterRates = false;
 
 OrchDaemon::OrchDaemon(DBConnector *applDb, DBConnector *configDb, DBConnector *stateDb, DBConnector *chassisAppDb) :
         m_applDb(applDb),
@@ -454,6 +460,13 @@ bool OrchDaemon::init()
     m_orchList.push_back(nvgre_tunnel_orch);
     m_orchList.push_back(nvgre_tunnel_map_orch);
 
+    if (gNativeCounterRates)
+    {
+        m_countersDb = std::make_unique<DBConnector>("COUNTERS_DB", 0);
+        gCounterRateOrch = new CounterRateOrch(m_countersDb.get());
+        m_orchList.push_back(gCounterRateOrch);
+    }
+
     if (m_fabricEnabled)
     {
         vector<table_name_with_pri_t> fabric_port_tables = {
@@ -709,6 +722,7 @@ void OrchDaemon::start()
     }
 
     auto tstart = std::chrono::high_resolution_clock::now();
+    auto tstats = tstart;
 
     while (true)
     {
@@ -728,6 +742,13 @@ void OrchDaemon::start()
             flush();
         }
 
+        if (std::chrono::duration_cast<std::chrono::milliseconds>(tend - tstats).count() >= STATS_PUBLISH_INTERVAL)
+        {
+            tstats = tend;
+
+            publishStats();
+        }
+
         if (ret == Select::ERROR)
         {
             SWSS_LOG_NOTICE("Error: %s!\n", strerror(errno));
@@ -736,6 +757,8 @@ void OrchDaemon::start()
 
         if (ret == Select::TIMEOUT)
         {
+            m_selectTimeouts++;
+
             /* Let sairedis to flush all SAI function call to ASIC DB.
              * Normally the redis pipeline will flush when enough request
              * accumulated. Still it is possible that small amount of
@@ -756,6 +779,8 @@ void OrchDaemon::start()
             continue;
         }
 
+        m_selectWakeups++;
+
         auto *c = (Executor *)s;
         c->execute();
 
@@ -766,6 +791,9 @@ void OrchDaemon::start()
         for (Orch *o : m_orchList)
             o->doTask();
 
+        m_loopBusyUs += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::high_resolution_clock::now() - tend).count());
+
         /*
          * Asked to check warm restart readiness.
          * Not doing this under Select::TIMEOUT condition because of
@@ -876,6 +904,47 @@ bool OrchDaemon::warmRestoreAndSyncUp()
     return true;
 }
 
+/*
+ * Publish the per consumer statistics and the select loop statistics to
+ * COUNTERS_DB, so that the orchagent backlog and convergence time can be
+ * monitored continuously.
+ */
+void OrchDaemon::publishStats()
+{
+    SWSS_LOG_ENTER();
+
+    if (!m_statsPipeline)
+    {
+        if (!m_countersDb)
+        {
+            m_countersDb = std::make_unique<DBConnector>("COUNTERS_DB", 0);
+        }
+        m_statsPipeline = std::make_unique<RedisPipeline>(m_countersDb.get());
+    }
+
+    Table consumerStatsTable(m_statsPipeline.get(), ORCH_CONSUMER_STATS_TABLE, true);
+    Table daemonStatsTable(m_statsPipeline.get(), ORCH_DAEMON_STATS_TABLE, true);
+
+    vector<KeyOpFieldsValuesTuple> stats;
+    for (Orch *o : m_orchList)
+    {
+        o->dumpConsumerStats(stats);
+    }
+
+    for (const auto &entry : stats)
+    {
+        consumerStatsTable.set(kfvKey(entry), kfvFieldsValues(entry));
+    }
+
+    daemonStatsTable.set("select_loop", {
+        { "wakeups", to_string(m_selectWakeups) },
+        { "timeouts", to_string(m_selectTimeouts) },
+        { "busy_time_us", to_string(m_loopBusyUs) }
+    });
+
+    m_statsPipeline->flush();
+}
+
 /*
  * Get tasks to sync for consumers of each orch being managed by this orch daemon
  */
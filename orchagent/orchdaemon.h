@@ -12,6 +12,7 @@
 #include "neighorch.h"
 #include "routeorch.h"
 #include "flowcounterrouteorch.h"
+#include "counterrateorch.h"
 #include "nhgorch.h"
 #include "cbf/cbfnhgorch.h"
 #include "cbf/nhgmaporch.h"
@@ -91,7 +92,15 @@ private:
     std::vector<Orch *> m_orchList;
     Select *m_select;
 
+    /* Select loop statistics, published along with the consumer statistics */
+    uint64_t m_selectWakeups = 0;
+    uint64_t m_selectTimeouts = 0;
+    uint64_t m_loopBusyUs = 0;
+    std::unique_ptr<DBConnector> m_countersDb;
+    std::unique_ptr<RedisPipeline> m_statsPipeline;
+
     void flush();
+    void publishStats();
 };
 
 class FabricOrchDaemon : public OrchDaemon
@@ -110,6 +110,52 @@ void PfcWdActionHandler::commitCounters(bool periodic /* = false */)
     updateWdCounters(sai_serialize_object_id(m_queue), finalStats);
 }
 
+bool PfcWdActionHandler::commitCountersDelta(RedisPipeline &pipe)
+{
+    SWSS_LOG_ENTER();
+
+    PfcWdHwStats hwStats;
+
+    if (!getHwCounters(hwStats))
+    {
+        return false;
+    }
+
+    // Deltas are applied with HINCRBY so that the periodic commit
+    // does not need to read the queue stats back from COUNTERS_DB
+    const vector<pair<string, int64_t>> deltas =
+    {
+        { PFC_WD_QUEUE_STATS_TX_PACKETS, static_cast<int64_t>(hwStats.txPkt - m_hwStats.txPkt) },
+        { PFC_WD_QUEUE_STATS_TX_DROPPED_PACKETS, static_cast<int64_t>(hwStats.txDropPkt - m_hwStats.txDropPkt) },
+        { PFC_WD_QUEUE_STATS_RX_PACKETS, static_cast<int64_t>(hwStats.rxPkt - m_hwStats.rxPkt) },
+        { PFC_WD_QUEUE_STATS_RX_DROPPED_PACKETS, static_cast<int64_t>(hwStats.rxDropPkt - m_hwStats.rxDropPkt) },
+        { PFC_WD_QUEUE_STATS_TX_PACKETS_LAST, static_cast<int64_t>(hwStats.txPkt - m_hwStats.txPkt) },
+        { PFC_WD_QUEUE_STATS_TX_DROPPED_PACKETS_LAST, static_cast<int64_t>(hwStats.txDropPkt - m_hwStats.txDropPkt) },
+        { PFC_WD_QUEUE_STATS_RX_PACKETS_LAST, static_cast<int64_t>(hwStats.rxPkt - m_hwStats.rxPkt) },
+        { PFC_WD_QUEUE_STATS_RX_DROPPED_PACKETS_LAST, static_cast<int64_t>(hwStats.rxDropPkt - m_hwStats.rxDropPkt) },
+    };
+
+    m_hwStats = hwStats;
+
+    string key = m_countersTable->getKeyName(sai_serialize_object_id(m_queue));
+    bool dirty = false;
+
+    for (const auto &delta : deltas)
+    {
+        if (delta.second == 0)
+        {
+            continue;
+        }
+
+        RedisCommand hincrby;
+        hincrby.format("HINCRBY %s %s %" PRId64, key.c_str(), delta.first.c_str(), delta.second);
+        pipe.push(hincrby, REDIS_REPLY_INTEGER);
+        dirty = true;
+    }
+
+    return dirty;
+}
+
 PfcWdActionHandler::PfcWdQueueStats PfcWdActionHandler::getQueueStats(shared_ptr<Table> countersTable, const string &queueIdStr)
 {
     SWSS_LOG_ENTER();
@@ -49,6 +49,9 @@ class PfcWdActionHandler
         static void initWdCounters(shared_ptr<Table> countersTable, const string &queueIdStr);
         void initCounters(void);
         void commitCounters(bool periodic = false);
+        // Queue the counters changed since the last commit into the pipeline.
+        // Returns false if the queue counters did not change.
+        bool commitCountersDelta(RedisPipeline &pipe);
 
         virtual bool getHwCounters(PfcWdHwStats& counters)
         {
@@ -81,7 +84,7 @@ class PfcWdActionHandler
         uint8_t m_queueId = 0;
         string m_portAlias;
         shared_ptr<Table> m_countersTable = nullptr;
-        PfcWdHwStats m_hwStats;
+        PfcWdHwStats m_hwStats = {};
 };
 
 // Pfc queue that implements forward action by disabling PFC on queue
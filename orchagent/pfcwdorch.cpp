@@ -1,5 +1,6 @@
 #include <limits.h>
 #include <inttypes.h>
+#include <chrono>
 #include <unordered_map>
 #include "pfcwdorch.h"
 #include "sai_serialize.h"
@@ -27,6 +28,8 @@
 #define PFC_WD_TC_MAX 8
 #define COUNTER_CHECK_POLL_TIMEOUT_SEC  1
 
+#define PFC_WD_POLL_STATS_TABLE         "PFC_WD_POLL_STATS"
+
 extern sai_object_id_t gSwitchId;
 extern sai_switch_api_t* sai_switch_api;
 extern sai_port_api_t *sai_port_api;
@@ -698,7 +701,9 @@ PfcWdSwOrch<DropHandler, ForwardHandler>::PfcWdSwOrch(
     c_queueAttrIds(queueAttrIds),
     m_pollInterval(pollInterval),
     m_applDb(make_shared<DBConnector>("APPL_DB", 0)),
-    m_applTable(make_shared<Table>(m_applDb.get(), APP_PFC_WD_TABLE_NAME "_INSTORM"))
+    m_applTable(make_shared<Table>(m_applDb.get(), APP_PFC_WD_TABLE_NAME "_INSTORM")),
+    m_countersPipe(make_shared<RedisPipeline>(this->getCountersDb().get())),
+    m_pollStatsTable(make_shared<Table>(m_countersPipe.get(), PFC_WD_POLL_STATS_TABLE, true))
 {
     SWSS_LOG_ENTER();
 
@@ -925,14 +930,31 @@ void PfcWdSwOrch<DropHandler, ForwardHandler>::doTask(SelectableTimer &timer)
 {
     SWSS_LOG_ENTER();
 
+    auto start = chrono::steady_clock::now();
+    uint32_t committedQueues = 0;
+
     for (auto& handlerPair : m_entryMap)
     {
-        if (handlerPair.second.handler != nullptr)
+        if (handlerPair.second.handler != nullptr &&
+            handlerPair.second.handler->commitCountersDelta(*m_countersPipe))
         {
-            handlerPair.second.handler->commitCounters(true);
+            committedQueues++;
         }
     }
 
+    m_countersPipe->flush();
+
+    uint64_t pollUsec = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+    m_pollCount++;
+    m_pollMaxUsec = max(m_pollMaxUsec, pollUsec);
+
+    vector<FieldValueTuple> fieldValues;
+    fieldValues.emplace_back("PFC_WD_POLL_COUNT", to_string(m_pollCount));
+    fieldValues.emplace_back("PFC_WD_POLL_LAST_USEC", to_string(pollUsec));
+    fieldValues.emplace_back("PFC_WD_POLL_MAX_USEC", to_string(m_pollMaxUsec));
+    fieldValues.emplace_back("PFC_WD_POLL_COMMITTED_QUEUES", to_string(committedQueues));
+    m_pollStatsTable->set(PFC_WD_GLOBAL, fieldValues);
+    m_countersPipe->flush();
 }
 
 template <typename DropHandler, typename ForwardHandler>
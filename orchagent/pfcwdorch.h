@@ -140,6 +140,12 @@ private:
     shared_ptr<DBConnector> m_applDb = nullptr;
     // Track queues in storm
     shared_ptr<Table> m_applTable = nullptr;
+
+    // Periodic queue counters are committed through one pipeline flush per poll
+    shared_ptr<RedisPipeline> m_countersPipe = nullptr;
+    shared_ptr<Table> m_pollStatsTable = nullptr;
+    uint64_t m_pollCount = 0;
+    uint64_t m_pollMaxUsec = 0;
 };
 
 #endif
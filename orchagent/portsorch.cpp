@@ -56,6 +56,7 @@ extern int32_t gVoqMySwitchId;
 extern string gMyHostName;
 extern string gMyAsicName;
 extern event_handle_t g_events_handle;
+extern bool gNativeCounterRates;
 
 #define DEFAULT_SYSTEM_PORT_MTU 9100
 #define VLAN_PREFIX         "Vlan"
@@ -417,9 +418,6 @@ PortsOrch::PortsOrch(DBConnector *db, DBConnector *stateDb, vector<table_name_wi
         string pgLuaScript = swss::loadLuaScript(pgWmPluginName);
         pgWmSha = swss::loadRedisScript(m_counter_db.get(), pgLuaScript);
 
-        string portRateLuaScript = swss::loadLuaScript(portRatePluginName);
-        string portRateSha = swss::loadRedisScript(m_counter_db.get(), portRateLuaScript);
-
         vector<FieldValueTuple> fieldValues;
         fieldValues.emplace_back(QUEUE_PLUGIN_FIELD, queueWmSha);
         fieldValues.emplace_back(POLL_INTERVAL_FIELD, QUEUE_WATERMARK_FLEX_STAT_COUNTER_POLL_MSECS);
@@ -432,11 +430,18 @@ PortsOrch::PortsOrch(DBConnector *db, DBConnector *stateDb, vector<table_name_wi
         fieldValues.emplace_back(STATS_MODE_FIELD, STATS_MODE_READ_AND_CLEAR);
         m_flexCounterGroupTable->set(PG_WATERMARK_STAT_COUNTER_FLEX_COUNTER_GROUP, fieldValues);
 
-        fieldValues.clear();
-        fieldValues.emplace_back(PORT_PLUGIN_FIELD, portRateSha);
-        fieldValues.emplace_back(POLL_INTERVAL_FIELD, PORT_RATE_FLEX_COUNTER_POLLING_INTERVAL_MS);
-        fieldValues.emplace_back(STATS_MODE_FIELD, STATS_MODE_READ);
-        m_flexCounterGroupTable->set(PORT_STAT_COUNTER_FLEX_COUNTER_GROUP, fieldValues);
+        /* Port rates are computed by CounterRateOrch in native mode */
+        if (!gNativeCounterRates)
+        {
+            string portRateLuaScript = swss::loadLuaScript(portRatePluginName);
+            string portRateSha = swss::loadRedisScript(m_counter_db.get(), portRateLuaScript);
+
+            fieldValues.clear();
+            fieldValues.emplace_back(PORT_PLUGIN_FIELD, portRateSha);
+            fieldValues.emplace_back(POLL_INTERVAL_FIELD, PORT_RATE_FLEX_COUNTER_POLLING_INTERVAL_MS);
+            fieldValues.emplace_back(STATS_MODE_FIELD, STATS_MODE_READ);
+            m_flexCounterGroupTable->set(PORT_STAT_COUNTER_FLEX_COUNTER_GROUP, fieldValues);
+        }
 
         fieldValues.clear();
         fieldValues.emplace_back(POLL_INTERVAL_FIELD, PG_DROP_FLEX_STAT_COUNTER_POLL_MSECS);
@@ -5212,20 +5217,63 @@ bool PortsOrch::addVlanMember(Port &vlan, Port &port, string &tagging_mode, stri
         return addVlanFloodGroups(vlan, port, end_point_ip);
     }
 
-    sai_attribute_t attr;
+    sai_vlan_tagging_mode_t sai_tagging_mode = getVlanTaggingMode(tagging_mode);
     vector<sai_attribute_t> attrs;
+    getVlanMemberAttrs(vlan, port, sai_tagging_mode, attrs);
 
-    attr.id = SAI_VLAN_MEMBER_ATTR_VLAN_ID;
-    attr.value.oid = vlan.m_vlan_info.vlan_oid;
-    attrs.push_back(attr);
+    sai_object_id_t vlan_member_id;
+    sai_status_t status = sai_vlan_api->create_vlan_member(&vlan_member_id, gSwitchId, (uint32_t)attrs.size(), attrs.data());
+    if (status != SAI_STATUS_SUCCESS)
+    {
+        SWSS_LOG_ERROR("Failed to add member %s to VLAN %s vid:%hu pid:%" PRIx64,
+                port.m_alias.c_str(), vlan.m_alias.c_str(), vlan.m_vlan_info.vlan_id, port.m_port_id);
+        task_process_status handle_status = handleSaiCreateStatus(SAI_API_VLAN, status);
+        if (handle_status != task_success)
+        {
+            return parseHandleSaiStatusFailure(handle_status);
+        }
+    }
 
-    attr.id = SAI_VLAN_MEMBER_ATTR_BRIDGE_PORT_ID;
-    attr.value.oid = port.m_bridge_port_id;
-    attrs.push_back(attr);
+    return addVlanMemberEntry(vlan, port, sai_tagging_mode, vlan_member_id);
+}
 
+void PortsOrch::addVlanMemberBulk(ObjectBulker<sai_vlan_api_t> &bulker, const Port &vlan, const Port &port,
+                                  const string &tagging_mode, sai_object_id_t *vlan_member_id)
+{
+    SWSS_LOG_ENTER();
 
+    vector<sai_attribute_t> attrs;
+    getVlanMemberAttrs(vlan, port, getVlanTaggingMode(tagging_mode), attrs);
+
+    bulker.create_entry(vlan_member_id, (uint32_t)attrs.size(), attrs.data());
+}
+
+bool PortsOrch::addVlanMemberPost(const string &vlan_alias, const string &port_alias, string &tagging_mode,
+                                  sai_object_id_t vlan_member_id)
+{
+    SWSS_LOG_ENTER();
+
+    /* Other members of the bulk may have changed the VLAN since it was queued */
+    Port vlan, port;
+    if (!getPort(vlan_alias, vlan) || !getPort(port_alias, port))
+    {
+        SWSS_LOG_ERROR("Failed to locate VLAN %s or port %s of the new VLAN member",
+                vlan_alias.c_str(), port_alias.c_str());
+        return false;
+    }
+
+    if (vlan_member_id == SAI_NULL_OBJECT_ID)
+    {
+        /* The bulk does not tell why a member failed, add it alone to handle the status */
+        return addVlanMember(vlan, port, tagging_mode);
+    }
+
+    return addVlanMemberEntry(vlan, port, getVlanTaggingMode(tagging_mode), vlan_member_id);
+}
+
+sai_vlan_tagging_mode_t PortsOrch::getVlanTaggingMode(const string &tagging_mode)
+{
     sai_vlan_tagging_mode_t sai_tagging_mode = SAI_VLAN_TAGGING_MODE_TAGGED;
-    attr.id = SAI_VLAN_MEMBER_ATTR_VLAN_TAGGING_MODE;
     if (tagging_mode == "untagged")
         sai_tagging_mode = SAI_VLAN_TAGGING_MODE_UNTAGGED;
     else if (tagging_mode == "tagged")
@@ -5233,21 +5281,31 @@ bool PortsOrch::addVlanMember(Port &vlan, Port &port, string &tagging_mode, stri
     else if (tagging_mode == "priority_tagged")
         sai_tagging_mode = SAI_VLAN_TAGGING_MODE_PRIORITY_TAGGED;
     else assert(false);
+
+    return sai_tagging_mode;
+}
+
+void PortsOrch::getVlanMemberAttrs(const Port &vlan, const Port &port, sai_vlan_tagging_mode_t sai_tagging_mode,
+                                   vector<sai_attribute_t> &attrs)
+{
+    sai_attribute_t attr;
+
+    attr.id = SAI_VLAN_MEMBER_ATTR_VLAN_ID;
+    attr.value.oid = vlan.m_vlan_info.vlan_oid;
+    attrs.push_back(attr);
+
+    attr.id = SAI_VLAN_MEMBER_ATTR_BRIDGE_PORT_ID;
+    attr.value.oid = port.m_bridge_port_id;
+    attrs.push_back(attr);
+
+    attr.id = SAI_VLAN_MEMBER_ATTR_VLAN_TAGGING_MODE;
     attr.value.s32 = sai_tagging_mode;
     attrs.push_back(attr);
+}
 
-    sai_object_id_t vlan_member_id;
-    sai_status_t status = sai_vlan_api->create_vlan_member(&vlan_member_id, gSwitchId, (uint32_t)attrs.size(), attrs.data());
-    if (status != SAI_STATUS_SUCCESS)
-    {
-        SWSS_LOG_ERROR("Failed to add member %s to VLAN %s vid:%hu pid:%" PRIx64,
-                port.m_alias.c_str(), vlan.m_alias.c_str(), vlan.m_vlan_info.vlan_id, port.m_port_id);
-        task_process_status handle_status = handleSaiCreateStatus(SAI_API_VLAN, status);
-        if (handle_status != task_success)
-        {
-            return parseHandleSaiStatusFailure(handle_status);
-        }
-    }
+bool PortsOrch::addVlanMemberEntry(Port &vlan, Port &port, sai_vlan_tagging_mode_t sai_tagging_mode,
+                                   sai_object_id_t vlan_member_id)
+{
     SWSS_LOG_NOTICE("Add member %s to VLAN %s vid:%hu pid%" PRIx64,
             port.m_alias.c_str(), vlan.m_alias.c_str(), vlan.m_vlan_info.vlan_id, port.m_port_id);
 
@@ -6182,6 +6240,7 @@ void PortsOrch::generateQueueMapPerPort(const Port& port, FlexCounterQueueStates
     m_queuePortTable->set("", queuePortVector);
     m_queueIndexTable->set("", queueIndexVector);
     m_queueTypeTable->set("", queueTypeVector);
+    m_queueTypeMapVersion++;
 
     CounterCheckOrch::getInstance().addPort(port);
 }
@@ -6357,6 +6416,7 @@ void PortsOrch::createPortBufferQueueCounters(const Port &port, string queues)
     m_queuePortTable->set("", queuePortVector);
     m_queueIndexTable->set("", queueIndexVector);
     m_queueTypeTable->set("", queueTypeVector);
+    m_queueTypeMapVersion++;
 
     CounterCheckOrch::getInstance().addPort(port);
 }
@@ -6390,6 +6450,7 @@ void PortsOrch::removePortBufferQueueCounters(const Port &port, string queues)
         if (getQueueTypeAndIndex(port.m_queue_ids[queueIndex], queueType, queueRealIndex))
         {
             m_queueTypeTable->hdel("", id);
+            m_queueTypeMapVersion++;
             m_queueIndexTable->hdel("", id);
         }
 
@@ -6462,6 +6523,7 @@ void PortsOrch::generatePriorityGroupMapPerPort(const Port& port, FlexCounterPgS
     m_pgTable->set("", pgVector);
     m_pgPortTable->set("", pgPortVector);
     m_pgIndexTable->set("", pgIndexVector);
+    m_pgIndexMapVersion++;
 
     CounterCheckOrch::getInstance().addPort(port);
 }
@@ -6511,6 +6573,7 @@ void PortsOrch::createPortBufferPgCounters(const Port& port, string pgs)
     m_pgTable->set("", pgVector);
     m_pgPortTable->set("", pgPortVector);
     m_pgIndexTable->set("", pgIndexVector);
+    m_pgIndexMapVersion++;
 
     CounterCheckOrch::getInstance().addPort(port);
 }
@@ -6654,6 +6717,7 @@ void PortsOrch::removePortBufferPgCounters(const Port& port, string pgs)
         m_pgTable->hdel("", name.str());
         m_pgPortTable->hdel("", id);
         m_pgIndexTable->hdel("", id);
+        m_pgIndexMapVersion++;
 
         auto flexCounterOrch = gDirectory.get<FlexCounterOrch*>();
         if (flexCounterOrch->getPgCountersState())
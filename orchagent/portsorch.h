@@ -15,6 +15,7 @@
 #include "lagid.h"
 #include "flexcounterorch.h"
 #include "events.h"
+#include "bulker.h"
 
 
 #define FCS_LEN 4
@@ -171,6 +172,10 @@ public:
     void generatePortCounterMap();
     void generatePortBufferDropCounterMap();
 
+    /* Incremented whenever COUNTERS_QUEUE_TYPE_MAP or COUNTERS_PG_INDEX_MAP is updated */
+    uint64_t getQueueTypeMapVersion() const { return m_queueTypeMapVersion; }
+    uint64_t getPgIndexMapVersion() const { return m_pgIndexMapVersion; }
+
     void refreshPortStatus();
     bool removeAclTableGroup(const Port &p);
 
@@ -185,6 +190,10 @@ public:
     bool addBridgePort(Port &port);
     bool removeBridgePort(Port &port);
     bool addVlanMember(Port &vlan, Port &port, string& tagging_mode, string end_point_ip = "");
+    void addVlanMemberBulk(ObjectBulker<sai_vlan_api_t> &bulker, const Port &vlan, const Port &port,
+                           const string &tagging_mode, sai_object_id_t *vlan_member_id);
+    bool addVlanMemberPost(const string &vlan_alias, const string &port_alias, string &tagging_mode,
+                           sai_object_id_t vlan_member_id);
     bool removeVlanMember(Port &vlan, Port &port, string end_point_ip = "");
     bool isVlanMember(Port &vlan, Port &port, string end_point_ip = "");
     bool addVlanFloodGroups(Port &vlan, Port &port, string end_point_ip);
@@ -359,6 +368,11 @@ private:
     bool setPortMtu(const Port& port, sai_uint32_t mtu);
     bool setPortTpid(sai_object_id_t id, sai_uint16_t tpid);
     bool setPortPvid (Port &port, sai_uint32_t pvid);
+    sai_vlan_tagging_mode_t getVlanTaggingMode(const string &tagging_mode);
+    void getVlanMemberAttrs(const Port &vlan, const Port &port, sai_vlan_tagging_mode_t sai_tagging_mode,
+                            vector<sai_attribute_t> &attrs);
+    bool addVlanMemberEntry(Port &vlan, Port &port, sai_vlan_tagging_mode_t sai_tagging_mode,
+                            sai_object_id_t vlan_member_id);
     bool getPortPvid(Port &port, sai_uint32_t &pvid);
     bool setPortFec(Port &port, std::string &mode);
     bool setPortPfcAsym(Port &port, string pfc_asym);
@@ -384,6 +398,7 @@ private:
     bool getQueueTypeAndIndex(sai_object_id_t queue_id, string &type, uint8_t &index);
 
     bool m_isQueueMapGenerated = false;
+    uint64_t m_queueTypeMapVersion = 0;
     void generateQueueMapPerPort(const Port& port, FlexCounterQueueStates& queuesState, bool voq);
     bool m_isQueueFlexCountersAdded = false;
     void addQueueFlexCountersPerPort(const Port& port, FlexCounterQueueStates& queuesState);
@@ -394,6 +409,7 @@ private:
     void addQueueWatermarkFlexCountersPerPortPerQueueIndex(const Port& port, size_t queueIndex);
 
     bool m_isPriorityGroupMapGenerated = false;
+    uint64_t m_pgIndexMapVersion = 0;
     void generatePriorityGroupMapPerPort(const Port& port, FlexCounterPgStates& pgsState);
     bool m_isPriorityGroupFlexCountersAdded = false;
     void addPriorityGroupFlexCountersPerPort(const Port& port, FlexCounterPgStates& pgsState);
@@ -1,5 +1,9 @@
 #include <net/ethernet.h>
+#include <arpa/inet.h>
 #include <cassert>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -15,6 +19,111 @@
 using namespace std;
 using namespace swss;
 
+enum class UintParseResult
+{
+    OK,
+    INVALID,
+    OUT_OF_RANGE
+};
+
+/*
+ * Same rules as std::stoul(): leading spaces and a sign are accepted and the
+ * parsing stops at the first character which is not a digit.
+ */
+static UintParseResult parseUnsigned(const char *str, size_t len, uint64_t& value)
+{
+    size_t i = 0;
+    while (i < len && isspace(static_cast<unsigned char>(str[i])))
+    {
+        i++;
+    }
+
+    bool negative = false;
+    if (i < len && (str[i] == '+' || str[i] == '-'))
+    {
+        negative = str[i] == '-';
+        i++;
+    }
+
+    if (i == len || !isdigit(static_cast<unsigned char>(str[i])))
+    {
+        return UintParseResult::INVALID;
+    }
+
+    value = 0;
+    for (; i < len && isdigit(static_cast<unsigned char>(str[i])); i++)
+    {
+        uint64_t digit = static_cast<uint64_t>(str[i] - '0');
+        if (value > (UINT64_MAX - digit) / 10)
+        {
+            return UintParseResult::OUT_OF_RANGE;
+        }
+        value = value * 10 + digit;
+    }
+
+    if (negative)
+    {
+        value = 0 - value;
+    }
+
+    return UintParseResult::OK;
+}
+
+/* Call func(item, len) for the items of a comma separated list, like getline() does */
+template <typename F>
+static void forEachListItem(const char *str, size_t len, F func)
+{
+    size_t start = 0;
+    while (start < len)
+    {
+        const auto comma = static_cast<const char *>(memchr(str + start, ',', len - start));
+        size_t end = comma ? static_cast<size_t>(comma - str) : len;
+        func(str + start, end - start);
+        start = end + 1;
+    }
+}
+
+static int parseHexDigit(char c)
+{
+    if (c >= '0' && c <= '9')
+    {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f')
+    {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F')
+    {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+void Request::initItems()
+{
+    key_items_.resize(number_of_key_items_);
+    for (size_t i = 0; i < number_of_key_items_; i++)
+    {
+        key_items_[i].type = request_description_.key_item_types[i];
+    }
+
+    size_t index = 0;
+    attr_items_.resize(request_description_.attr_item_types.size());
+    for (const auto& attr : request_description_.attr_item_types)
+    {
+        attr_items_[index].type = attr.second;
+        attr_items_[index].name = &attr.first;
+        attr_item_index_[attr.first] = index++;
+    }
+
+    // a mandatory attribute which is not described can never be found
+    for (const auto& attr : request_description_.mandatory_attr_items)
+    {
+        const auto item = attr_item_index_.find(attr);
+        mandatory_attr_items_.push_back(item == std::end(attr_item_index_) ? attr_items_.size() : item->second);
+    }
+}
 
 void Request::parse(const KeyOpFieldsValuesTuple& request)
 {
@@ -34,17 +143,69 @@ void Request::clear()
 {
     operation_.clear();
     full_key_.clear();
-    attr_names_.clear();
-    key_item_strings_.clear();
-    key_item_mac_addresses_.clear();
-    attr_item_strings_.clear();
-    attr_item_bools_.clear();
-    attr_item_mac_addresses_.clear();
-    attr_item_packet_actions_.clear();
+    for (auto& item : key_items_)
+    {
+        item.is_set = false;
+    }
+    for (auto& item : attr_items_)
+    {
+        item.is_set = false;
+    }
+    number_of_attrs_ = 0;
+    attr_names_valid_ = false;
 
     is_parsed_ = false;
 }
 
+const std::unordered_set<std::string>& Request::getAttrFieldNames() const
+{
+    assert(is_parsed_);
+
+    if (!attr_names_valid_)
+    {
+        attr_names_.clear();
+        for (const auto& item : attr_items_)
+        {
+            if (item.is_set)
+            {
+                attr_names_.insert(*item.name);
+            }
+        }
+        attr_names_valid_ = true;
+    }
+
+    return attr_names_;
+}
+
+const RequestItem& Request::getKeyItem(int position, request_types_t type) const
+{
+    if (position < 0 || static_cast<size_t>(position) >= key_items_.size())
+    {
+        throw std::out_of_range(std::string("Key item ") + std::to_string(position) + std::string(" not found"));
+    }
+
+    const auto& item = key_items_[static_cast<size_t>(position)];
+    if (!item.is_set || item.type != type)
+    {
+        throw std::out_of_range(std::string("Key item ") + std::to_string(position) + std::string(" not found"));
+    }
+
+    return item;
+}
+
+const RequestItem& Request::getAttrItem(const std::string& attr_name, request_types_t type) const
+{
+    const auto index = attr_item_index_.find(attr_name);
+    if (index == std::end(attr_item_index_)
+        || !attr_items_[index->second].is_set
+        || attr_items_[index->second].type != type)
+    {
+        throw std::out_of_range(std::string("Attribute '") + attr_name + std::string("' not found"));
+    }
+
+    return attr_items_[index->second];
+}
+
 void Request::parseOperation(const KeyOpFieldsValuesTuple& request)
 {
     operation_ = kfvOp(request);
@@ -58,17 +219,17 @@ void Request::parseKey(const KeyOpFieldsValuesTuple& request)
 {
     full_key_ = kfvKey(request);
 
-    // split the key by separator
-    std::vector<std::string> key_items;
+    // split the key by separator, the key items are parsed in place
+    key_item_ranges_.clear();
     size_t key_item_start = 0;
     size_t key_item_end = full_key_.find(key_separator_);
     while (key_item_end != std::string::npos)
     {
-        key_items.push_back(full_key_.substr(key_item_start, key_item_end - key_item_start));
+        key_item_ranges_.emplace_back(key_item_start, key_item_end - key_item_start);
         key_item_start = key_item_end + 1;
         key_item_end = full_key_.find(key_separator_, key_item_start);
     }
-    key_items.push_back(full_key_.substr(key_item_start, full_key_.length()));
+    key_item_ranges_.emplace_back(key_item_start, full_key_.length() - key_item_start);
 
     /*
      * Attempt to parse an IPv6 address only if the following conditions are met:
@@ -83,25 +244,17 @@ void Request::parseKey(const KeyOpFieldsValuesTuple& request)
      * - The last key item is an IP address or prefix
      *     - This runs under the assumption that an IPv6 address, if present, will always be the last key item
      */
-    if (key_separator_ == ':' and 
-        key_items.size() > number_of_key_items_ and 
+    if (key_separator_ == ':' and
+        number_of_key_items_ > 0 and
+        key_item_ranges_.size() > number_of_key_items_ and
         (request_description_.key_item_types.back() == REQ_T_IP or request_description_.key_item_types.back() == REQ_T_IP_PREFIX))
     {
-        // Remove key_items so that key_items.size() is correct, then assemble the removed items into an IPv6 address
-        std::vector<std::string> ip_addr_groups(--key_items.begin() + number_of_key_items_, key_items.end());
-        key_items.erase(--key_items.begin() + number_of_key_items_, key_items.end());
-
-        std::string ip_string;
-
-        for (const auto &i : ip_addr_groups)
-        {
-            ip_string += i + ":";
-        }
-        ip_string.pop_back(); // remove extra ":" from end of string
-
-        key_items.push_back(ip_string);
+        // The IPv6 address is the rest of the key, from the start of the last expected key item
+        auto& ip_range = key_item_ranges_[number_of_key_items_ - 1];
+        ip_range.second = full_key_.length() - ip_range.first;
+        key_item_ranges_.resize(number_of_key_items_);
     }
-    if (key_items.size() != number_of_key_items_)
+    if (key_item_ranges_.size() != number_of_key_items_)
     {
         throw std::invalid_argument(std::string("Wrong number of key items. Expected ")
                                   + std::to_string(number_of_key_items_)
@@ -111,238 +264,273 @@ void Request::parseKey(const KeyOpFieldsValuesTuple& request)
     }
 
     // check types of the key items
-    for (int i = 0; i < static_cast<int>(number_of_key_items_); i++)
+    for (size_t i = 0; i < number_of_key_items_; i++)
     {
-        switch(request_description_.key_item_types[i])
+        const auto& range = key_item_ranges_[i];
+        switch(key_items_[i].type)
         {
             case REQ_T_STRING:
-                key_item_strings_[i] = key_items[i];
-                break;
             case REQ_T_MAC_ADDRESS:
-                key_item_mac_addresses_[i] = parseMacAddress(key_items[i]);
-                break;
             case REQ_T_IP:
-                key_item_ip_addresses_[i] = parseIpAddress(key_items[i]);
-                break;
             case REQ_T_IP_PREFIX:
-                key_item_ip_prefix_[i] = parseIpPrefix(key_items[i]);
-                break;
             case REQ_T_UINT:
-                key_item_uint_[i] = parseUint(key_items[i]);
+                parseItem(key_items_[i], full_key_.data() + range.first, range.second);
                 break;
             default:
                 throw std::logic_error(std::string("Not implemented key type parser. Key '")
                                      + full_key_
                                      + std::string("'. Key item:")
-                                     + key_items[i]);
+                                     + full_key_.substr(range.first, range.second));
         }
     }
 }
 
 void Request::parseAttrs(const KeyOpFieldsValuesTuple& request)
 {
-    const auto not_found = std::end(request_description_.attr_item_types);
+    const auto not_found = std::end(attr_item_index_);
 
-    for (auto i = kfvFieldsValues(request).begin();
-         i != kfvFieldsValues(request).end(); i++)
+    for (const auto& fv : kfvFieldsValues(request))
     {
-        if (fvField(*i) == "empty" || fvField(*i) == "NULL")
+        const auto& field = fvField(fv);
+        if (field == "empty" || field == "NULL")
         {
             // if name of the attribute is 'empty' or 'NULL', just skip it.
             // it's used when we don't have any attributes, but we have to provide one for redis
             continue;
         }
-        const auto item = request_description_.attr_item_types.find(fvField(*i));
-        if (item == not_found)
+        const auto index = attr_item_index_.find(field);
+        if (index == not_found)
         {
-            throw std::invalid_argument(std::string("Unknown attribute name: ") + fvField(*i));
+            throw std::invalid_argument(std::string("Unknown attribute name: ") + field);
         }
-        attr_names_.insert(fvField(*i));
-        switch(item->second)
+
+        auto& item = attr_items_[index->second];
+        if (!item.is_set)
         {
-            case REQ_T_STRING:
-                attr_item_strings_[fvField(*i)] = fvValue(*i);
-                break;
-            case REQ_T_BOOL:
-                attr_item_bools_[fvField(*i)] = parseBool(fvValue(*i));
-                break;
-            case REQ_T_MAC_ADDRESS:
-                attr_item_mac_addresses_[fvField(*i)] = parseMacAddress(fvValue(*i));
-                break;
-            case REQ_T_PACKET_ACTION:
-                attr_item_packet_actions_[fvField(*i)] = parsePacketAction(fvValue(*i));
-                break;
-            case REQ_T_VLAN:
-                attr_item_vlan_[fvField(*i)] = parseVlan(fvValue(*i));
-                break;
-            case REQ_T_IP:
-                attr_item_ip_[fvField(*i)] = parseIpAddress(fvValue(*i));
-                break;
-            case REQ_T_IP_PREFIX:
-                attr_item_ip_prefix_[fvField(*i)] = parseIpPrefix(fvValue(*i));
-                break;
-            case REQ_T_UINT:
-                attr_item_uint_[fvField(*i)] = parseUint(fvValue(*i));
-                break;
-            case REQ_T_SET:
-                attr_item_set_[fvField(*i)] = parseSet(fvValue(*i));
-                break;
-            case REQ_T_MAC_ADDRESS_LIST:
-                attr_item_mac_addresses_list_[fvField(*i)] = parseMacAddressList(fvValue(*i));
-                break;
-            case REQ_T_IP_LIST:
-                attr_item_ip_list_[fvField(*i)] = parseIpAddressList(fvValue(*i));
-                break;
-            case REQ_T_UINT_LIST:
-                attr_item_uint_list_[fvField(*i)] = parseUintList(fvValue(*i));
-                break;
-            default:
-                throw std::logic_error(std::string("Not implemented attribute type parser for attribute:") + fvField(*i));
+            number_of_attrs_++;
         }
+        parseItem(item, fvValue(fv).data(), fvValue(fv).size());
     }
 
-    if (operation_ == DEL_COMMAND && attr_names_.size() > 0)
+    if (operation_ == DEL_COMMAND && number_of_attrs_ > 0)
     {
         throw std::invalid_argument("Delete operation request contains attributes");
     }
 
     if (operation_ == SET_COMMAND)
     {
-        for (const auto& attr: request_description_.mandatory_attr_items)
+        for (size_t i = 0; i < mandatory_attr_items_.size(); i++)
         {
-            if (attr_names_.find(attr) == std::end(attr_names_))
+            const auto index = mandatory_attr_items_[i];
+            if (index == attr_items_.size() || !attr_items_[index].is_set)
             {
-                throw std::invalid_argument(std::string("Mandatory attribute '") + attr + std::string("' not found"));
+                throw std::invalid_argument(std::string("Mandatory attribute '")
+                                          + request_description_.mandatory_attr_items[i]
+                                          + std::string("' not found"));
             }
         }
     }
 }
 
-bool Request::parseBool(const std::string& str)
+void Request::parseItem(RequestItem& item, const char *str, size_t len)
 {
-    if (str == "true")
+    switch(item.type)
+    {
+        case REQ_T_STRING:
+            item.str.assign(str, len);
+            break;
+        case REQ_T_BOOL:
+            item.boolean = parseBool(str, len);
+            break;
+        case REQ_T_MAC_ADDRESS:
+            item.mac = parseMacAddress(str, len);
+            break;
+        case REQ_T_PACKET_ACTION:
+            item.packet_action = parsePacketAction(str, len);
+            break;
+        case REQ_T_VLAN:
+            item.vlan = parseVlan(str, len);
+            break;
+        case REQ_T_IP:
+            item.ip = parseIpAddress(str, len);
+            break;
+        case REQ_T_IP_PREFIX:
+            item.ip_prefix = parseIpPrefix(str, len);
+            break;
+        case REQ_T_UINT:
+            item.uint = parseUint(str, len);
+            break;
+        case REQ_T_SET:
+            parseSet(str, len, item.set);
+            break;
+        case REQ_T_MAC_ADDRESS_LIST:
+            parseMacAddressList(str, len, item.mac_list);
+            break;
+        case REQ_T_IP_LIST:
+            parseIpAddressList(str, len, item.ip_list);
+            break;
+        case REQ_T_UINT_LIST:
+            parseUintList(str, len, item.uint_list);
+            break;
+        default:
+            throw std::logic_error(std::string("Not implemented attribute type parser for attribute:")
+                                 + (item.name ? *item.name : std::string()));
+    }
+
+    item.is_set = true;
+}
+
+bool Request::parseBool(const char *str, size_t len)
+{
+    if (len == 4 && memcmp(str, "true", len) == 0)
     {
         return true;
     }
 
-    if (str == "false")
+    if (len == 5 && memcmp(str, "false", len) == 0)
     {
         return false;
     }
 
-    throw std::invalid_argument(std::string("Can't parse boolean value '") + str + std::string("'"));
+    throw std::invalid_argument(std::string("Can't parse boolean value '") + std::string(str, len) + std::string("'"));
 }
 
-MacAddress Request::parseMacAddress(const std::string& str)
+MacAddress Request::parseMacAddress(const char *str, size_t len)
 {
     uint8_t mac[ETHER_ADDR_LEN];
 
-    if (!MacAddress::parseMacString(str, mac))
+    // xx:xx:xx:xx:xx:xx or xx-xx-xx-xx-xx-xx, as MacAddress::parseMacString()
+    bool valid = len == ETHER_ADDR_LEN * 3 - 1 && (str[2] == ':' || str[2] == '-');
+    for (size_t i = 0; valid && i < ETHER_ADDR_LEN; i++)
     {
-        throw std::invalid_argument(std::string("Invalid mac address: ") + str);
+        int high = parseHexDigit(str[i * 3]);
+        int low = parseHexDigit(str[i * 3 + 1]);
+        valid = high >= 0 && low >= 0 && (i == ETHER_ADDR_LEN - 1 || str[i * 3 + 2] == str[2]);
+        mac[i] = static_cast<uint8_t>((high << 4) | low);
     }
 
-    return MacAddress(mac);
-}
-
-IpAddress Request::parseIpAddress(const std::string& str)
-{
-    try
-    {
-        IpAddress addr(str);
-        return addr;
-    }
-    catch (std::invalid_argument& _)
+    if (!valid)
     {
-        throw std::invalid_argument(std::string("Invalid ip address: ") + str);
+        throw std::invalid_argument(std::string("Invalid mac address: ") + std::string(str, len));
     }
+
+    return MacAddress(mac);
 }
 
-IpPrefix Request::parseIpPrefix(const std::string& str)
+IpAddress Request::parseIpAddress(const char *str, size_t len)
 {
-    try
-    {
-        IpPrefix pfx(str);
-        return pfx;
-    }
-    catch (std::invalid_argument& _)
+    char buf[INET6_ADDRSTRLEN];
+    ip_addr_t ip;
+
+    if (len < sizeof(buf))
     {
-        throw std::invalid_argument(std::string("Invalid ip prefix: ") + str);
+        memcpy(buf, str, len);
+        buf[len] = '\0';
+
+        if (inet_pton(AF_INET, buf, &ip.ip_addr.ipv4_addr) == 1)
+        {
+            ip.family = AF_INET;
+            return IpAddress(ip);
+        }
+
+        if (inet_pton(AF_INET6, buf, ip.ip_addr.ipv6_addr) == 1)
+        {
+            ip.family = AF_INET6;
+            return IpAddress(ip);
+        }
     }
+
+    throw std::invalid_argument(std::string("Invalid ip address: ") + std::string(str, len));
 }
 
-set<string> Request::parseSet(const std::string& str)
+IpPrefix Request::parseIpPrefix(const char *str, size_t len)
 {
     try
     {
-        set<string> str_set;
-        string substr;
-        std::istringstream iss(str);
-        while (getline(iss, substr, ','))
+        const auto slash = static_cast<const char *>(memchr(str, '/', len));
+        if (slash == nullptr)
         {
-            str_set.insert(substr);
+            auto addr = parseIpAddress(str, len);
+            return IpPrefix(addr.getIp(), addr.isV4() ? 32 : 128);
         }
-        return str_set;
+
+        auto addr = parseIpAddress(str, static_cast<size_t>(slash - str));
+        uint64_t mask = 0;
+        size_t mask_len = len - static_cast<size_t>(slash - str) - 1;
+        if (parseUnsigned(slash + 1, mask_len, mask) != UintParseResult::OK
+            || mask > (addr.isV4() ? 32u : 128u))
+        {
+            throw std::invalid_argument("Invalid mask");
+        }
+
+        return IpPrefix(addr.getIp(), static_cast<int>(mask));
     }
     catch (std::invalid_argument& _)
     {
-        throw std::invalid_argument(std::string("Invalid string set"));
+        throw std::invalid_argument(std::string("Invalid ip prefix: ") + std::string(str, len));
     }
 }
 
-uint64_t Request::parseUint(const std::string& str)
+void Request::parseSet(const char *str, size_t len, set<string>& str_set)
 {
-    try
-    {
-        uint64_t ret = std::stoul(str);
-        return ret;
-    }
-    catch(std::invalid_argument& _)
-    {
-        throw std::invalid_argument(std::string("Invalid unsigned integer: ") + str);
-    }
-    catch(std::out_of_range& _)
+    str_set.clear();
+    forEachListItem(str, len, [&](const char *item, size_t item_len) {
+        str_set.emplace(item, item_len);
+    });
+}
+
+uint64_t Request::parseUint(const char *str, size_t len)
+{
+    uint64_t ret = 0;
+
+    switch (parseUnsigned(str, len, ret))
     {
-        throw std::invalid_argument(std::string("Out of range unsigned integer: ") + str);
+        case UintParseResult::INVALID:
+            throw std::invalid_argument(std::string("Invalid unsigned integer: ") + std::string(str, len));
+        case UintParseResult::OUT_OF_RANGE:
+            throw std::invalid_argument(std::string("Out of range unsigned integer: ") + std::string(str, len));
+        default:
+            return ret;
     }
 }
 
-uint16_t Request::parseVlan(const std::string& str)
+uint16_t Request::parseVlan(const char *str, size_t len)
 {
-    uint16_t ret = 0;
+    uint64_t ret = 0;
 
-    const auto vlan_prefix = std::string("Vlan");
-    const auto prefix_len = vlan_prefix.length();
+    static const char vlan_prefix[] = "Vlan";
+    const auto prefix_len = sizeof(vlan_prefix) - 1;
 
-    if (str.substr(0, prefix_len) != vlan_prefix)
+    if (len < prefix_len || memcmp(str, vlan_prefix, prefix_len) != 0)
     {
-        throw std::invalid_argument(std::string("Invalid vlan interface: ") + str);
+        throw std::invalid_argument(std::string("Invalid vlan interface: ") + std::string(str, len));
     }
 
-    try
-    {
-        ret = static_cast<uint16_t>(std::stoul(str.substr(prefix_len)));
-    }
-    catch(std::invalid_argument& _)
+    switch (parseUnsigned(str + prefix_len, len - prefix_len, ret))
     {
-        throw std::invalid_argument(std::string("Invalid vlan id: ") + str);
-    }
-    catch(std::out_of_range& _)
-    {
-        throw std::invalid_argument(std::string("Out of range vlan id: ") + str);
+        case UintParseResult::INVALID:
+            throw std::invalid_argument(std::string("Invalid vlan id: ") + std::string(str, len));
+        case UintParseResult::OUT_OF_RANGE:
+            throw std::invalid_argument(std::string("Out of range vlan id: ") + std::string(str, len));
+        default:
+            break;
     }
 
     if (ret == 0 || ret > 4094)
     {
-        throw std::invalid_argument(std::string("Out of range vlan id: ") + str);
+        throw std::invalid_argument(std::string("Out of range vlan id: ") + std::string(str, len));
     }
 
-    return ret;
+    return static_cast<uint16_t>(ret);
 }
 
-sai_packet_action_t Request::parsePacketAction(const std::string& str)
+sai_packet_action_t Request::parsePacketAction(const char *str, size_t len)
 {
-    std::unordered_map<std::string, sai_packet_action_t> m = {
+    static const struct
+    {
+        const char *name;
+        sai_packet_action_t action;
+    } packet_actions[] = {
         {"drop", SAI_PACKET_ACTION_DROP},
         {"forward", SAI_PACKET_ACTION_FORWARD},
         {"copy", SAI_PACKET_ACTION_COPY},
@@ -353,78 +541,60 @@ sai_packet_action_t Request::parsePacketAction(const std::string& str)
         {"transit", SAI_PACKET_ACTION_TRANSIT},
     };
 
-    const auto found = m.find(str);
-    if (found == std::end(m))
+    for (const auto& packet_action : packet_actions)
     {
-        throw std::invalid_argument(std::string("Wrong packet action attribute value '") + str + std::string("'"));
+        if (strlen(packet_action.name) == len && memcmp(packet_action.name, str, len) == 0)
+        {
+            return packet_action.action;
+        }
     }
 
-    return found->second;
+    throw std::invalid_argument(std::string("Wrong packet action attribute value '") + std::string(str, len) + std::string("'"));
 }
 
-vector<IpAddress> Request::parseIpAddressList(const std::string& str)
+void Request::parseIpAddressList(const char *str, size_t len, vector<IpAddress>& addrs)
 {
     try
     {
-        vector<IpAddress> addrs;
-        string substr;
-        std::istringstream iss(str);
-        while (getline(iss, substr, ','))
-        {
-            IpAddress addr(substr);
-            addrs.emplace_back(addr);
-        }
-        return addrs;
+        addrs.clear();
+        forEachListItem(str, len, [&](const char *item, size_t item_len) {
+            addrs.emplace_back(parseIpAddress(item, item_len));
+        });
     }
     catch (std::invalid_argument& _)
     {
-        throw std::invalid_argument(std::string("Invalid ip address list: ") + str);
+        throw std::invalid_argument(std::string("Invalid ip address list: ") + std::string(str, len));
     }
 }
 
-vector<MacAddress> Request::parseMacAddressList(const std::string& str)
+void Request::parseMacAddressList(const char *str, size_t len, vector<MacAddress>& addrs)
 {
     try
     {
-        vector<MacAddress> addrs;
-        string substr;
-        std::istringstream iss(str);
-        while (getline(iss, substr, ','))
-        {
-            uint8_t mac[ETHER_ADDR_LEN];
-            if (!MacAddress::parseMacString(substr, mac))
-            {
-                throw std::invalid_argument(std::string("Invalid mac address: ") + str);
-            }
-            addrs.emplace_back(MacAddress(mac));
-        }
-        return addrs;
+        addrs.clear();
+        forEachListItem(str, len, [&](const char *item, size_t item_len) {
+            addrs.emplace_back(parseMacAddress(item, item_len));
+        });
     }
     catch (std::invalid_argument& _)
     {
-        throw std::invalid_argument(std::string("Invalid mac address list: ") + str);
+        throw std::invalid_argument(std::string("Invalid mac address list: ") + std::string(str, len));
     }
 }
 
-vector<uint64_t> Request::parseUintList(const std::string& str)
+void Request::parseUintList(const char *str, size_t len, vector<uint64_t>& res)
 {
-    try
-    {
-        vector<uint64_t> res;
-        string substr;
-        std::istringstream iss(str);
-        while (getline(iss, substr, ','))
+    res.clear();
+    forEachListItem(str, len, [&](const char *item, size_t item_len) {
+        uint64_t value = 0;
+        switch (parseUnsigned(item, item_len, value))
         {
-            res.emplace_back(std::stoul(substr));
+            case UintParseResult::INVALID:
+                throw std::invalid_argument(std::string("Invalid unsigned integer list: ") + std::string(str, len));
+            case UintParseResult::OUT_OF_RANGE:
+                throw std::invalid_argument(std::string("Out of range unsigned integer: ") + std::string(str, len));
+            default:
+                res.push_back(value);
         }
-        return res;
-    }
-    catch (std::invalid_argument& _)
-    {
-        throw std::invalid_argument(std::string("Invalid unsigned integer list: ") + str);
-    }
-    catch(std::out_of_range& _)
-    {
-        throw std::invalid_argument(std::string("Out of range unsigned integer: ") + str);
-    }
+    });
 }
@@ -3,6 +3,7 @@
 
 #include "ipaddress.h"
 #include "ipprefix.h"
+#include "macaddress.h"
 #include <sstream>
 #include <set>
 #include <vector>
@@ -31,6 +32,31 @@ typedef struct _request_description
     std::vector<std::string> mandatory_attr_items;
 } request_description_t;
 
+/*
+ * Parsed key item or attribute. The items are allocated once per Request from
+ * its description and reused by every parse(), so a string or a list keeps its
+ * capacity from one request to the next.
+ */
+struct RequestItem
+{
+    request_types_t type = REQ_T_NOT_USED;
+    bool is_set = false;
+    const std::string *name = nullptr;
+
+    std::string str;
+    bool boolean = false;
+    swss::MacAddress mac;
+    sai_packet_action_t packet_action = SAI_PACKET_ACTION_DROP;
+    uint16_t vlan = 0;
+    swss::IpAddress ip;
+    swss::IpPrefix ip_prefix;
+    uint64_t uint = 0;
+    std::set<std::string> set;
+    std::vector<swss::IpAddress> ip_list;
+    std::vector<swss::MacAddress> mac_list;
+    std::vector<uint64_t> uint_list;
+};
+
 class Request
 {
 public:
@@ -52,91 +78,87 @@ public:
     const std::string& getKeyString(int position) const
     {
         assert(is_parsed_);
-        return key_item_strings_.at(position);
+        return getKeyItem(position, REQ_T_STRING).str;
     }
 
     const swss::MacAddress& getKeyMacAddress(int position) const
     {
         assert(is_parsed_);
-        return key_item_mac_addresses_.at(position);
+        return getKeyItem(position, REQ_T_MAC_ADDRESS).mac;
     }
 
     const swss::IpAddress& getKeyIpAddress(int position) const
     {
         assert(is_parsed_);
-        return key_item_ip_addresses_.at(position);
+        return getKeyItem(position, REQ_T_IP).ip;
     }
 
     const swss::IpPrefix& getKeyIpPrefix(int position) const
     {
         assert(is_parsed_);
-        return key_item_ip_prefix_.at(position);
+        return getKeyItem(position, REQ_T_IP_PREFIX).ip_prefix;
     }
 
     const uint64_t& getKeyUint(int position) const
     {
         assert(is_parsed_);
-        return key_item_uint_.at(position);
+        return getKeyItem(position, REQ_T_UINT).uint;
     }
 
-    const std::unordered_set<std::string>& getAttrFieldNames() const
-    {
-        assert(is_parsed_);
-        return attr_names_;
-    }
+    const std::unordered_set<std::string>& getAttrFieldNames() const;
 
     const std::string& getAttrString(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_strings_.at(attr_name);
+        return getAttrItem(attr_name, REQ_T_STRING).str;
     }
 
     bool getAttrBool(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_bools_.at(attr_name);
+        return getAttrItem(attr_name, REQ_T_BOOL).boolean;
     }
 
     const swss::MacAddress& getAttrMacAddress(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_mac_addresses_.at(attr_name);
+        return getAttrItem(attr_name, REQ_T_MAC_ADDRESS).mac;
     }
 
     sai_packet_action_t getAttrPacketAction(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_packet_actions_.at(attr_name);
+        return getAttrItem(attr_name, REQ_T_PACKET_ACTION).packet_action;
     }
 
     uint16_t getAttrVlan(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_vlan_.at(attr_name);
+        return getAttrItem(attr_name, REQ_T_VLAN).vlan;
     }
 
     swss::IpAddress getAttrIP(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_ip_.at(attr_name);
+        return getAttrItem(attr_name, REQ_T_IP).ip;
     }
 
     swss::IpPrefix getAttrIpPrefix(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_ip_prefix_.at(attr_name);
+        return getAttrItem(attr_name, REQ_T_IP_PREFIX).ip_prefix;
     }
 
     const uint64_t& getAttrUint(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_uint_.at(attr_name);
+        return getAttrItem(attr_name, REQ_T_UINT).uint;
     }
 
     const std::set<std::string>& getAttrSet(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_set_.at(attr_name);
+        return getAttrItem(attr_name, REQ_T_SET).set;
     }
 
     void setTableName(std::string& table_name)
@@ -153,19 +175,19 @@ public:
     const std::vector<swss::IpAddress>& getAttrIPList(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_ip_list_.at(attr_name);
+        return getAttrItem(attr_name, REQ_T_IP_LIST).ip_list;
     }
 
     const std::vector<swss::MacAddress>& getAttrMacAddressList(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_mac_addresses_list_.at(attr_name);
+        return getAttrItem(attr_name, REQ_T_MAC_ADDRESS_LIST).mac_list;
     }
 
     const std::vector<uint64_t>& getAttrUintList(const std::string& attr_name) const
     {
         assert(is_parsed_);
-        return attr_item_uint_list_.at(attr_name);
+        return getAttrItem(attr_name, REQ_T_UINT_LIST).uint_list;
     }
 
 protected:
@@ -175,25 +197,33 @@ protected:
           is_parsed_(false),
           number_of_key_items_(request_description.key_item_types.size())
     {
+        initItems();
     }
 
 
 private:
+    void initItems();
     void parseOperation(const swss::KeyOpFieldsValuesTuple& request);
     void parseKey(const swss::KeyOpFieldsValuesTuple& request);
     void parseAttrs(const swss::KeyOpFieldsValuesTuple& request);
-    bool parseBool(const std::string& str);
-    swss::MacAddress parseMacAddress(const std::string& str);
-    swss::IpAddress parseIpAddress(const std::string& str);
-    swss::IpPrefix parseIpPrefix(const std::string& str);
-    uint64_t parseUint(const std::string& str);
-    uint16_t parseVlan(const std::string& str);
-    std::set<std::string> parseSet(const std::string& str);
-    std::vector<swss::IpAddress> parseIpAddressList(const std::string& str);
-    std::vector<swss::MacAddress> parseMacAddressList(const std::string& str);
-    std::vector<uint64_t> parseUintList(const std::string& str);
-
-    sai_packet_action_t parsePacketAction(const std::string& str);
+    void parseItem(RequestItem& item, const char *str, size_t len);
+
+    /* Typed values are parsed in place from a part of the key or a field value */
+    bool parseBool(const char *str, size_t len);
+    swss::MacAddress parseMacAddress(const char *str, size_t len);
+    swss::IpAddress parseIpAddress(const char *str, size_t len);
+    swss::IpPrefix parseIpPrefix(const char *str, size_t len);
+    uint64_t parseUint(const char *str, size_t len);
+    uint16_t parseVlan(const char *str, size_t len);
+    void parseSet(const char *str, size_t len, std::set<std::string>& str_set);
+    void parseIpAddressList(const char *str, size_t len, std::vector<swss::IpAddress>& addrs);
+    void parseMacAddressList(const char *str, size_t len, std::vector<swss::MacAddress>& addrs);
+    void parseUintList(const char *str, size_t len, std::vector<uint64_t>& res);
+
+    sai_packet_action_t parsePacketAction(const char *str, size_t len);
+
+    const RequestItem& getKeyItem(int position, request_types_t type) const;
+    const RequestItem& getAttrItem(const std::string& attr_name, request_types_t type) const;
 
     const request_description_t& request_description_;
     char key_separator_;
@@ -203,25 +233,17 @@ private:
     std::string table_name_;
     std::string operation_;
     std::string full_key_;
-    std::unordered_map<int, std::string> key_item_strings_;
-    std::unordered_map<int, swss::MacAddress> key_item_mac_addresses_;
-    std::unordered_map<int, swss::IpAddress> key_item_ip_addresses_;
-    std::unordered_map<int, swss::IpPrefix> key_item_ip_prefix_;
-    std::unordered_map<int, uint64_t> key_item_uint_;
-    std::unordered_set<std::string> attr_names_;
-    // FIXME: Make one union with all the values, except string
-    std::unordered_map<std::string, std::string> attr_item_strings_;
-    std::unordered_map<std::string, bool> attr_item_bools_;
-    std::unordered_map<std::string, swss::MacAddress> attr_item_mac_addresses_;
-    std::unordered_map<std::string, sai_packet_action_t> attr_item_packet_actions_;
-    std::unordered_map<std::string, uint16_t> attr_item_vlan_;
-    std::unordered_map<std::string, swss::IpAddress> attr_item_ip_;
-    std::unordered_map<std::string, swss::IpPrefix> attr_item_ip_prefix_;
-    std::unordered_map<std::string, uint64_t> attr_item_uint_;
-    std::unordered_map<std::string, std::set<std::string>> attr_item_set_;
-    std::unordered_map<std::string, std::vector<swss::IpAddress>> attr_item_ip_list_;
-    std::unordered_map<std::string, std::vector<swss::MacAddress>> attr_item_mac_addresses_list_;
-    std::unordered_map<std::string, std::vector<uint64_t>> attr_item_uint_list_;
+    /* Offset and length of the key items in full_key_ */
+    std::vector<std::pair<size_t, size_t>> key_item_ranges_;
+    std::vector<RequestItem> key_items_;
+    /* One slot per attribute of the description, indexed by attr_item_index_ */
+    std::vector<RequestItem> attr_items_;
+    std::unordered_map<std::string, size_t> attr_item_index_;
+    std::vector<size_t> mandatory_attr_items_;
+    size_t number_of_attrs_ = 0;
+    /* Built on demand by getAttrFieldNames() */
+    mutable std::unordered_set<std::string> attr_names_;
+    mutable bool attr_names_valid_ = false;
 };
 
 #endif // __REQUEST_PARSER_H
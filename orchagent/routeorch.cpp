@@ -43,7 +43,8 @@ RouteOrch::RouteOrch(DBConnector *db, vector<table_name_with_pri_t> &tableNames,
         m_fgNhgOrch(fgNhgOrch),
         m_nextHopGroupCount(0),
         m_srv6Orch(srv6Orch),
-        m_resync(false)
+        m_resync(false),
+        m_resyncGeneration(0)
 {
     SWSS_LOG_ENTER();
 
@@ -273,20 +274,25 @@ void RouteOrch::attach(Observer *observer, const IpAddress& dstAddr, sai_object_
      * IP address */
     if (observerEntry == m_nextHopObservers.end())
     {
-        m_nextHopObservers.emplace(host, NextHopObserverEntry());
-        observerEntry = m_nextHopObservers.find(host);
+        observerEntry = m_nextHopObservers.emplace(host, NextHopObserverEntry()).first;
+        m_nextHopObserverIndex[vrf_id].insert(dstAddr, NextHopObserverTrie::maxLength(dstAddr), observerEntry);
 
-        /* Find the prefixes that cover the destination IP */
-        if (m_syncdRoutes.find(vrf_id) != m_syncdRoutes.end())
+        /* Find the prefixes that cover the destination IP, looking up the
+         * subnet of every prefix length instead of scanning the route table */
+        auto it_route_table = m_syncdRoutes.find(vrf_id);
+        if (it_route_table != m_syncdRoutes.end())
         {
-            for (auto route : m_syncdRoutes.at(vrf_id))
+            int max_len = NextHopObserverTrie::maxLength(dstAddr);
+            for (int len = 0; len <= max_len; len++)
             {
-                if (route.first.isAddressInSubnet(dstAddr))
+                IpPrefix subnet = IpPrefix(dstAddr.to_string() + "/" + to_string(len)).getSubnet();
+                auto route = it_route_table->second.find(subnet);
+                if (route != it_route_table->second.end())
                 {
                     SWSS_LOG_INFO("Prefix %s covers destination address",
-                            route.first.to_string().c_str());
+                            route->first.to_string().c_str());
                     observerEntry->second.routeTable.emplace(
-                            route.first, route.second);
+                            route->first, route->second);
                 }
             }
         }
@@ -336,6 +342,15 @@ void RouteOrch::detach(Observer *observer, const IpAddress& dstAddr, sai_object_
             // destination IP.
             if (observerEntry->second.observers.empty())
             {
+                auto index = m_nextHopObserverIndex.find(vrf_id);
+                if (index != m_nextHopObserverIndex.end())
+                {
+                    index->second.erase(dstAddr, NextHopObserverTrie::maxLength(dstAddr));
+                    if (index->second.empty())
+                    {
+                        m_nextHopObserverIndex.erase(index);
+                    }
+                }
                 m_nextHopObservers.erase(observerEntry);
             }
             break;
@@ -345,118 +360,209 @@ void RouteOrch::detach(Observer *observer, const IpAddress& dstAddr, sai_object_
 
 bool RouteOrch::validnexthopinNextHopGroup(const NextHopKey &nexthop, uint32_t& count)
 {
-    SWSS_LOG_ENTER();
+    vector<uint32_t> counts;
+    bool rc = validnexthopinNextHopGroup(vector<NextHopKey>{ nexthop }, counts);
+    count = counts[0];
+    return rc;
+}
 
-    sai_object_id_t nexthop_id;
-    sai_status_t status;
-    count = 0;
+bool RouteOrch::invalidnexthopinNextHopGroup(const NextHopKey &nexthop, uint32_t& count)
+{
+    vector<uint32_t> counts;
+    bool rc = invalidnexthopinNextHopGroup(vector<NextHopKey>{ nexthop }, counts);
+    count = counts[0];
+    return rc;
+}
+
+void RouteOrch::getNextHopGroupsOf(const vector<NextHopKey> &nexthops,
+                                   vector<vector<NextHopGroupTable::iterator>> &nhopgroups)
+{
+    map<NextHopKey, size_t> index;
+    for (size_t n = 0; n < nexthops.size(); n++)
+    {
+        index.emplace(nexthops[n], n);
+    }
 
+    nhopgroups.assign(nexthops.size(), vector<NextHopGroupTable::iterator>());
     for (auto nhopgroup = m_syncdNextHopGroups.begin();
          nhopgroup != m_syncdNextHopGroups.end(); ++nhopgroup)
     {
-
-        if (!(nhopgroup->first.contains(nexthop)))
+        for (const auto &nh : nhopgroup->first.getNextHops())
         {
-            continue;
+            auto it = index.find(nh);
+            if (it != index.end())
+            {
+                nhopgroups[it->second].push_back(nhopgroup);
+            }
         }
+    }
+}
 
-        vector<sai_attribute_t> nhgm_attrs;
-        sai_attribute_t nhgm_attr;
+bool RouteOrch::handleNextHopGroupMemberStatus(sai_status_t status, bool create)
+{
+    /* Entries after a failed one are not executed by the bulk call, only the failed one is handled */
+    if (status == SAI_STATUS_NOT_EXECUTED)
+    {
+        return false;
+    }
 
-        /* get updated nhkey with possible weight */
-        auto nhkey = nhopgroup->first.getNextHops().find(nexthop);
+    task_process_status handle_status = create ?
+        handleSaiCreateStatus(SAI_API_NEXT_HOP_GROUP, status) :
+        handleSaiRemoveStatus(SAI_API_NEXT_HOP_GROUP, status);
+    if (handle_status != task_success)
+    {
+        return parseHandleSaiStatusFailure(handle_status);
+    }
 
-        nhgm_attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_GROUP_ID;
-        nhgm_attr.value.oid = nhopgroup->second.next_hop_group_id;
-        nhgm_attrs.push_back(nhgm_attr);
+    return true;
+}
 
-        nhgm_attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_ID;
-        nhgm_attr.value.oid = m_neighOrch->getNextHopId(nexthop);
-        nhgm_attrs.push_back(nhgm_attr);
+bool RouteOrch::validnexthopinNextHopGroup(const vector<NextHopKey> &nexthops, vector<uint32_t> &counts)
+{
+    SWSS_LOG_ENTER();
+
+    bool rc = true;
+    counts.assign(nexthops.size(), 0);
 
-        if (nhkey->weight)
+    vector<vector<NextHopGroupTable::iterator>> nhopgroups;
+    getNextHopGroupsOf(nexthops, nhopgroups);
+
+    /* Add the next hops back to all their groups with a single bulk call */
+    vector<vector<sai_object_id_t>> nhgm_ids(nexthops.size());
+    vector<vector<sai_status_t>> statuses(nexthops.size());
+    for (size_t n = 0; n < nexthops.size(); n++)
+    {
+        const auto &nexthop = nexthops[n];
+        sai_object_id_t next_hop_id = m_neighOrch->getNextHopId(nexthop);
+
+        nhgm_ids[n].resize(nhopgroups[n].size());
+        statuses[n].resize(nhopgroups[n].size());
+        for (size_t i = 0; i < nhopgroups[n].size(); i++)
         {
-            nhgm_attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_WEIGHT;
-            nhgm_attr.value.s32 = nhkey->weight;
+            auto nhopgroup = nhopgroups[n][i];
+
+            vector<sai_attribute_t> nhgm_attrs;
+            sai_attribute_t nhgm_attr;
+
+            /* get updated nhkey with possible weight */
+            auto nhkey = nhopgroup->first.getNextHops().find(nexthop);
+
+            nhgm_attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_GROUP_ID;
+            nhgm_attr.value.oid = nhopgroup->second.next_hop_group_id;
             nhgm_attrs.push_back(nhgm_attr);
-        }
 
-        if (m_switchOrch->checkOrderedEcmpEnable())
-        {
-            nhgm_attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_SEQUENCE_ID;
-            nhgm_attr.value.u32 = nhopgroup->second.nhopgroup_members[nexthop].seq_id;
+            nhgm_attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_ID;
+            nhgm_attr.value.oid = next_hop_id;
             nhgm_attrs.push_back(nhgm_attr);
-        }
 
-        status = sai_next_hop_group_api->create_next_hop_group_member(&nexthop_id, gSwitchId,
-                                                                      (uint32_t)nhgm_attrs.size(),
-                                                                      nhgm_attrs.data());
+            if (nhkey->weight)
+            {
+                nhgm_attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_WEIGHT;
+                nhgm_attr.value.s32 = nhkey->weight;
+                nhgm_attrs.push_back(nhgm_attr);
+            }
 
-        if (status != SAI_STATUS_SUCCESS)
-        {
-            SWSS_LOG_ERROR("Failed to add next hop member to group %" PRIx64 ": %d\n",
-                           nhopgroup->second.next_hop_group_id, status);
-            task_process_status handle_status = handleSaiCreateStatus(SAI_API_NEXT_HOP_GROUP, status);
-            if (handle_status != task_success)
+            if (m_switchOrch->checkOrderedEcmpEnable())
             {
-                return parseHandleSaiStatusFailure(handle_status);
+                nhgm_attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_SEQUENCE_ID;
+                nhgm_attr.value.u32 = nhopgroup->second.nhopgroup_members[nexthop].seq_id;
+                nhgm_attrs.push_back(nhgm_attr);
             }
-        }
 
-        ++count;
-        gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_NEXTHOP_GROUP_MEMBER);
-        nhopgroup->second.nhopgroup_members[nexthop].next_hop_id = nexthop_id;
+            gNextHopGroupMemberBulker.create_entry(&nhgm_ids[n][i], &statuses[n][i],
+                                                     (uint32_t)nhgm_attrs.size(),
+                                                     nhgm_attrs.data());
+        }
     }
 
-    if (!m_fgNhgOrch->validNextHopInNextHopGroup(nexthop))
+    gNextHopGroupMemberBulker.flush();
+    for (size_t n = 0; n < nexthops.size(); n++)
     {
-        return false;
+        const auto &nexthop = nexthops[n];
+
+        for (size_t i = 0; i < nhopgroups[n].size(); i++)
+        {
+            auto nhopgroup = nhopgroups[n][i];
+
+            if (statuses[n][i] != SAI_STATUS_SUCCESS)
+            {
+                /* Keep going so that the members created in this bulk are still accounted */
+                SWSS_LOG_ERROR("Failed to add next hop %s member to group %" PRIx64 ": %d\n",
+                               nexthop.to_string().c_str(), nhopgroup->second.next_hop_group_id, statuses[n][i]);
+                if (!handleNextHopGroupMemberStatus(statuses[n][i], true))
+                {
+                    rc = false;
+                }
+                continue;
+            }
+
+            ++counts[n];
+            gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_NEXTHOP_GROUP_MEMBER);
+            nhopgroup->second.nhopgroup_members[nexthop].next_hop_id = nhgm_ids[n][i];
+        }
+
+        if (!m_fgNhgOrch->validNextHopInNextHopGroup(nexthop))
+        {
+            rc = false;
+        }
     }
 
-    return true;
+    return rc;
 }
 
-bool RouteOrch::invalidnexthopinNextHopGroup(const NextHopKey &nexthop, uint32_t& count)
+bool RouteOrch::invalidnexthopinNextHopGroup(const vector<NextHopKey> &nexthops, vector<uint32_t> &counts)
 {
     SWSS_LOG_ENTER();
 
-    sai_object_id_t nexthop_id;
-    sai_status_t status;
-    count = 0;
+    bool rc = true;
+    counts.assign(nexthops.size(), 0);
 
-    for (auto nhopgroup = m_syncdNextHopGroups.begin();
-         nhopgroup != m_syncdNextHopGroups.end(); ++nhopgroup)
-    {
+    vector<vector<NextHopGroupTable::iterator>> nhopgroups;
+    getNextHopGroupsOf(nexthops, nhopgroups);
 
-        if (!(nhopgroup->first.contains(nexthop)))
+    /* Remove the next hops from all their groups with a single bulk call */
+    vector<vector<sai_status_t>> statuses(nexthops.size());
+    for (size_t n = 0; n < nexthops.size(); n++)
+    {
+        statuses[n].resize(nhopgroups[n].size());
+        for (size_t i = 0; i < nhopgroups[n].size(); i++)
         {
-            continue;
+            sai_object_id_t nexthop_id = nhopgroups[n][i]->second.nhopgroup_members[nexthops[n]].next_hop_id;
+            gNextHopGroupMemberBulker.remove_entry(&statuses[n][i], nexthop_id);
         }
+    }
 
-        nexthop_id = nhopgroup->second.nhopgroup_members[nexthop].next_hop_id;
-        status = sai_next_hop_group_api->remove_next_hop_group_member(nexthop_id);
+    gNextHopGroupMemberBulker.flush();
+    for (size_t n = 0; n < nexthops.size(); n++)
+    {
+        const auto &nexthop = nexthops[n];
 
-        if (status != SAI_STATUS_SUCCESS)
+        for (size_t i = 0; i < nhopgroups[n].size(); i++)
         {
-            SWSS_LOG_ERROR("Failed to remove next hop member %" PRIx64 " from group %" PRIx64 ": %d\n",
-                           nexthop_id, nhopgroup->second.next_hop_group_id, status);
-            task_process_status handle_status = handleSaiRemoveStatus(SAI_API_NEXT_HOP_GROUP, status);
-            if (handle_status != task_success)
+            if (statuses[n][i] != SAI_STATUS_SUCCESS)
             {
-                return parseHandleSaiStatusFailure(handle_status);
+                /* Keep going so that the members removed in this bulk are still accounted */
+                SWSS_LOG_ERROR("Failed to remove next hop member %" PRIx64 " from group %" PRIx64 ": %d\n",
+                               nhopgroups[n][i]->second.nhopgroup_members[nexthop].next_hop_id,
+                               nhopgroups[n][i]->second.next_hop_group_id, statuses[n][i]);
+                if (!handleNextHopGroupMemberStatus(statuses[n][i], false))
+                {
+                    rc = false;
+                }
+                continue;
             }
-        }
 
-        ++count;
-        gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_NEXTHOP_GROUP_MEMBER);
-    }
+            ++counts[n];
+            gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_NEXTHOP_GROUP_MEMBER);
+        }
 
-    if (!m_fgNhgOrch->invalidNextHopInNextHopGroup(nexthop))
-    {
-        return false;
+        if (!m_fgNhgOrch->invalidNextHopInNextHopGroup(nexthop))
+        {
+            rc = false;
+        }
     }
 
-    return true;
+    return rc;
 }
 
 void RouteOrch::doTask(Consumer& consumer)
@@ -510,41 +616,29 @@ void RouteOrch::doTask(Consumer& consumer)
 
             /* Get notification from application */
             /* resync application:
-             * When routeorch receives 'resync' message, it marks all current
-             * routes as dirty and waits for 'resync complete' message. For all
-             * newly received routes, if they match current dirty routes, it unmarks
-             * them dirty. After receiving 'resync complete' message, it creates all
-             * newly added routes and removes all dirty routes.
+             * When routeorch receives 'resync' message, it starts a new resync
+             * generation and holds the received routes until the 'resync complete'
+             * message. Then the routes refreshed in the meantime are stamped with
+             * the generation, all the routes left with an older generation are
+             * removed in bulk and the newly received routes are processed.
              */
             if (key == "resync")
             {
                 if (op == "SET")
                 {
-                    /* Mark all current routes as dirty (DEL) in consumer.m_toSync map */
                     SWSS_LOG_NOTICE("Start resync routes\n");
-                    for (auto j : m_syncdRoutes)
-                    {
-                        string vrf;
-
-                        if (j.first != gVirtualRouterId)
-                        {
-                            vrf = m_vrfOrch->getVRFname(j.first) + ":";
-                        }
-
-                        for (auto i : j.second)
-                        {
-                            vector<FieldValueTuple> v;
-                            key = vrf + i.first.to_string();
-                            auto x = KeyOpFieldsValuesTuple(key, DEL_COMMAND, v);
-                            consumer.addToSync(x);
-                        }
-                    }
+                    m_resyncGeneration++;
                     m_resync = true;
                 }
                 else
                 {
                     SWSS_LOG_NOTICE("Complete resync routes\n");
-                    m_resync = false;
+                    if (m_resync)
+                    {
+                        m_resync = false;
+                        markResyncedRoutes(consumer);
+                        removeUnresyncedRoutes(consumer);
+                    }
                 }
 
                 it = consumer.m_toSync.erase(it);
@@ -961,46 +1055,173 @@ void RouteOrch::doTask(Consumer& consumer)
             }
         }
 
-        /* Remove next hop group if the reference count decreases to zero */
-        for (auto& it_nhg : m_bulkNhgReducedRefCnt)
+        removeReducedRefCntNextHopGroups();
+    }
+}
+
+/* Remove next hop group if the reference count decreases to zero */
+void RouteOrch::removeReducedRefCntNextHopGroups()
+{
+    for (auto& it_nhg : m_bulkNhgReducedRefCnt)
+    {
+        if (it_nhg.first.is_overlay_nexthop() && it_nhg.second != 0)
         {
-            if (it_nhg.first.is_overlay_nexthop() && it_nhg.second != 0)
-            {
-                removeOverlayNextHops(it_nhg.second, it_nhg.first);
-            }
-            else if (it_nhg.first.is_srv6_nexthop())
+            removeOverlayNextHops(it_nhg.second, it_nhg.first);
+        }
+        else if (it_nhg.first.is_srv6_nexthop())
+        {
+            if(it_nhg.first.getSize() > 1)
             {
-                if(it_nhg.first.getSize() > 1)
+                if(m_syncdNextHopGroups[it_nhg.first].ref_count == 0)
                 {
-                    if(m_syncdNextHopGroups[it_nhg.first].ref_count == 0)
-                    {
-                      removeNextHopGroup(it_nhg.first);
-                    }
-                    else
-                    {
-                      SWSS_LOG_ERROR("SRV6 ECMP %s REF count is not zero", it_nhg.first.to_string().c_str());
-                    }
+                  removeNextHopGroup(it_nhg.first);
+                }
+                else
+                {
+                  SWSS_LOG_ERROR("SRV6 ECMP %s REF count is not zero", it_nhg.first.to_string().c_str());
                 }
             }
-            else if (m_syncdNextHopGroups[it_nhg.first].ref_count == 0)
+        }
+        else if (m_syncdNextHopGroups[it_nhg.first].ref_count == 0)
+        {
+            removeNextHopGroup(it_nhg.first);
+        }
+    }
+}
+
+/*
+ * Stamp the synced routes that have been refreshed during the resync window,
+ * i.e. the routes with a pending SET, with the current resync generation.
+ */
+void RouteOrch::markResyncedRoutes(Consumer& consumer)
+{
+    SWSS_LOG_ENTER();
+
+    for (const auto& entry : consumer.m_toSync)
+    {
+        const KeyOpFieldsValuesTuple& t = entry.second;
+        const string& key = kfvKey(t);
+
+        if (kfvOp(t) != SET_COMMAND || key == "resync")
+        {
+            continue;
+        }
+
+        sai_object_id_t vrf_id = gVirtualRouterId;
+        size_t prefix_pos = 0;
+
+        if (!key.compare(0, strlen(VRF_PREFIX), VRF_PREFIX))
+        {
+            size_t found = key.find(':');
+            string vrf_name = key.substr(0, found);
+
+            if (found == string::npos || !m_vrfOrch->isVRFexists(vrf_name))
             {
-                removeNextHopGroup(it_nhg.first);
+                continue;
             }
+            vrf_id = m_vrfOrch->getVRFid(vrf_name);
+            prefix_pos = found + 1;
+        }
+
+        auto it_route_table = m_syncdRoutes.find(vrf_id);
+        if (it_route_table == m_syncdRoutes.end())
+        {
+            continue;
+        }
+
+        try
+        {
+            auto it_route = it_route_table->second.find(IpPrefix(key.substr(prefix_pos)));
+            if (it_route != it_route_table->second.end())
+            {
+                it_route->second.generation = m_resyncGeneration;
+            }
+        }
+        catch (const std::invalid_argument& e)
+        {
+            /* Reported when the entry itself is processed */
+            continue;
         }
     }
 }
 
-void RouteOrch::notifyNextHopChangeObservers(sai_object_id_t vrf_id, const IpPrefix &prefix, const NextHopGroupKey &nexthops, bool add)
+/*
+ * Remove the synced routes which have not been refreshed during the resync
+ * window with a single bulk call.
+ */
+void RouteOrch::removeUnresyncedRoutes(Consumer& consumer)
 {
     SWSS_LOG_ENTER();
 
-    for (auto& entry : m_nextHopObservers)
+    std::deque<RouteBulkContext> toRemove;
+
+    for (const auto& route_table : m_syncdRoutes)
+    {
+        for (const auto& route : route_table.second)
+        {
+            if (route.second.generation == m_resyncGeneration)
+            {
+                continue;
+            }
+
+            toRemove.emplace_back();
+            auto& ctx = toRemove.back();
+            ctx.vrf_id = route_table.first;
+            ctx.ip_prefix = route.first;
+        }
+    }
+
+    SWSS_LOG_NOTICE("Remove %zu routes not refreshed by resync", toRemove.size());
+
+    for (auto& ctx : toRemove)
+    {
+        removeRoute(ctx);
+    }
+
+    gRouteBulker.flush();
+
+    m_bulkNhgReducedRefCnt.clear();
+    for (const auto& ctx : toRemove)
     {
-        if (vrf_id != entry.first.first || !prefix.isAddressInSubnet(entry.first.second))
+        if (ctx.object_statuses.empty() || removeRoutePost(ctx))
         {
             continue;
         }
 
+        /* Retry the removal through the regular route processing */
+        string key = ctx.ip_prefix.to_string();
+        if (ctx.vrf_id != gVirtualRouterId)
+        {
+            key = m_vrfOrch->getVRFname(ctx.vrf_id) + ":" + key;
+        }
+        vector<FieldValueTuple> v;
+        consumer.addToSync(KeyOpFieldsValuesTuple(key, DEL_COMMAND, v));
+    }
+
+    removeReducedRefCntNextHopGroups();
+    m_bulkNhgReducedRefCnt.clear();
+}
+
+void RouteOrch::notifyNextHopChangeObservers(sai_object_id_t vrf_id, const IpPrefix &prefix, const NextHopGroupKey &nexthops, bool add)
+{
+    SWSS_LOG_ENTER();
+
+    auto index = m_nextHopObserverIndex.find(vrf_id);
+    if (index == m_nextHopObserverIndex.end())
+    {
+        return;
+    }
+
+    /* Only the hosts inside the prefix are affected by the change */
+    vector<NextHopObserverTable::iterator> entries;
+    index->second.forEachCovered(prefix, [&entries](NextHopObserverTable::iterator &it) {
+        entries.push_back(it);
+    });
+
+    for (auto it : entries)
+    {
+        auto& entry = *it;
+
         if (add)
         {
             bool update_required = false;
@@ -1123,6 +1344,36 @@ bool RouteOrch::isRefCounterZero(const NextHopGroupKey &nexthops) const
     return m_syncdNextHopGroups.at(nexthops).ref_count == 0;
 }
 
+/*
+ * Routes using the same next hops store copies of a single pooled key, so
+ * that the next hop set is held once rather than once per route.
+ */
+NextHopGroupKey RouteOrch::internRouteNhgKey(const NextHopGroupKey &nextHops)
+{
+    if (nextHops.getSize() == 0)
+    {
+        return nextHops;
+    }
+
+    auto it = m_routeNhgKeys.emplace(nextHops, 0).first;
+    it->second++;
+    return it->first;
+}
+
+void RouteOrch::releaseRouteNhgKey(const NextHopGroupKey &nextHops)
+{
+    auto it = m_routeNhgKeys.find(nextHops);
+    if (it == m_routeNhgKeys.end())
+    {
+        return;
+    }
+
+    if (--it->second == 0)
+    {
+        m_routeNhgKeys.erase(it);
+    }
+}
+
 const NextHopGroupKey RouteOrch::getSyncdRouteNhgKey(sai_object_id_t vrf_id, const IpPrefix& ipPrefix)
 {
     NextHopGroupKey nhg;
@@ -1536,48 +1787,80 @@ void RouteOrch::removeNextHopRoute(const NextHopKey& nextHop, const RouteKey& ro
 
 bool RouteOrch::updateNextHopRoutes(const NextHopKey& nextHop, uint32_t& numRoutes)
 {
-    numRoutes = 0;
-    auto it = m_nextHops.find((nextHop));
+    vector<uint32_t> counts;
+    bool rc = updateNextHopRoutes(vector<NextHopKey>{ nextHop }, counts);
+    numRoutes = counts[0];
+    return rc;
+}
 
-    if (it == m_nextHops.end())
-    {
-        SWSS_LOG_INFO("No routes found for NH %s", nextHop.ip_address.to_string().c_str());
-        return true;
-    }
+bool RouteOrch::updateNextHopRoutes(const vector<NextHopKey>& nextHops, vector<uint32_t>& numRoutes)
+{
+    numRoutes.assign(nextHops.size(), 0);
 
     sai_route_entry_t route_entry;
     sai_attribute_t route_attr;
-    sai_object_id_t next_hop_id;
 
-    auto rt = it->second.begin();
-    while(rt != it->second.end())
+    route_attr.id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
+
+    /* Re-point the routes of all the next hops with a single bulk call */
+    vector<NextHopRouteTable::iterator> nhRoutes(nextHops.size(), m_nextHops.end());
+    vector<vector<sai_status_t>> statuses(nextHops.size());
+    for (size_t n = 0; n < nextHops.size(); n++)
     {
-        SWSS_LOG_INFO("Updating route %s", (*rt).prefix.to_string().c_str());
-        next_hop_id = m_neighOrch->getNextHopId(nextHop);
+        auto it = m_nextHops.find(nextHops[n]);
+        if (it == m_nextHops.end())
+        {
+            SWSS_LOG_INFO("No routes found for NH %s", nextHops[n].ip_address.to_string().c_str());
+            continue;
+        }
 
-        route_entry.vr_id = (*rt).vrf_id;
-        route_entry.switch_id = gSwitchId;
-        copy(route_entry.destination, (*rt).prefix);
+        nhRoutes[n] = it;
+        route_attr.value.oid = m_neighOrch->getNextHopId(nextHops[n]);
 
-        route_attr.id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
-        route_attr.value.oid = next_hop_id;
+        statuses[n].resize(it->second.size());
+        size_t i = 0;
+        for (const auto& rt : it->second)
+        {
+            SWSS_LOG_INFO("Updating route %s", rt.prefix.to_string().c_str());
 
-        sai_status_t status = sai_route_api->set_route_entry_attribute(&route_entry, &route_attr);
-        if (status != SAI_STATUS_SUCCESS)
+            route_entry.vr_id = rt.vrf_id;
+            route_entry.switch_id = gSwitchId;
+            copy(route_entry.destination, rt.prefix);
+
+            gRouteBulker.set_entry_attribute(&statuses[n][i++], &route_entry, &route_attr);
+        }
+    }
+
+    gRouteBulker.flush();
+
+    bool rc = true;
+    for (size_t n = 0; n < nextHops.size(); n++)
+    {
+        if (nhRoutes[n] == m_nextHops.end())
         {
-            SWSS_LOG_ERROR("Failed to update route %s, rv:%d", (*rt).prefix.to_string().c_str(), status);
-            task_process_status handle_status = handleSaiSetStatus(SAI_API_ROUTE, status);
-            if (handle_status != task_success)
+            continue;
+        }
+
+        size_t i = 0;
+        for (const auto& rt : nhRoutes[n]->second)
+        {
+            sai_status_t status = statuses[n][i++];
+            if (status != SAI_STATUS_SUCCESS)
             {
-                return parseHandleSaiStatusFailure(handle_status);
+                SWSS_LOG_ERROR("Failed to update route %s, rv:%d", rt.prefix.to_string().c_str(), status);
+                task_process_status handle_status = handleSaiSetStatus(SAI_API_ROUTE, status);
+                if (handle_status != task_success && !parseHandleSaiStatusFailure(handle_status))
+                {
+                    rc = false;
+                }
+                continue;
             }
-        }
 
-        ++numRoutes;
-        ++rt;
+            ++numRoutes[n];
+        }
     }
 
-    return true;
+    return rc;
 }
 
 void RouteOrch::addTempRoute(RouteBulkContext& ctx, const NextHopGroupKey &nextHops)
@@ -2222,7 +2505,12 @@ bool RouteOrch::addRoutePost(const RouteBulkContext& ctx, const NextHopGroupKey
         gFlowCounterRouteOrch->handleRouteAdd(vrf_id, ipPrefix);
     }
 
-    m_syncdRoutes[vrf_id][ipPrefix] = RouteNhg(nextHops, ctx.nhg_index);
+    NextHopGroupKey nhg_key = internRouteNhgKey(nextHops);
+    if (it_route != m_syncdRoutes.at(vrf_id).end())
+    {
+        releaseRouteNhgKey(it_route->second.nhg_key);
+    }
+    m_syncdRoutes[vrf_id][ipPrefix] = RouteNhg(nhg_key, ctx.nhg_index);
 
     notifyNextHopChangeObservers(vrf_id, ipPrefix, nextHops, true);
 
@@ -2420,6 +2708,8 @@ bool RouteOrch::removeRoutePost(const RouteBulkContext& ctx)
     SWSS_LOG_INFO("Remove route %s with next hop(s) %s",
             ipPrefix.to_string().c_str(), it_route->second.nhg_key.to_string().c_str());
 
+    releaseRouteNhgKey(it_route->second.nhg_key);
+
     if (ipPrefix.isDefaultRoute() && vrf_id == gVirtualRouterId)
     {
         it_route_table->second[ipPrefix] = RouteNhg();
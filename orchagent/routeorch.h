@@ -12,10 +12,12 @@
 #include "ipaddress.h"
 #include "ipaddresses.h"
 #include "ipprefix.h"
+#include "ipprefixtrie.h"
 #include "nexthopgroupkey.h"
 #include "bulker.h"
 #include "fgnhgorch.h"
 #include <map>
+#include <unordered_map>
 
 /* Maximum next hop group number */
 #define NHGRP_MAX_SIZE 128
@@ -64,6 +66,9 @@ struct RouteNhg
      */
     std::string nhg_index;
 
+    /* Resync generation in which the route was last refreshed */
+    uint32_t generation = 0;
+
     RouteNhg() = default;
     RouteNhg(const NextHopGroupKey& key, const std::string& index) :
         nhg_key(key), nhg_index(index) {}
@@ -88,7 +93,7 @@ struct RouteKey
 };
 
 /* NextHopGroupTable: NextHopGroupKey, NextHopGroupEntry */
-typedef std::map<NextHopGroupKey, NextHopGroupEntry> NextHopGroupTable;
+typedef std::unordered_map<NextHopGroupKey, NextHopGroupEntry> NextHopGroupTable;
 /* RouteTable: destination network, NextHopGroupKey */
 typedef std::map<IpPrefix, RouteNhg> RouteTable;
 /* RouteTables: vrf_id, RouteTable */
@@ -110,6 +115,11 @@ struct NextHopObserverEntry
     list<Observer *> observers;
 };
 
+/* NextHopObserverTrie: observed hosts of a VRF by destination IP */
+typedef IpPrefixTrie<NextHopObserverTable::iterator> NextHopObserverTrie;
+/* NextHopObserverIndex: vrf_id, NextHopObserverTrie */
+typedef std::map<sai_object_id_t, NextHopObserverTrie> NextHopObserverIndex;
+
 struct RouteBulkContext
 {
     std::deque<sai_status_t>            object_statuses;    // Bulk statuses
@@ -195,9 +205,13 @@ public:
     void addNextHopRoute(const NextHopKey&, const RouteKey&);
     void removeNextHopRoute(const NextHopKey&, const RouteKey&);
     bool updateNextHopRoutes(const NextHopKey&, uint32_t&);
+    bool updateNextHopRoutes(const std::vector<NextHopKey>&, std::vector<uint32_t>&);
 
     bool validnexthopinNextHopGroup(const NextHopKey&, uint32_t&);
     bool invalidnexthopinNextHopGroup(const NextHopKey&, uint32_t&);
+    /* Batched variants: one bulk call for all the next hops, count per next hop */
+    bool validnexthopinNextHopGroup(const std::vector<NextHopKey>&, std::vector<uint32_t>&);
+    bool invalidnexthopinNextHopGroup(const std::vector<NextHopKey>&, std::vector<uint32_t>&);
 
     bool createRemoteVtep(sai_object_id_t, const NextHopKey&);
     bool deleteRemoteVtep(sai_object_id_t, const NextHopKey&);
@@ -219,6 +233,7 @@ public:
     void decreaseNextHopGroupCount();
     bool checkNextHopGroupCount();
     const RouteTables& getSyncdRoutes() const { return m_syncdRoutes; }
+    size_t getRouteNhgKeyCount() const { return m_routeNhgKeys.size(); }
 
 private:
     SwitchOrch *m_switchOrch;
@@ -231,6 +246,7 @@ private:
     unsigned int m_nextHopGroupCount;
     unsigned int m_maxNextHopGroupCount;
     bool m_resync;
+    uint32_t m_resyncGeneration;
 
     shared_ptr<DBConnector> m_stateDb;
     unique_ptr<swss::Table> m_stateDefaultRouteTb;
@@ -240,15 +256,22 @@ private:
     NextHopGroupTable m_syncdNextHopGroups;
     NextHopRouteTable m_nextHops;
 
+    /* Next hop group keys shared by m_syncdRoutes entries: key, number of routes */
+    std::unordered_map<NextHopGroupKey, uint32_t> m_routeNhgKeys;
+
     std::set<std::pair<NextHopGroupKey, sai_object_id_t>> m_bulkNhgReducedRefCnt;
     /* m_bulkNhgReducedRefCnt: nexthop, vrf_id */
 
     NextHopObserverTable m_nextHopObservers;
+    NextHopObserverIndex m_nextHopObserverIndex;
 
     EntityBulker<sai_route_api_t>           gRouteBulker;
     EntityBulker<sai_mpls_api_t>            gLabelRouteBulker;
     ObjectBulker<sai_next_hop_group_api_t>  gNextHopGroupMemberBulker;
 
+    void getNextHopGroupsOf(const std::vector<NextHopKey>&, std::vector<std::vector<NextHopGroupTable::iterator>>&);
+    bool handleNextHopGroupMemberStatus(sai_status_t status, bool create);
+
     void addTempRoute(RouteBulkContext& ctx, const NextHopGroupKey&);
     bool addRoute(RouteBulkContext& ctx, const NextHopGroupKey&);
     bool removeRoute(RouteBulkContext& ctx);
@@ -263,6 +286,13 @@ private:
 
     void updateDefRouteState(string ip, bool add=false);
 
+    void markResyncedRoutes(Consumer& consumer);
+    void removeUnresyncedRoutes(Consumer& consumer);
+    void removeReducedRefCntNextHopGroups();
+
+    NextHopGroupKey internRouteNhgKey(const NextHopGroupKey&);
+    void releaseRouteNhgKey(const NextHopGroupKey&);
+
     void doTask(Consumer& consumer);
     void doLabelTask(Consumer& consumer);
 
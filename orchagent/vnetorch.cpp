@@ -6,6 +6,7 @@
 #include <exception>
 #include <inttypes.h>
 #include <algorithm>
+#include <list>
 
 #include "sai.h"
 #include "saiextensions.h"
@@ -33,6 +34,7 @@ extern sai_next_hop_api_t* sai_next_hop_api;
 extern sai_next_hop_group_api_t* sai_next_hop_group_api;
 extern sai_object_id_t gSwitchId;
 extern sai_object_id_t gVirtualRouterId;
+extern size_t gMaxBulkSize;
 extern Directory<Orch*> gDirectory;
 extern PortsOrch *gPortsOrch;
 extern IntfsOrch *gIntfsOrch;
@@ -689,30 +691,79 @@ static bool add_route(sai_object_id_t vr_id, sai_ip_prefix_t& ip_pfx, sai_object
     return true;
 }
 
-static bool update_route(sai_object_id_t vr_id, sai_ip_prefix_t& ip_pfx, sai_object_id_t nh_id)
+static void queue_route_op(EntityBulker<sai_route_api_t>& bulker, VNetRouteBulkOp& route_op,
+                           sai_ip_prefix_t& ip_pfx, sai_object_id_t nh_id)
 {
     sai_route_entry_t route_entry;
-    route_entry.vr_id = vr_id;
+    route_entry.vr_id = route_op.vr_id;
     route_entry.switch_id = gSwitchId;
     route_entry.destination = ip_pfx;
 
     sai_attribute_t route_attr;
-
     route_attr.id = SAI_ROUTE_ENTRY_ATTR_NEXT_HOP_ID;
     route_attr.value.oid = nh_id;
 
-    sai_status_t status = sai_route_api->set_route_entry_attribute(&route_entry, &route_attr);
-    if (status != SAI_STATUS_SUCCESS)
+    switch (route_op.type)
     {
-        SWSS_LOG_ERROR("SAI failed to update route");
-        return false;
+    case VNetRouteBulkOp::ADD:
+        bulker.create_entry(&route_op.status, &route_entry, 1, &route_attr);
+        break;
+    case VNetRouteBulkOp::DEL:
+        bulker.remove_entry(&route_op.status, &route_entry);
+        break;
+    case VNetRouteBulkOp::UPDATE:
+        bulker.set_entry_attribute(&route_op.status, &route_entry, &route_attr);
+        break;
     }
+}
 
-    return true;
+/* Account a flushed route entry operation the same way as add_route/del_route */
+static bool check_route_op(const VNetRouteBulkOp& route_op, sai_ip_prefix_t& ip_pfx)
+{
+    CrmResourceType crm_type = ip_pfx.addr_family == SAI_IP_ADDR_FAMILY_IPV4 ?
+                               CrmResourceType::CRM_IPV4_ROUTE : CrmResourceType::CRM_IPV6_ROUTE;
+
+    switch (route_op.type)
+    {
+    case VNetRouteBulkOp::ADD:
+        if (route_op.status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("SAI failed to create route, rv: %d", route_op.status);
+            return false;
+        }
+        gCrmOrch->incCrmResUsedCounter(crm_type);
+        gFlowCounterRouteOrch->onAddMiscRouteEntry(route_op.vr_id, ip_pfx, false);
+        return true;
+    case VNetRouteBulkOp::DEL:
+        if (route_op.status == SAI_STATUS_ITEM_NOT_FOUND || route_op.status == SAI_STATUS_INVALID_PARAMETER)
+        {
+            SWSS_LOG_INFO("Unable to remove route since route is already removed");
+            return true;
+        }
+        if (route_op.status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("SAI Failed to remove route, rv: %d", route_op.status);
+            return false;
+        }
+        gCrmOrch->decCrmResUsedCounter(crm_type);
+        gFlowCounterRouteOrch->onRemoveMiscRouteEntry(route_op.vr_id, ip_pfx, false);
+        return true;
+    case VNetRouteBulkOp::UPDATE:
+        if (route_op.status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("SAI failed to update route, rv: %d", route_op.status);
+            return false;
+        }
+        return true;
+    }
+
+    return false;
 }
 
 VNetRouteOrch::VNetRouteOrch(DBConnector *db, vector<string> &tableNames, VNetOrch *vnetOrch)
-                                  : Orch2(db, tableNames, request_), vnet_orch_(vnetOrch), bfd_session_producer_(db, APP_BFD_SESSION_TABLE_NAME)
+                                  : Orch2(db, tableNames, request_), vnet_orch_(vnetOrch), bfd_session_producer_(db, APP_BFD_SESSION_TABLE_NAME),
+                                    route_bulker_(sai_route_api, gMaxBulkSize),
+                                    nhgm_bulker_(sai_next_hop_group_api, gSwitchId, gMaxBulkSize)
 {
     SWSS_LOG_ENTER();
 
@@ -727,6 +778,8 @@ VNetRouteOrch::VNetRouteOrch(DBConnector *db, vector<string> &tableNames, VNetOr
     monitor_session_producer_ = unique_ptr<Table>(new Table(app_db_.get(), APP_VNET_MONITOR_TABLE_NAME));
 
     gBfdOrch->attach(this);
+
+    setBulkMode(true);
 }
 
 bool VNetRouteOrch::hasNextHopGroup(const string& vnet, const NextHopGroupKey& nexthops)
@@ -797,8 +850,12 @@ bool VNetRouteOrch::addNextHopGroup(const string& vnet, const NextHopGroupKey &n
     NextHopGroupInfo next_hop_group_entry;
     next_hop_group_entry.next_hop_group_id = next_hop_group_id;
 
-    for (auto nhid: next_hop_ids)
+    /* Create all the members with a single bulk call */
+    vector<sai_object_id_t> nhgm_ids(next_hop_ids.size());
+    for (size_t i = 0; i < next_hop_ids.size(); i++)
     {
+        sai_object_id_t nhid = next_hop_ids[i];
+
         // Create a next hop group member
         vector<sai_attribute_t> nhgm_attrs;
 
@@ -818,24 +875,30 @@ bool VNetRouteOrch::addNextHopGroup(const string& vnet, const NextHopGroupKey &n
             nhgm_attrs.push_back(nhgm_attr);
         }
 
-        sai_object_id_t next_hop_group_member_id;
-        status = sai_next_hop_group_api->create_next_hop_group_member(&next_hop_group_member_id,
-                                                                    gSwitchId,
-                                                                    (uint32_t)nhgm_attrs.size(),
-                                                                    nhgm_attrs.data());
+        nhgm_bulker_.create_entry(&nhgm_ids[i],
+                                  (uint32_t)nhgm_attrs.size(),
+                                  nhgm_attrs.data());
+    }
 
-        if (status != SAI_STATUS_SUCCESS)
+    nhgm_bulker_.flush();
+
+    bool rc = true;
+    for (size_t i = 0; i < next_hop_ids.size(); i++)
+    {
+        if (nhgm_ids[i] == SAI_NULL_OBJECT_ID)
         {
-            SWSS_LOG_ERROR("Failed to create next hop group %" PRIx64 " member %" PRIx64 ": %d\n",
-                           next_hop_group_id, next_hop_group_member_id, status);
-            return false;
+            /* Keep going so that the members created in this bulk are tracked */
+            SWSS_LOG_ERROR("Failed to create next hop group %" PRIx64 " member for next hop %" PRIx64,
+                           next_hop_group_id, next_hop_ids[i]);
+            rc = false;
+            continue;
         }
 
         gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_NEXTHOP_GROUP_MEMBER);
 
         // Save the membership into next hop structure
-        next_hop_group_entry.active_members[nhopgroup_members_set.find(nhid)->second] =
-                                                                next_hop_group_member_id;
+        next_hop_group_entry.active_members[nhopgroup_members_set.find(next_hop_ids[i])->second] =
+                                                                nhgm_ids[i];
     }
 
     /*
@@ -845,7 +908,13 @@ bool VNetRouteOrch::addNextHopGroup(const string& vnet, const NextHopGroupKey &n
     next_hop_group_entry.ref_count = 0;
     syncd_nexthop_groups_[vnet][nexthops] = next_hop_group_entry;
 
-    return true;
+    if (!rc)
+    {
+        /* Same outcome as a failed member creation: no group, the route is retried */
+        removeNextHopGroup(vnet, nexthops, vrf_obj);
+    }
+
+    return rc;
 }
 
 bool VNetRouteOrch::removeNextHopGroup(const string& vnet, const NextHopGroupKey &nexthops, VNetVrfObject *vrf_obj)
@@ -866,23 +935,40 @@ bool VNetRouteOrch::removeNextHopGroup(const string& vnet, const NextHopGroupKey
     next_hop_group_id = next_hop_group_entry->second.next_hop_group_id;
     SWSS_LOG_NOTICE("Delete next hop group %s", nexthops.to_string().c_str());
 
-    for (auto nhop = next_hop_group_entry->second.active_members.begin();
-         nhop != next_hop_group_entry->second.active_members.end();)
+    /* Remove all the members with a single bulk call */
+    auto& active_members = next_hop_group_entry->second.active_members;
+    vector<sai_status_t> statuses(active_members.size());
+    size_t i = 0;
+    for (const auto& nhop : active_members)
     {
-        NextHopKey nexthop = nhop->first;
+        nhgm_bulker_.remove_entry(&statuses[i++], nhop.second);
+    }
 
-        status = sai_next_hop_group_api->remove_next_hop_group_member(nhop->second);
-        if (status != SAI_STATUS_SUCCESS)
+    nhgm_bulker_.flush();
+
+    bool rc = true;
+    i = 0;
+    for (auto nhop = active_members.begin(); nhop != active_members.end(); i++)
+    {
+        if (statuses[i] != SAI_STATUS_SUCCESS)
         {
             SWSS_LOG_ERROR("Failed to remove next hop group member %" PRIx64 ", rv:%d",
-                           nhop->second, status);
-            return false;
+                           nhop->second, statuses[i]);
+            rc = false;
+            nhop++;
+            continue;
         }
 
+        NextHopKey nexthop = nhop->first;
         vrf_obj->removeTunnelNextHop(nexthop);
 
         gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_NEXTHOP_GROUP_MEMBER);
-        nhop = next_hop_group_entry->second.active_members.erase(nhop);
+        nhop = active_members.erase(nhop);
+    }
+
+    if (!rc)
+    {
+        return false;
     }
 
     status = sai_next_hop_group_api->remove_next_hop_group(next_hop_group_id);
@@ -900,19 +986,28 @@ bool VNetRouteOrch::removeNextHopGroup(const string& vnet, const NextHopGroupKey
     return true;
 }
 
-template<>
-bool VNetRouteOrch::doRouteTask<VNetVrfObject>(const string& vnet, IpPrefix& ipPrefix,
-                                               NextHopGroupKey& nexthops, string& op, string& profile,
-                                               const string& monitoring,
-                                               const map<NextHopKey, IpAddress>& monitors)
+/*
+ * Tunnel routes are programmed in two steps so that the route entries of many
+ * requests go to SAI in one bulk: addTunnelRouteBulk() sets up the next hop
+ * group and queues the route entries, addTunnelRoutePost() checks the result
+ * of the flush and updates the route tables. Next hop groups dropped by routes
+ * are only removed after the flush, as a request of the same bulk may pick
+ * them up again.
+ */
+VNetRouteTaskStatus VNetRouteOrch::addTunnelRouteBulk(VNetRouteBulkContext& ctx)
 {
     SWSS_LOG_ENTER();
 
+    const string& vnet = ctx.vnet;
+    IpPrefix& ipPrefix = ctx.ip_prefix;
+    NextHopGroupKey& nexthops = ctx.nexthops;
+    const string& op = ctx.op;
+
     if (!vnet_orch_->isVnetExists(vnet))
     {
         SWSS_LOG_WARN("VNET %s doesn't exist for prefix %s, op %s",
                       vnet.c_str(), ipPrefix.to_string().c_str(), op.c_str());
-        return (op == DEL_COMMAND)?true:false;
+        return (op == DEL_COMMAND) ? VNetRouteTaskStatus::DONE : VNetRouteTaskStatus::FAILED;
     }
 
     set<sai_object_id_t> vr_set;
@@ -930,7 +1025,7 @@ bool VNetRouteOrch::doRouteTask<VNetVrfObject>(const string& vnet, IpPrefix& ipP
         if (!vnet_orch_->isVnetExists(peer))
         {
             SWSS_LOG_INFO("Peer VNET %s not yet created", peer.c_str());
-            return false;
+            return VNetRouteTaskStatus::FAILED;
         }
         l_fn(peer);
     }
@@ -939,12 +1034,15 @@ bool VNetRouteOrch::doRouteTask<VNetVrfObject>(const string& vnet, IpPrefix& ipP
     sai_ip_prefix_t pfx;
     copy(pfx, ipPrefix);
 
+    ctx.route_ops.clear();
+    ctx.route_ops.reserve(vr_set.size());
+
     if (op == SET_COMMAND)
     {
         sai_object_id_t nh_id;
         if (!hasNextHopGroup(vnet, nexthops))
         {
-            setEndpointMonitor(vnet, monitors, nexthops, monitoring, ipPrefix);
+            setEndpointMonitor(vnet, ctx.monitors, nexthops, ctx.monitoring, ipPrefix);
             if (nexthops.getSize() == 1)
             {
                 NextHopKey nexthop(nexthops.to_string(), true);
@@ -963,17 +1061,16 @@ bool VNetRouteOrch::doRouteTask<VNetVrfObject>(const string& vnet, IpPrefix& ipP
                 {
                     delEndpointMonitor(vnet, nexthops, ipPrefix);
                     SWSS_LOG_ERROR("Failed to create next hop group %s", nexthops.to_string().c_str());
-                    return false;
+                    return VNetRouteTaskStatus::FAILED;
                 }
             }
+            ctx.nhg_created = true;
         }
         nh_id = syncd_nexthop_groups_[vnet][nexthops].next_hop_group_id;
 
         auto it_route = syncd_tunnel_routes_[vnet].find(ipPrefix);
         for (auto vr_id : vr_set)
         {
-            bool route_status = true;
-
             // Remove route if the nexthop group has no active endpoint
             if (syncd_nexthop_groups_[vnet][nexthops].active_members.empty())
             {
@@ -983,59 +1080,100 @@ bool VNetRouteOrch::doRouteTask<VNetVrfObject>(const string& vnet, IpPrefix& ipP
                     // Remove route when updating from a nhg with active member to another nhg without
                     if (!syncd_nexthop_groups_[vnet][nhg].active_members.empty())
                     {
-                        del_route(vr_id, pfx);
+                        ctx.route_ops.push_back({ VNetRouteBulkOp::DEL, vr_id, SAI_STATUS_NOT_EXECUTED });
+                        queue_route_op(route_bulker_, ctx.route_ops.back(), pfx, nh_id);
                     }
                 }
             }
             else
             {
-                if (it_route == syncd_tunnel_routes_[vnet].end())
-                {
-                    route_status = add_route(vr_id, pfx, nh_id);
-                }
-                else
+                VNetRouteBulkOp::Type type = VNetRouteBulkOp::ADD;
+                if (it_route != syncd_tunnel_routes_[vnet].end())
                 {
                     NextHopGroupKey nhg = it_route->second;
-                    if (syncd_nexthop_groups_[vnet][nhg].active_members.empty())
-                    {
-                        route_status = add_route(vr_id, pfx, nh_id);
-                    }
-                    else
+                    if (!syncd_nexthop_groups_[vnet][nhg].active_members.empty())
                     {
-                        route_status = update_route(vr_id, pfx, nh_id);
+                        type = VNetRouteBulkOp::UPDATE;
                     }
                 }
+                ctx.route_ops.push_back({ type, vr_id, SAI_STATUS_NOT_EXECUTED });
+                queue_route_op(route_bulker_, ctx.route_ops.back(), pfx, nh_id);
             }
+        }
+    }
+    else if (op == DEL_COMMAND)
+    {
+        auto it_route = syncd_tunnel_routes_[vnet].find(ipPrefix);
+        if (it_route == syncd_tunnel_routes_[vnet].end())
+        {
+            SWSS_LOG_INFO("Failed to find tunnel route entry, prefix %s\n",
+                ipPrefix.to_string().c_str());
+            return VNetRouteTaskStatus::DONE;
+        }
+        NextHopGroupKey nhg = it_route->second;
 
-            if (!route_status)
+        for (auto vr_id : vr_set)
+        {
+            // If an nhg has no active member, the route should already be removed
+            if (!syncd_nexthop_groups_[vnet][nhg].active_members.empty())
             {
-                SWSS_LOG_ERROR("Route add/update failed for %s, vr_id '0x%" PRIx64, ipPrefix.to_string().c_str(), vr_id);
-                /* Clean up the newly created next hop group entry */
-                if (nexthops.getSize() > 1)
-                {
-                    removeNextHopGroup(vnet, nexthops, vrf_obj);
-                }
-                return false;
+                ctx.route_ops.push_back({ VNetRouteBulkOp::DEL, vr_id, SAI_STATUS_NOT_EXECUTED });
+                queue_route_op(route_bulker_, ctx.route_ops.back(), pfx, SAI_NULL_OBJECT_ID);
             }
         }
+    }
+
+    return VNetRouteTaskStatus::PENDING;
+}
+
+bool VNetRouteOrch::addTunnelRoutePost(VNetRouteBulkContext& ctx)
+{
+    SWSS_LOG_ENTER();
+
+    const string& vnet = ctx.vnet;
+    IpPrefix& ipPrefix = ctx.ip_prefix;
+    NextHopGroupKey& nexthops = ctx.nexthops;
 
+    auto *vrf_obj = vnet_orch_->getTypePtr<VNetVrfObject>(vnet);
+    sai_ip_prefix_t pfx;
+    copy(pfx, ipPrefix);
+
+    bool route_status = true;
+    for (const auto& route_op : ctx.route_ops)
+    {
+        if (!check_route_op(route_op, pfx))
+        {
+            SWSS_LOG_ERROR("Route %s failed for %s, vr_id '0x%" PRIx64,
+                           ctx.op == SET_COMMAND ? "add/update" : "del",
+                           ipPrefix.to_string().c_str(), route_op.vr_id);
+            /* A failure to remove the route of a group without active member is not fatal */
+            if (ctx.op == DEL_COMMAND || route_op.type != VNetRouteBulkOp::DEL)
+            {
+                route_status = false;
+            }
+        }
+    }
+
+    if (ctx.op == SET_COMMAND)
+    {
+        if (!route_status)
+        {
+            /* Clean up the newly created next hop group entry */
+            if (ctx.nhg_created)
+            {
+                releaseNextHopGroup(vnet, nexthops, ipPrefix);
+            }
+            return false;
+        }
+
+        auto it_route = syncd_tunnel_routes_[vnet].find(ipPrefix);
         if (it_route != syncd_tunnel_routes_[vnet].end() && it_route->second != nexthops)
         {
             // In case of updating an existing route, decrease the reference count for the previous nexthop group if not same as new nhg
             NextHopGroupKey nhg = it_route->second;
             if (--syncd_nexthop_groups_[vnet][nhg].ref_count == 0)
             {
-                if (nhg.getSize() > 1)
-                {
-                    removeNextHopGroup(vnet, nhg, vrf_obj);
-                }
-                else
-                {
-                    syncd_nexthop_groups_[vnet].erase(nhg);
-                    NextHopKey nexthop(nhg.to_string(), true);
-                    vrf_obj->removeTunnelNextHop(nexthop);
-                }
-                delEndpointMonitor(vnet, nhg, ipPrefix);
+                releaseNextHopGroup(vnet, nhg, ipPrefix);
             }
             else
             {
@@ -1052,50 +1190,25 @@ bool VNetRouteOrch::doRouteTask<VNetVrfObject>(const string& vnet, IpPrefix& ipP
             syncd_nexthop_groups_[vnet][nexthops].ref_count++;
             vrf_obj->addRoute(ipPrefix, nexthops);
         }
-        if (!profile.empty())
+        if (!ctx.profile.empty())
         {
-            vrf_obj->addProfile(ipPrefix, profile);
+            vrf_obj->addProfile(ipPrefix, ctx.profile);
         }
 
-        postRouteState(vnet, ipPrefix, nexthops, profile);
+        postRouteState(vnet, ipPrefix, nexthops, ctx.profile);
     }
-    else if (op == DEL_COMMAND)
+    else if (ctx.op == DEL_COMMAND)
     {
-        auto it_route = syncd_tunnel_routes_[vnet].find(ipPrefix);
-        if (it_route == syncd_tunnel_routes_[vnet].end())
+        if (!route_status)
         {
-            SWSS_LOG_INFO("Failed to find tunnel route entry, prefix %s\n",
-                ipPrefix.to_string().c_str());
-            return true;
+            return false;
         }
-        NextHopGroupKey nhg = it_route->second;
 
-        for (auto vr_id : vr_set)
-        {
-            // If an nhg has no active member, the route should already be removed
-            if (!syncd_nexthop_groups_[vnet][nhg].active_members.empty())
-            {
-                if (!del_route(vr_id, pfx))
-                {
-                    SWSS_LOG_ERROR("Route del failed for %s, vr_id '0x%" PRIx64, ipPrefix.to_string().c_str(), vr_id);
-                    return false;
-                }
-            }
-        }
+        NextHopGroupKey nhg = syncd_tunnel_routes_[vnet][ipPrefix];
 
         if(--syncd_nexthop_groups_[vnet][nhg].ref_count == 0)
         {
-            if (nhg.getSize() > 1)
-            {
-                removeNextHopGroup(vnet, nhg, vrf_obj);
-            }
-            else
-            {
-                syncd_nexthop_groups_[vnet].erase(nhg);
-                NextHopKey nexthop(nhg.to_string(), true);
-                vrf_obj->removeTunnelNextHop(nexthop);
-            }
-            delEndpointMonitor(vnet, nhg, ipPrefix);
+            releaseNextHopGroup(vnet, nhg, ipPrefix);
         }
         else
         {
@@ -1117,6 +1230,51 @@ bool VNetRouteOrch::doRouteTask<VNetVrfObject>(const string& vnet, IpPrefix& ipP
     return true;
 }
 
+void VNetRouteOrch::releaseNextHopGroup(const string& vnet, const NextHopGroupKey& nexthops, const IpPrefix& ipPrefix)
+{
+    released_nhgs_.emplace_back(vnet, nexthops, ipPrefix);
+}
+
+void VNetRouteOrch::removeReleasedNextHopGroups()
+{
+    SWSS_LOG_ENTER();
+
+    for (auto& released : released_nhgs_)
+    {
+        const string& vnet = get<0>(released);
+        NextHopGroupKey& nhg = get<1>(released);
+        IpPrefix& ipPrefix = get<2>(released);
+
+        auto it_nhg = syncd_nexthop_groups_[vnet].find(nhg);
+        if (it_nhg == syncd_nexthop_groups_[vnet].end())
+        {
+            continue;
+        }
+
+        if (it_nhg->second.ref_count != 0)
+        {
+            /* Picked up again by another route of the same bulk */
+            it_nhg->second.tunnel_routes.erase(ipPrefix);
+            continue;
+        }
+
+        auto *vrf_obj = vnet_orch_->getTypePtr<VNetVrfObject>(vnet);
+        if (nhg.getSize() > 1)
+        {
+            removeNextHopGroup(vnet, nhg, vrf_obj);
+        }
+        else
+        {
+            syncd_nexthop_groups_[vnet].erase(nhg);
+            NextHopKey nexthop(nhg.to_string(), true);
+            vrf_obj->removeTunnelNextHop(nexthop);
+        }
+        delEndpointMonitor(vnet, nhg, ipPrefix);
+    }
+
+    released_nhgs_.clear();
+}
+
 bool VNetRouteOrch::updateTunnelRoute(const string& vnet, IpPrefix& ipPrefix,
                                 NextHopGroupKey& nexthops, string& op)
 {
@@ -1996,7 +2154,7 @@ void VNetRouteOrch::updateVnetTunnel(const BfdUpdate& update)
     }
 }
 
-bool VNetRouteOrch::handleTunnel(const Request& request)
+bool VNetRouteOrch::parseTunnelRequest(const Request& request, VNetRouteBulkContext& ctx)
 {
     SWSS_LOG_ENTER();
 
@@ -2076,8 +2234,14 @@ bool VNetRouteOrch::handleTunnel(const Request& request)
     SWSS_LOG_INFO("VNET-RT '%s' op '%s' for pfx %s", vnet_name.c_str(),
                    op.c_str(), ip_pfx.to_string().c_str());
 
-    NextHopGroupKey nhg("", true);
-    map<NextHopKey, IpAddress> monitors;
+    ctx.vnet = vnet_name;
+    ctx.ip_prefix = ip_pfx;
+    ctx.op = op;
+    ctx.profile = profile;
+    ctx.monitoring = monitoring;
+
+    NextHopGroupKey& nhg = ctx.nexthops;
+    map<NextHopKey, IpAddress>& monitors = ctx.monitors;
     for (size_t idx_ip = 0; idx_ip < ip_list.size(); idx_ip++)
     {
         IpAddress ip = ip_list[idx_ip];
@@ -2105,12 +2269,94 @@ bool VNetRouteOrch::handleTunnel(const Request& request)
         }
     }
 
-    if (vnet_orch_->isVnetExecVrf())
+    return true;
+}
+
+bool VNetRouteOrch::handleTunnel(const Request& request)
+{
+    SWSS_LOG_ENTER();
+
+    VNetRouteBulkContext ctx;
+    if (!parseTunnelRequest(request, ctx))
     {
-        return doRouteTask<VNetVrfObject>(vnet_name, ip_pfx, nhg, op, profile, monitoring, monitors);
+        return false;
     }
 
-    return true;
+    if (!vnet_orch_->isVnetExecVrf())
+    {
+        return true;
+    }
+
+    auto status = addTunnelRouteBulk(ctx);
+    if (status != VNetRouteTaskStatus::PENDING)
+    {
+        return status == VNetRouteTaskStatus::DONE;
+    }
+
+    route_bulker_.flush();
+    bool rc = addTunnelRoutePost(ctx);
+    removeReleasedNextHopGroups();
+
+    return rc;
+}
+
+/* Queue the route entries of a tunnel route request, ctx.queued is set when there are any */
+bool VNetRouteOrch::queueTunnelRoute(const Request& request, VNetRouteBulkContext& ctx)
+{
+    SWSS_LOG_ENTER();
+
+    if (!parseTunnelRequest(request, ctx))
+    {
+        return false;
+    }
+
+    VNetRouteTaskStatus status = VNetRouteTaskStatus::FAILED;
+    try
+    {
+        status = addTunnelRouteBulk(ctx);
+    }
+    catch (...)
+    {
+        /* Route entries queued before the exception are completed by the flush */
+        ctx.queued = !ctx.route_ops.empty();
+        throw;
+    }
+
+    ctx.queued = (status == VNetRouteTaskStatus::PENDING);
+    return status == VNetRouteTaskStatus::DONE;
+}
+
+void VNetRouteOrch::addOperations(std::vector<Orch2BulkRequest>& requests)
+{
+    SWSS_LOG_ENTER();
+
+    /* Only the tunnel routes of VRF based VNETs are programmed in bulk */
+    if (requests.front().request.getTableName() != APP_VNET_RT_TUNNEL_TABLE_NAME || !vnet_orch_->isVnetExecVrf())
+    {
+        Orch2::addOperations(requests);
+        return;
+    }
+
+    /*
+     * The route entries of a prefix are shared with the peer VNETs, a request
+     * for a prefix which is already queued is retried after the batch
+     */
+    set<IpPrefix> queued_prefixes;
+
+    addOperationsInBulk<VNetRouteBulkContext>(requests,
+        [this, &queued_prefixes](const Request& request, VNetRouteBulkContext& ctx) {
+            auto ip_pfx = request.getKeyIpPrefix(1);
+            if (queued_prefixes.find(ip_pfx) != queued_prefixes.end())
+            {
+                return false;
+            }
+            queued_prefixes.insert(ip_pfx);
+            return queueTunnelRoute(request, ctx);
+        },
+        [this]() { route_bulker_.flush(); },
+        [this](VNetRouteBulkContext& ctx) { return addTunnelRoutePost(ctx); });
+
+    removeReleasedNextHopGroups();
 }
 
 bool VNetRouteOrch::addOperation(const Request& request)
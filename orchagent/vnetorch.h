@@ -14,6 +14,7 @@
 #include "observer.h"
 #include "nexthopgroupkey.h"
 #include "bfdorch.h"
+#include "bulker.h"
 
 #define VNET_BITMAP_SIZE 32
 #define VNET_TUNNEL_SIZE 40960
@@ -357,10 +358,51 @@ typedef std::map<IpAddress, BfdSessionInfo> BfdSessionTable;
 typedef std::map<IpPrefix, std::map<NextHopKey, MonitorSessionInfo>> MonitorSessionTable;
 typedef std::map<IpAddress, VNetNextHopInfo> VNetEndpointInfoTable;
 
+/* Route entry operation queued in the route bulker for one VRF */
+struct VNetRouteBulkOp
+{
+    enum Type { ADD, DEL, UPDATE };
+
+    Type            type;
+    sai_object_id_t vr_id;
+    sai_status_t    status;
+};
+
+/* Tunnel route request in flight, from the queueing of its route entries to the bulk flush */
+struct VNetRouteBulkContext
+{
+    std::string                     vnet;
+    IpPrefix                        ip_prefix;
+    NextHopGroupKey                 nexthops;
+    std::string                     op;
+    std::string                     profile;
+    std::string                     monitoring;
+    std::map<NextHopKey, IpAddress> monitors;
+
+    /* Sized before queueing, the bulker keeps pointers to the statuses */
+    std::vector<VNetRouteBulkOp>    route_ops;
+    /* The next hop group was created for this request */
+    bool                            nhg_created = false;
+    /* Route entries were queued, the request is completed after the flush */
+    bool                            queued = false;
+
+    VNetRouteBulkContext() : nexthops("", true)
+    {
+    }
+};
+
+enum class VNetRouteTaskStatus
+{
+    DONE,
+    FAILED,
+    PENDING
+};
+
 class VNetRouteOrch : public Orch2, public Subject, public Observer
 {
 public:
     VNetRouteOrch(DBConnector *db, vector<string> &tableNames, VNetOrch *);
+    using Orch::doTask;
 
     typedef pair<string, bool (VNetRouteOrch::*) (const Request& )> handler_pair;
     typedef map<string, bool (VNetRouteOrch::*) (const Request& )> handler_map;
@@ -373,6 +415,7 @@ public:
 private:
     virtual bool addOperation(const Request& request);
     virtual bool delOperation(const Request& request);
+    void addOperations(std::vector<Orch2BulkRequest>& requests) override;
 
     void addRoute(const std::string & vnet, const IpPrefix & ipPrefix, const nextHop& nh);
     void delRoute(const IpPrefix& ipPrefix);
@@ -400,10 +443,12 @@ private:
     void updateVnetTunnel(const BfdUpdate&);
     bool updateTunnelRoute(const string& vnet, IpPrefix& ipPrefix, NextHopGroupKey& nexthops, string& op);
 
-    template<typename T>
-    bool doRouteTask(const string& vnet, IpPrefix& ipPrefix, NextHopGroupKey& nexthops, string& op, string& profile,
-                    const string& monitoring,
-                    const std::map<NextHopKey, IpAddress>& monitors=std::map<NextHopKey, IpAddress>());
+    bool parseTunnelRequest(const Request&, VNetRouteBulkContext&);
+    VNetRouteTaskStatus addTunnelRouteBulk(VNetRouteBulkContext&);
+    bool queueTunnelRoute(const Request&, VNetRouteBulkContext&);
+    bool addTunnelRoutePost(VNetRouteBulkContext&);
+    void releaseNextHopGroup(const string& vnet, const NextHopGroupKey& nexthops, const IpPrefix& ipPrefix);
+    void removeReleasedNextHopGroups();
 
     template<typename T>
     bool doRouteTask(const string& vnet, IpPrefix& ipPrefix, nextHop& nh, string& op);
@@ -425,6 +470,11 @@ private:
     shared_ptr<DBConnector> app_db_;
     unique_ptr<Table> state_vnet_rt_tunnel_table_;
     unique_ptr<Table> state_vnet_rt_adv_table_;
+
+    EntityBulker<sai_route_api_t> route_bulker_;
+    ObjectBulker<sai_next_hop_group_api_t> nhgm_bulker_;
+    /* Next hop groups dropped by routes, removed once the route bulk is flushed: vnet, group, prefix */
+    std::vector<std::tuple<std::string, NextHopGroupKey, IpPrefix>> released_nhgs_;
 };
 
 class VNetCfgRouteOrch : public Orch
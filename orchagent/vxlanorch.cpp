@@ -26,10 +26,13 @@ extern sai_object_id_t gSwitchId;
 extern sai_object_id_t gVirtualRouterId;
 extern sai_tunnel_api_t *sai_tunnel_api;
 extern sai_next_hop_api_t *sai_next_hop_api;
+extern sai_vlan_api_t *sai_vlan_api;
+extern size_t gMaxBulkSize;
 extern Directory<Orch*> gDirectory;
 extern PortsOrch*       gPortsOrch;
 extern sai_object_id_t  gUnderlayIfId;
 extern FlexManagerDirectory g_FlexManagerDirectory;
+extern bool gNativeCounterRates;
 
 #define FLEX_COUNTER_UPD_INTERVAL 1
 
@@ -160,17 +163,16 @@ remove_tunnel_map(sai_object_id_t tunnel_map_id)
     }
 }
 
-static sai_object_id_t create_tunnel_map_entry(
+static std::vector<sai_attribute_t> get_tunnel_map_entry_attrs(
     MAP_T map_t,
     sai_object_id_t tunnel_map_id,
     sai_uint32_t vni,
     sai_uint16_t vlan_id,
-    sai_object_id_t obj_id=SAI_NULL_OBJECT_ID,
-    bool encap=false
+    sai_object_id_t obj_id,
+    bool encap
     )
 {
     sai_attribute_t attr;
-    sai_object_id_t tunnel_map_entry_id;
     std::vector<sai_attribute_t> tunnel_map_entry_attrs;
 
     attr.id = SAI_TUNNEL_MAP_ENTRY_ATTR_TUNNEL_MAP_TYPE;
@@ -197,6 +199,21 @@ static sai_object_id_t create_tunnel_map_entry(
     attr.value.u32 = vni;
     tunnel_map_entry_attrs.push_back(attr);
 
+    return tunnel_map_entry_attrs;
+}
+
+static sai_object_id_t create_tunnel_map_entry(
+    MAP_T map_t,
+    sai_object_id_t tunnel_map_id,
+    sai_uint32_t vni,
+    sai_uint16_t vlan_id,
+    sai_object_id_t obj_id=SAI_NULL_OBJECT_ID,
+    bool encap=false
+    )
+{
+    sai_object_id_t tunnel_map_entry_id;
+    auto tunnel_map_entry_attrs = get_tunnel_map_entry_attrs(map_t, tunnel_map_id, vni, vlan_id, obj_id, encap);
+
     sai_status_t status = sai_tunnel_api->create_tunnel_map_entry(&tunnel_map_entry_id, gSwitchId,
                                             static_cast<uint32_t> (tunnel_map_entry_attrs.size()),
                                             tunnel_map_entry_attrs.data());
@@ -209,6 +226,24 @@ static sai_object_id_t create_tunnel_map_entry(
     return tunnel_map_entry_id;
 }
 
+/* Queue a tunnel map entry, its id is set by the flush of the bulker, or left null on failure */
+static void create_tunnel_map_entry_bulk(
+    ObjectBulker<sai_tunnel_api_t>& bulker,
+    sai_object_id_t *tunnel_map_entry_id,
+    MAP_T map_t,
+    sai_object_id_t tunnel_map_id,
+    sai_uint32_t vni,
+    sai_uint16_t vlan_id,
+    sai_object_id_t obj_id=SAI_NULL_OBJECT_ID,
+    bool encap=false
+    )
+{
+    auto tunnel_map_entry_attrs = get_tunnel_map_entry_attrs(map_t, tunnel_map_id, vni, vlan_id, obj_id, encap);
+
+    bulker.create_entry(tunnel_map_entry_id, static_cast<uint32_t> (tunnel_map_entry_attrs.size()),
+                        tunnel_map_entry_attrs.data());
+}
+
 void remove_tunnel_map_entry(sai_object_id_t obj_id)
 {
     sai_status_t status = SAI_STATUS_SUCCESS;
@@ -508,6 +543,22 @@ sai_object_id_t VxlanTunnel::addDecapMapperEntry(sai_object_id_t obj, uint32_t v
     return create_tunnel_map_entry(map_t, decap_id, vni, 0, obj);
 }
 
+void VxlanTunnel::addEncapMapperEntryBulk(ObjectBulker<sai_tunnel_api_t>& bulker, sai_object_id_t *entry_id,
+                                          sai_object_id_t obj, uint32_t vni, tunnel_map_type_t type)
+{
+    const auto encap_id = getEncapMapId(type);
+    const auto map_t = tunnel_map_type(type,true);
+    create_tunnel_map_entry_bulk(bulker, entry_id, map_t, encap_id, vni, 0, obj, true);
+}
+
+void VxlanTunnel::addDecapMapperEntryBulk(ObjectBulker<sai_tunnel_api_t>& bulker, sai_object_id_t *entry_id,
+                                          sai_object_id_t obj, uint32_t vni, tunnel_map_type_t type)
+{
+    const auto decap_id = getDecapMapId(type);
+    const auto map_t = tunnel_map_type(type,false);
+    create_tunnel_map_entry_bulk(bulker, entry_id, map_t, decap_id, vni, 0, obj);
+}
+
 void VxlanTunnel::insertMapperEntry(sai_object_id_t encap, sai_object_id_t decap, uint32_t vni)
 {
     tunnel_map_entries_[vni] = std::pair<sai_object_id_t, sai_object_id_t>(encap, decap);
@@ -1202,15 +1253,19 @@ VxlanTunnelOrch::VxlanTunnelOrch(DBConnector *statedb, DBConnector *db, const st
     string tunnel_rate_plugin = "tunnel_rates.lua";
     m_counter_db = shared_ptr<DBConnector>(new DBConnector("COUNTERS_DB", 0));
     m_asic_db = shared_ptr<DBConnector>(new DBConnector("ASIC_DB", 0));
-    try
-    {
-        string tunnel_rate_script = swss::loadLuaScript(tunnel_rate_plugin);
-        string tunnel_rate_sha = swss::loadRedisScript(m_counter_db.get(), tunnel_rate_script);
-        fv = FieldValueTuple(TUNNEL_PLUGIN_FIELD, tunnel_rate_sha);
-    }
-    catch (const runtime_error &e)
+    /* Tunnel rates are computed by CounterRateOrch in native mode */
+    if (!gNativeCounterRates)
     {
-        SWSS_LOG_WARN("Tunnel flex counter group plugins was not set successfully: %s", e.what());
+        try
+        {
+            string tunnel_rate_script = swss::loadLuaScript(tunnel_rate_plugin);
+            string tunnel_rate_sha = swss::loadRedisScript(m_counter_db.get(), tunnel_rate_script);
+            fv = FieldValueTuple(TUNNEL_PLUGIN_FIELD, tunnel_rate_sha);
+        }
+        catch (const runtime_error &e)
+        {
+            SWSS_LOG_WARN("Tunnel flex counter group plugins was not set successfully: %s", e.what());
+        }
     }
 
     tunnel_stat_manager = g_FlexManagerDirectory.createFlexCounterManager(TUNNEL_STAT_COUNTER_FLEX_COUNTER_GROUP,
@@ -1897,10 +1952,42 @@ bool VxlanTunnel::isTunnelReferenced()
 
 //------------------- VXLAN_TUNNEL_MAP Table --------------------------//
 
+VxlanTunnelMapOrch::VxlanTunnelMapOrch(DBConnector *db, const std::string& tableName) :
+    Orch2(db, tableName, request_),
+    tunnel_map_entry_bulker_(sai_tunnel_api, gSwitchId, gMaxBulkSize)
+{
+    setBulkMode(true);
+}
+
+void VxlanTunnelMapOrch::addOperations(std::vector<Orch2BulkRequest>& requests)
+{
+    SWSS_LOG_ENTER();
+
+    addOperationsInBulk<VxlanTunnelMapBulkContext>(requests,
+        [this](const Request& request, VxlanTunnelMapBulkContext& ctx) { return addOperationBulk(request, ctx); },
+        [this]() { tunnel_map_entry_bulker_.flush(); },
+        [this](VxlanTunnelMapBulkContext& ctx) { return addOperationPost(ctx); });
+}
+
 bool VxlanTunnelMapOrch::addOperation(const Request& request)
 {
     SWSS_LOG_ENTER();
 
+    VxlanTunnelMapBulkContext ctx;
+    bool done = addOperationBulk(request, ctx);
+    if (!ctx.queued)
+    {
+        return done;
+    }
+
+    tunnel_map_entry_bulker_.flush();
+    return addOperationPost(ctx);
+}
+
+bool VxlanTunnelMapOrch::addOperationBulk(const Request& request, VxlanTunnelMapBulkContext& ctx)
+{
+    SWSS_LOG_ENTER();
+
     sai_vlan_id_t vlan_id = (sai_vlan_id_t)request.getAttrVlan("vlan");
     Port tempPort;
     bool isL3Vni = false;
@@ -1978,32 +2065,58 @@ bool VxlanTunnelMapOrch::addOperation(const Request& request)
     VRFOrch* vrf_orch = gDirectory.get<VRFOrch*>();
     isL3Vni = vrf_orch->isL3VniVlan(vni_id);
 
-    try
+    ctx.full_name = full_tunnel_map_entry_name;
+    ctx.tunnel_name = tunnel_name;
+    ctx.entry_name = tunnel_map_entry_name;
+    ctx.vlan_id = vlan_id;
+    ctx.vni_id = vni_id;
+
+    /* The L3 VNI VLANs are mapped by the VRF map */
+    if (isL3Vni)
     {
-        if (isL3Vni == false)
-        {
-            auto tunnel_map_entry_id = create_tunnel_map_entry(MAP_T::VNI_TO_VLAN_ID,
-                                                               tunnel_map_id, vni_id, vlan_id);
-            vxlan_tunnel_map_table_[full_tunnel_map_entry_name].map_entry_id = tunnel_map_entry_id;
-        }
-        else
-        {
-            vxlan_tunnel_map_table_[full_tunnel_map_entry_name].map_entry_id = SAI_NULL_OBJECT_ID;
-        }
-        vxlan_tunnel_map_table_[full_tunnel_map_entry_name].vlan_id = vlan_id;
-        vxlan_tunnel_map_table_[full_tunnel_map_entry_name].vni_id = vni_id;
+        return addTunnelMapEntry(ctx);
     }
-    catch(const std::runtime_error& error)
+
+    create_tunnel_map_entry_bulk(tunnel_map_entry_bulker_, &ctx.map_entry_id, MAP_T::VNI_TO_VLAN_ID,
+                                 tunnel_map_id, vni_id, vlan_id);
+    ctx.queued = true;
+
+    return true;
+}
+
+bool VxlanTunnelMapOrch::addOperationPost(VxlanTunnelMapBulkContext& ctx)
+{
+    SWSS_LOG_ENTER();
+
+    if (ctx.map_entry_id == SAI_NULL_OBJECT_ID)
     {
-        SWSS_LOG_WARN("Error adding tunnel map entry. Tunnel: %s. Entry: %s. Error: %s",
-            tunnel_name.c_str(), tunnel_map_entry_name.c_str(), error.what());
+        SWSS_LOG_WARN("Error adding tunnel map entry. Tunnel: %s. Entry: %s. Error: Can't create a tunnel map entry object",
+            ctx.tunnel_name.c_str(), ctx.entry_name.c_str());
+
+        /* Counted again when the request is retried */
+        VxlanTunnelOrch* tunnel_orch = gDirectory.get<VxlanTunnelOrch*>();
+        if (tunnel_orch->isTunnelExists(ctx.tunnel_name))
+        {
+            tunnel_orch->getVxlanTunnel(ctx.tunnel_name)->vlan_vrf_vni_count--;
+        }
         return false;
     }
 
-    tunnel_orch->addVlanMappedToVni(vni_id, vlan_id);
+    return addTunnelMapEntry(ctx);
+}
+
+bool VxlanTunnelMapOrch::addTunnelMapEntry(const VxlanTunnelMapBulkContext& ctx)
+{
+    auto& entry = vxlan_tunnel_map_table_[ctx.full_name];
+    entry.map_entry_id = ctx.map_entry_id;
+    entry.vlan_id = ctx.vlan_id;
+    entry.vni_id = ctx.vni_id;
+
+    VxlanTunnelOrch* tunnel_orch = gDirectory.get<VxlanTunnelOrch*>();
+    tunnel_orch->addVlanMappedToVni(ctx.vni_id, ctx.vlan_id);
 
     SWSS_LOG_NOTICE("Vxlan tunnel map entry '%s' for tunnel '%s' was created",
-                   tunnel_map_entry_name.c_str(), tunnel_name.c_str());
+                   ctx.entry_name.c_str(), ctx.tunnel_name.c_str());
 
     return true;
 }
@@ -2132,7 +2245,39 @@ bool VxlanTunnelMapOrch::delOperation(const Request& request)
 
 //------------------- VXLAN_VRF_MAP Table --------------------------//
 
+VxlanVrfMapOrch::VxlanVrfMapOrch(DBConnector *db, const std::string& tableName) :
+    Orch2(db, tableName, request_),
+    tunnel_map_entry_bulker_(sai_tunnel_api, gSwitchId, gMaxBulkSize)
+{
+    setBulkMode(true);
+}
+
+void VxlanVrfMapOrch::addOperations(std::vector<Orch2BulkRequest>& requests)
+{
+    SWSS_LOG_ENTER();
+
+    addOperationsInBulk<VxlanVrfMapBulkContext>(requests,
+        [this](const Request& request, VxlanVrfMapBulkContext& ctx) { return addOperationBulk(request, ctx); },
+        [this]() { tunnel_map_entry_bulker_.flush(); },
+        [this](VxlanVrfMapBulkContext& ctx) { return addOperationPost(ctx); });
+}
+
 bool VxlanVrfMapOrch::addOperation(const Request& request)
+{
+    SWSS_LOG_ENTER();
+
+    VxlanVrfMapBulkContext ctx;
+    bool done = addOperationBulk(request, ctx);
+    if (!ctx.queued)
+    {
+        return done;
+    }
+
+    tunnel_map_entry_bulker_.flush();
+    return addOperationPost(ctx);
+}
+
+bool VxlanVrfMapOrch::addOperationBulk(const Request& request, VxlanVrfMapBulkContext& ctx)
 {
     SWSS_LOG_ENTER();
     std::string vniVlanMapName;
@@ -2200,7 +2345,7 @@ bool VxlanVrfMapOrch::addOperation(const Request& request)
     }
 
     const auto tunnel_map_entry_name = request.getKeyString(1);
-    vrf_map_entry_t entry;
+    auto& entry = ctx.entry;
     try
     {
         entry.isL2Vni = vxlan_tun_map_orch->isVniVlanMapExists(vni_id, vniVlanMapName, &tnl_map_entry_id, &vlan_id);
@@ -2210,21 +2355,10 @@ bool VxlanVrfMapOrch::addOperation(const Request& request)
             entry.vniVlanMapName = vniVlanMapName;
             entry.vlan_id = vlan_id;
             remove_tunnel_map_entry(tnl_map_entry_id);
+            /* Not removed again if the mappers fail and the request is retried */
+            vxlan_tun_map_orch->updateTnlMapId(vniVlanMapName, SAI_NULL_OBJECT_ID);
             SWSS_LOG_DEBUG("remove_tunnel_map_entry name %s, vlan %d, vni %d\n", entry.vniVlanMapName.c_str(), entry.vlan_id, entry.vni_id);
         }
-        /*
-         * Create encap and decap mapper
-         */
-        entry.encap_id = tunnel_obj->addEncapMapperEntry(vrf_id, vni_id);
-        vrf_orch->increaseVrfRefCount(vrf_name);
-        entry.decap_id = tunnel_obj->addDecapMapperEntry(vrf_id, vni_id);
-        vrf_orch->increaseVrfRefCount(vrf_name);
-
-        SWSS_LOG_DEBUG("Vxlan tunnel encap entry '%" PRIx64 "' decap entry '0x%" PRIx64 "'",
-                entry.encap_id, entry.decap_id);
-
-        vxlan_vrf_table_[full_map_entry_name] = entry;
-        vxlan_vrf_tunnel_[vrf_name] = tunnel_obj->getTunnelId();
     }
     catch(const std::runtime_error& error)
     {
@@ -2233,8 +2367,58 @@ bool VxlanVrfMapOrch::addOperation(const Request& request)
         return false;
     }
 
+    ctx.full_name = full_map_entry_name;
+    ctx.tunnel_name = tunnel_name;
+    ctx.entry_name = tunnel_map_entry_name;
+    ctx.vrf_name = vrf_name;
+
+    /*
+     * Create encap and decap mapper
+     */
+    tunnel_obj->addEncapMapperEntryBulk(tunnel_map_entry_bulker_, &entry.encap_id, vrf_id, vni_id);
+    tunnel_obj->addDecapMapperEntryBulk(tunnel_map_entry_bulker_, &entry.decap_id, vrf_id, vni_id);
+    ctx.queued = true;
+
+    return true;
+}
+
+bool VxlanVrfMapOrch::addOperationPost(VxlanVrfMapBulkContext& ctx)
+{
+    SWSS_LOG_ENTER();
+
+    auto& entry = ctx.entry;
+    if (entry.encap_id == SAI_NULL_OBJECT_ID || entry.decap_id == SAI_NULL_OBJECT_ID)
+    {
+        SWSS_LOG_ERROR("Error adding tunnel map entry. Tunnel: %s. Entry: %s. Error: Can't create a tunnel map entry object",
+            ctx.tunnel_name.c_str(), ctx.entry_name.c_str());
+
+        /* Both mappers are created again when the request is retried */
+        try
+        {
+            remove_tunnel_map_entry(entry.encap_id);
+            remove_tunnel_map_entry(entry.decap_id);
+        }
+        catch(const std::runtime_error& error)
+        {
+            SWSS_LOG_ERROR("Error removing tunnel map entry. Tunnel: %s. Entry: %s. Error: %s",
+                ctx.tunnel_name.c_str(), ctx.entry_name.c_str(), error.what());
+        }
+        return false;
+    }
+
+    VRFOrch* vrf_orch = gDirectory.get<VRFOrch*>();
+    vrf_orch->increaseVrfRefCount(ctx.vrf_name);
+    vrf_orch->increaseVrfRefCount(ctx.vrf_name);
+
+    SWSS_LOG_DEBUG("Vxlan tunnel encap entry '%" PRIx64 "' decap entry '0x%" PRIx64 "'",
+            entry.encap_id, entry.decap_id);
+
+    VxlanTunnelOrch* tunnel_orch = gDirectory.get<VxlanTunnelOrch*>();
+    vxlan_vrf_table_[ctx.full_name] = entry;
+    vxlan_vrf_tunnel_[ctx.vrf_name] = tunnel_orch->getVxlanTunnel(ctx.tunnel_name)->getTunnelId();
+
     SWSS_LOG_NOTICE("Vxlan vrf map entry '%s' for tunnel '%s' was created",
-                    tunnel_map_entry_name.c_str(), tunnel_name.c_str());
+                    ctx.entry_name.c_str(), ctx.tunnel_name.c_str());
     return true;
 }
 
@@ -2329,10 +2513,42 @@ bool VxlanVrfMapOrch::delOperation(const Request& request)
 
 //------------------- EVPN_REMOTE_VNI Table --------------------------//
 
+EvpnRemoteVnip2pOrch::EvpnRemoteVnip2pOrch(DBConnector *db, const std::string& tableName) :
+    Orch2(db, tableName, request_),
+    vlan_member_bulker_(sai_vlan_api, gSwitchId, gMaxBulkSize)
+{
+    setBulkMode(true);
+}
+
+void EvpnRemoteVnip2pOrch::addOperations(std::vector<Orch2BulkRequest>& requests)
+{
+    SWSS_LOG_ENTER();
+
+    addOperationsInBulk<EvpnRemoteVniBulkContext>(requests,
+        [this](const Request& request, EvpnRemoteVniBulkContext& ctx) { return addOperationBulk(request, ctx); },
+        [this]() { vlan_member_bulker_.flush(); },
+        [this](EvpnRemoteVniBulkContext& ctx) { return addOperationPost(ctx); });
+}
+
 bool EvpnRemoteVnip2pOrch::addOperation(const Request& request)
 {
     SWSS_LOG_ENTER();
 
+    EvpnRemoteVniBulkContext ctx;
+    bool done = addOperationBulk(request, ctx);
+    if (!ctx.queued)
+    {
+        return done;
+    }
+
+    vlan_member_bulker_.flush();
+    return addOperationPost(ctx);
+}
+
+bool EvpnRemoteVnip2pOrch::addOperationBulk(const Request& request, EvpnRemoteVniBulkContext& ctx)
+{
+    SWSS_LOG_ENTER();
+
     // Extract DIP and tunnel
     auto remote_vtep = request.getKeyString(1);
 
@@ -2396,13 +2612,32 @@ bool EvpnRemoteVnip2pOrch::addOperation(const Request& request)
         return false;
     }
 
-    // SAI Call to add tunnel to the VLAN flood domain
+    // SAI Call to add tunnel to the VLAN flood domain, completed by addOperationPost
+
+    ctx.remote_vtep = remote_vtep;
+    ctx.vlan_alias = vlanPort.m_alias;
+    ctx.port_alias = tunnelPort.m_alias;
+    ctx.vlan_id = vlan_id;
+    ctx.vni_id = vni_id;
+
+    gPortsOrch->addVlanMemberBulk(vlan_member_bulker_, vlanPort, tunnelPort, "untagged", &ctx.vlan_member_id);
+    ctx.queued = true;
 
-    string tagging_mode = "untagged"; 
-    gPortsOrch->addVlanMember(vlanPort, tunnelPort, tagging_mode);
+    return true;
+}
+
+bool EvpnRemoteVnip2pOrch::addOperationPost(EvpnRemoteVniBulkContext& ctx)
+{
+    SWSS_LOG_ENTER();
+
+    string tagging_mode = "untagged";
+    if (!gPortsOrch->addVlanMemberPost(ctx.vlan_alias, ctx.port_alias, tagging_mode, ctx.vlan_member_id))
+    {
+        SWSS_LOG_ERROR("Failed to add remote_vtep=%s to vlanid=%d", ctx.remote_vtep.c_str(), ctx.vlan_id);
+    }
 
     SWSS_LOG_INFO("remote_vtep=%s vni=%d vlanid=%d ",
-                   remote_vtep.c_str(), vni_id, vlan_id);
+                   ctx.remote_vtep.c_str(), ctx.vni_id, ctx.vlan_id);
 
     return true;
 }
@@ -8,6 +8,7 @@
 #include "portsorch.h"
 #include "vrforch.h"
 #include "timer.h"
+#include "bulker.h"
 
 enum class MAP_T
 {
@@ -153,6 +154,12 @@ public:
                                         tunnel_map_type_t type=TUNNEL_MAP_T_VIRTUAL_ROUTER);
     sai_object_id_t addDecapMapperEntry(sai_object_id_t obj, uint32_t vni,
                                         tunnel_map_type_t type=TUNNEL_MAP_T_VIRTUAL_ROUTER);
+    void addEncapMapperEntryBulk(ObjectBulker<sai_tunnel_api_t>& bulker, sai_object_id_t *entry_id,
+                                 sai_object_id_t obj, uint32_t vni,
+                                 tunnel_map_type_t type=TUNNEL_MAP_T_VIRTUAL_ROUTER);
+    void addDecapMapperEntryBulk(ObjectBulker<sai_tunnel_api_t>& bulker, sai_object_id_t *entry_id,
+                                 sai_object_id_t obj, uint32_t vni,
+                                 tunnel_map_type_t type=TUNNEL_MAP_T_VIRTUAL_ROUTER);
 
     void insertMapperEntry(sai_object_id_t encap, sai_object_id_t decap, uint32_t vni);
     std::pair<sai_object_id_t, sai_object_id_t> getMapperEntry(uint32_t vni);
@@ -401,10 +408,22 @@ public:
     VxlanTunnelMapRequest() : Request(vxlan_tunnel_map_request_description, ':') { }
 };
 
+/* VXLAN_TUNNEL_MAP request whose tunnel map entry is created in bulk */
+struct VxlanTunnelMapBulkContext
+{
+    std::string full_name;
+    std::string tunnel_name;
+    std::string entry_name;
+    sai_vlan_id_t vlan_id = 0;
+    uint32_t vni_id = 0;
+    sai_object_id_t map_entry_id = SAI_NULL_OBJECT_ID;
+    bool queued = false;
+};
+
 class VxlanTunnelMapOrch : public Orch2
 {
 public:
-    VxlanTunnelMapOrch(DBConnector *db, const std::string& tableName) : Orch2(db, tableName, request_) { }
+    VxlanTunnelMapOrch(DBConnector *db, const std::string& tableName);
 
     bool isTunnelMapExists(const std::string& name) const
     {
@@ -417,9 +436,15 @@ public:
 private:
     virtual bool addOperation(const Request& request);
     virtual bool delOperation(const Request& request);
+    void addOperations(std::vector<Orch2BulkRequest>& requests) override;
+
+    bool addOperationBulk(const Request& request, VxlanTunnelMapBulkContext& ctx);
+    bool addOperationPost(VxlanTunnelMapBulkContext& ctx);
+    bool addTunnelMapEntry(const VxlanTunnelMapBulkContext& ctx);
 
     VxlanTunnelMapTable vxlan_tunnel_map_table_;
     VxlanTunnelMapRequest request_;
+    ObjectBulker<sai_tunnel_api_t> tunnel_map_entry_bulker_;
 };
 
 const request_description_t vxlan_vrf_request_description = {
@@ -449,10 +474,21 @@ struct vrf_map_entry_t {
 typedef std::map<string, vrf_map_entry_t> VxlanVrfTable;
 typedef std::map<string, sai_object_id_t> VxlanVrfTunnel;
 
+/* VXLAN_VRF_MAP request whose encap and decap entries are created in bulk */
+struct VxlanVrfMapBulkContext
+{
+    std::string full_name;
+    std::string tunnel_name;
+    std::string entry_name;
+    std::string vrf_name;
+    vrf_map_entry_t entry = {};
+    bool queued = false;
+};
+
 class VxlanVrfMapOrch : public Orch2
 {
 public:
-    VxlanVrfMapOrch(DBConnector *db, const std::string& tableName) : Orch2(db, tableName, request_) { }
+    VxlanVrfMapOrch(DBConnector *db, const std::string& tableName);
 
     typedef std::pair<sai_object_id_t, sai_object_id_t> handler_pair;
 
@@ -464,10 +500,15 @@ public:
 private:
     virtual bool addOperation(const Request& request);
     virtual bool delOperation(const Request& request);
+    void addOperations(std::vector<Orch2BulkRequest>& requests) override;
+
+    bool addOperationBulk(const Request& request, VxlanVrfMapBulkContext& ctx);
+    bool addOperationPost(VxlanVrfMapBulkContext& ctx);
 
     VxlanVrfTable vxlan_vrf_table_;
     VxlanVrfTunnel vxlan_vrf_tunnel_;
     VxlanVrfRequest request_;
+    ObjectBulker<sai_tunnel_api_t> tunnel_map_entry_bulker_;
 };
 
 //---------------- EVPN_REMOTE_VNI table ---------------------
@@ -486,17 +527,33 @@ public:
     EvpnRemoteVniRequest() : Request(evpn_remote_vni_request_description, ':') { }
 };
 
+/* EVPN_REMOTE_VNI request whose VLAN member is created in bulk */
+struct EvpnRemoteVniBulkContext
+{
+    std::string remote_vtep;
+    std::string vlan_alias;
+    std::string port_alias;
+    sai_vlan_id_t vlan_id = 0;
+    uint32_t vni_id = 0;
+    sai_object_id_t vlan_member_id = SAI_NULL_OBJECT_ID;
+    bool queued = false;
+};
+
 class EvpnRemoteVnip2pOrch : public Orch2
 {
 public:
-    EvpnRemoteVnip2pOrch(DBConnector *db, const std::string& tableName) : Orch2(db, tableName, request_) { }
-
+    EvpnRemoteVnip2pOrch(DBConnector *db, const std::string& tableName);
 
 private:
     virtual bool addOperation(const Request& request);
     virtual bool delOperation(const Request& request);
+    void addOperations(std::vector<Orch2BulkRequest>& requests) override;
+
+    bool addOperationBulk(const Request& request, EvpnRemoteVniBulkContext& ctx);
+    bool addOperationPost(EvpnRemoteVniBulkContext& ctx);
 
     EvpnRemoteVniRequest request_;
+    ObjectBulker<sai_vlan_api_t> vlan_member_bulker_;
 };
 
 class EvpnRemoteVnip2mpOrch : public Orch2
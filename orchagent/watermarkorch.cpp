@@ -7,6 +7,7 @@
 #include <inttypes.h>
 
 #define DEFAULT_TELEMETRY_INTERVAL 120
+#define WM_CLEAR_PIPELINE_SIZE 1024
 
 #define CLEAR_PG_HEADROOM_REQUEST "PG_HEADROOM"
 #define CLEAR_PG_SHARED_REQUEST "PG_SHARED"
@@ -27,10 +28,11 @@ WatermarkOrch::WatermarkOrch(DBConnector *db, const vector<string> &tables):
 
     m_countersDb = make_shared<DBConnector>("COUNTERS_DB", 0);
     m_appDb = make_shared<DBConnector>("APPL_DB", 0);
+    m_countersPipeline = unique_ptr<RedisPipeline>(new RedisPipeline(m_countersDb.get(), WM_CLEAR_PIPELINE_SIZE));
     m_countersTable = make_shared<Table>(m_countersDb.get(), COUNTERS_TABLE);
-    m_periodicWatermarkTable = make_shared<Table>(m_countersDb.get(), PERIODIC_WATERMARKS_TABLE);
-    m_persistentWatermarkTable = make_shared<Table>(m_countersDb.get(), PERSISTENT_WATERMARKS_TABLE);
-    m_userWatermarkTable = make_shared<Table>(m_countersDb.get(), USER_WATERMARKS_TABLE);
+    m_periodicWatermarkTable = make_shared<Table>(m_countersPipeline.get(), PERIODIC_WATERMARKS_TABLE, true);
+    m_persistentWatermarkTable = make_shared<Table>(m_countersPipeline.get(), PERSISTENT_WATERMARKS_TABLE, true);
+    m_userWatermarkTable = make_shared<Table>(m_countersPipeline.get(), USER_WATERMARKS_TABLE, true);
 
     m_clearNotificationConsumer = new swss::NotificationConsumer(
             m_appDb.get(),
@@ -149,15 +151,7 @@ void WatermarkOrch::doTask(NotificationConsumer &consumer)
         return;
     }
 
-    if (m_pg_ids.empty())
-    {
-        init_pg_ids();
-    }
-
-    if (m_multicast_queue_ids.empty() and m_unicast_queue_ids.empty() and m_all_queue_ids.empty())
-    {
-        init_queue_ids();
-    }
+    refreshOidCache();
 
     std::string op;
     std::string data;
@@ -228,21 +222,15 @@ void WatermarkOrch::doTask(NotificationConsumer &consumer)
         SWSS_LOG_WARN("Unknown watermark clear request data: %s", data.c_str());
         return;
     }
+
+    m_countersPipeline->flush();
 }
 
 void WatermarkOrch::doTask(SelectableTimer &timer)
 {
     SWSS_LOG_ENTER();
 
-    if (m_pg_ids.empty())
-    {
-        init_pg_ids();
-    }
-
-    if (m_multicast_queue_ids.empty() and m_unicast_queue_ids.empty() and m_all_queue_ids.empty())
-    {
-        init_queue_ids();
-    }
+    refreshOidCache();
 
     if (&timer == m_telemetryTimer)
     {
@@ -277,14 +265,38 @@ void WatermarkOrch::doTask(SelectableTimer &timer)
         clearSingleWm(m_periodicWatermarkTable.get(),
                       "SAI_BUFFER_POOL_STAT_XOFF_ROOM_WATERMARK_BYTES",
                       gBufferOrch->getBufferPoolNameOidMap());
+        m_countersPipeline->flush();
         SWSS_LOG_DEBUG("Periodic watermark cleared by timer!");
     }
 }
 
+void WatermarkOrch::refreshOidCache()
+{
+    SWSS_LOG_ENTER();
+
+    /* Re-read the maps only when PortsOrch changed them, or when nothing
+     * was found in them yet */
+    uint64_t pgMapVersion = gPortsOrch->getPgIndexMapVersion();
+    if (m_pg_ids.empty() || pgMapVersion != m_pgMapVersion)
+    {
+        init_pg_ids();
+        m_pgMapVersion = pgMapVersion;
+    }
+
+    uint64_t queueMapVersion = gPortsOrch->getQueueTypeMapVersion();
+    if ((m_multicast_queue_ids.empty() and m_unicast_queue_ids.empty() and m_all_queue_ids.empty()) ||
+        queueMapVersion != m_queueMapVersion)
+    {
+        init_queue_ids();
+        m_queueMapVersion = queueMapVersion;
+    }
+}
+
 void WatermarkOrch::init_pg_ids()
 {
     SWSS_LOG_ENTER();
     std::vector<FieldValueTuple> values;
+    m_pg_ids.clear();
     Table pg_index_table(m_countersDb.get(), COUNTERS_PG_INDEX_MAP);
     pg_index_table.get("", values);
     for (auto fv: values)
@@ -299,6 +311,9 @@ void WatermarkOrch::init_queue_ids()
 {
     SWSS_LOG_ENTER();
     std::vector<FieldValueTuple> values;
+    m_unicast_queue_ids.clear();
+    m_multicast_queue_ids.clear();
+    m_all_queue_ids.clear();
     Table m_queue_type_table(m_countersDb.get(), COUNTERS_QUEUE_TYPE_MAP);
     m_queue_type_table.get("", values);
     for (auto fv: values)
@@ -322,7 +337,8 @@ void WatermarkOrch::init_queue_ids()
 
 void WatermarkOrch::clearSingleWm(Table *table, string wm_name, vector<sai_object_id_t> &obj_ids)
 {
-    /* Zero-out some WM in some table for some vector of object ids*/
+    /* Zero-out some WM in some table for some vector of object ids.
+     * The watermark tables are buffered, the caller flushes the pipeline. */
     SWSS_LOG_ENTER();
     SWSS_LOG_DEBUG("clear WM %s, for %zu obj ids", wm_name.c_str(), obj_ids.size());
 
@@ -30,6 +30,7 @@ public:
 
     void init_pg_ids();
     void init_queue_ids();
+    void refreshOidCache();
 
     void handleWmConfigUpdate(const std::string &key, const std::vector<swss::FieldValueTuple> &fvt);
     void handleFcConfigUpdate(const std::string &key, const std::vector<swss::FieldValueTuple> &fvt);
@@ -58,6 +59,8 @@ private:
 
     std::shared_ptr<swss::DBConnector> m_countersDb = nullptr;
     std::shared_ptr<swss::DBConnector> m_appDb = nullptr;
+    /* Watermark tables are written in batches over this pipeline */
+    std::unique_ptr<swss::RedisPipeline> m_countersPipeline = nullptr;
     std::shared_ptr<swss::Table> m_countersTable = nullptr;
     std::shared_ptr<swss::Table> m_periodicWatermarkTable = nullptr;
     std::shared_ptr<swss::Table> m_persistentWatermarkTable = nullptr;
@@ -70,6 +73,10 @@ private:
     std::vector<sai_object_id_t> m_multicast_queue_ids;
     std::vector<sai_object_id_t> m_all_queue_ids;
     std::vector<sai_object_id_t> m_pg_ids;
+
+    /* PortsOrch map versions the cached object ids were read at */
+    uint64_t m_queueMapVersion = 0;
+    uint64_t m_pgMapVersion = 0;
 };
 
 #endif // WATERMARKORCH_H
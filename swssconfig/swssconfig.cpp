@@ -1,9 +1,13 @@
+#include <ctype.h>
 #include <dirent.h>
+#include <getopt.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <sstream>
 #include <vector>
 
 #include "logger.h"
@@ -21,10 +25,24 @@ const int el_count = 2;
 
 const string SWSS_CONFIG_DIR    = "/etc/swss/config.d/";
 
+/* Number of entries written per pipeline flush in streaming mode */
+const size_t DEFAULT_BATCH_SIZE = 1000;
+
+typedef unordered_map<string, ProducerStateTable> TableMap;
+typedef function<bool(KeyOpFieldsValuesTuple &)> DbItemHandler;
+
 void usage()
 {
-    cout << "Usage: swssconfig [FILE...]" << endl;
+    cout << "Usage: swssconfig [-s] [-b BATCH_SIZE] [FILE...]" << endl;
     cout << "       (default config folder is /etc/swss/config.d/)" << endl;
+    cout << "       -s: stream JSON files, entries are written as they are parsed" << endl;
+    cout << "       -b: number of entries per pipeline flush in streaming mode (default " << DEFAULT_BATCH_SIZE << ")" << endl;
+    cout << endl;
+    cout << "       Files which do not start with '[' are read in line-delimited format and" << endl;
+    cout << "       always streamed, one entry per line:" << endl;
+    cout << "           SET <TABLE>:<key> [field=value ...]" << endl;
+    cout << "           DEL <TABLE>:<key>" << endl;
+    cout << "       Empty lines and lines starting with '#' are ignored." << endl;
 }
 
 void dump_db_item(KeyOpFieldsValuesTuple &db_item)
@@ -39,42 +57,98 @@ void dump_db_item(KeyOpFieldsValuesTuple &db_item)
     SWSS_LOG_DEBUG("]");
 }
 
+bool write_db_item(RedisPipeline &pipeline, TableMap &table_map, KeyOpFieldsValuesTuple &db_item)
+{
+    dump_db_item(db_item);
+
+    const string &key = kfvKey(db_item);
+    size_t pos = key.find(name_delimiter);
+    if ((string::npos == pos) || ((key.size() - 1) == pos))
+    {
+        SWSS_LOG_ERROR("Invalid formatted hash:%s\n", key.c_str());
+        return false;
+    }
+    string table_name = key.substr(0, pos);
+    string key_name = key.substr(pos + 1);
+    auto ret = table_map.emplace(std::piecewise_construct, std::forward_as_tuple(table_name), std::forward_as_tuple(&pipeline, table_name, true));
+
+    if (kfvOp(db_item) == SET_COMMAND)
+        ret.first->second.set(key_name, kfvFieldsValues(db_item), SET_COMMAND);
+    else if (kfvOp(db_item) == DEL_COMMAND)
+        ret.first->second.del(key_name, DEL_COMMAND);
+    else
+    {
+        SWSS_LOG_ERROR("Invalid operation: %s\n", kfvOp(db_item).c_str());
+        return false;
+    }
+
+    return true;
+}
+
 bool write_db_data(vector<KeyOpFieldsValuesTuple> &db_items)
 {
     DBConnector db("APPL_DB", 0, false);
     RedisPipeline pipeline(&db); // dtor of RedisPipeline will automatically flush data
-    unordered_map<string, ProducerStateTable> table_map;
-    
+    TableMap table_map;
+
     for (auto &db_item : db_items)
     {
-        dump_db_item(db_item);
-
-        string key = kfvKey(db_item);
-        size_t pos = key.find(name_delimiter);
-        if ((string::npos == pos) || ((key.size() - 1) == pos))
+        if (!write_db_item(pipeline, table_map, db_item))
         {
-            SWSS_LOG_ERROR("Invalid formatted hash:%s\n", key.c_str());
             return false;
         }
-        string table_name = key.substr(0, pos);
-        string key_name = key.substr(pos + 1);
-        auto ret = table_map.emplace(std::piecewise_construct, std::forward_as_tuple(table_name), std::forward_as_tuple(&pipeline, table_name, true));
-
-        if (kfvOp(db_item) == SET_COMMAND)
-            ret.first->second.set(key_name, kfvFieldsValues(db_item), SET_COMMAND);
-        else if (kfvOp(db_item) == DEL_COMMAND)
-            ret.first->second.del(key_name, DEL_COMMAND);
+    }
+
+    return true;
+}
+
+bool parse_json_db_item(const json &arr_item, KeyOpFieldsValuesTuple &cur_db_item)
+{
+    if (!arr_item.is_object())
+    {
+        SWSS_LOG_ERROR("Child elements must be objects. element:%s", arr_item.dump().c_str());
+        return false;
+    }
+
+    if (el_count != arr_item.size())
+    {
+        SWSS_LOG_ERROR("Child elements must have both key and op entry. %s",
+                       arr_item.dump().c_str());
+        return false;
+    }
+
+    for (auto child_it = arr_item.begin(); child_it != arr_item.end(); child_it++) {
+        auto cur_obj_key = child_it.key();
+        auto &cur_obj = child_it.value();
+
+        if (cur_obj.is_object()) {
+            kfvKey(cur_db_item) = cur_obj_key;
+            for (auto cur_obj_it = cur_obj.begin(); cur_obj_it != cur_obj.end(); cur_obj_it++)
+            {
+                string field_str = cur_obj_it.key();
+                string value_str;
+                if ((*cur_obj_it).is_number())
+                    value_str = to_string((*cur_obj_it).get<int>());
+                else if ((*cur_obj_it).is_string())
+                    value_str = (*cur_obj_it).get<string>();
+                kfvFieldsValues(cur_db_item).push_back(FieldValueTuple(field_str, value_str));
+            }
+        }
         else
         {
-            SWSS_LOG_ERROR("Invalid operation: %s\n", kfvOp(db_item).c_str());
-            return false;
-        }
+            if (op_name != child_it.key())
+            {
+                SWSS_LOG_ERROR("Invalid entry. %s", arr_item.dump().c_str());
+                return false;
+            }
+            kfvOp(cur_db_item) = cur_obj.get<string>();
+         }
     }
 
     return true;
 }
 
-bool load_json_db_data(ifstream &fs, vector<KeyOpFieldsValuesTuple> &db_items)
+bool load_json_db_data(istream &fs, vector<KeyOpFieldsValuesTuple> &db_items)
 {
     json json_array;
     fs >> json_array;
@@ -87,60 +161,168 @@ bool load_json_db_data(ifstream &fs, vector<KeyOpFieldsValuesTuple> &db_items)
 
     for (size_t i = 0; i < json_array.size(); i++)
     {
-        auto &arr_item = json_array[i];
+        db_items.push_back(KeyOpFieldsValuesTuple());
+        if (!parse_json_db_item(json_array[i], db_items.back()))
+        {
+            return false;
+        }
+    }
+    return true;
+}
 
-        if (arr_item.is_object())
+/*
+ * Parse the JSON array incrementally: every element of the root array is
+ * handed to the handler as soon as it has been parsed and then discarded,
+ * so the whole document is never held in memory.
+ */
+bool stream_json_db_data(istream &fs, const DbItemHandler &handler)
+{
+    json::parser_callback_t cb = [&](int depth, json::parse_event_t event, json &parsed)
+    {
+        if (depth == 0 && (event == json::parse_event_t::object_start || event == json::parse_event_t::value))
         {
-            if (el_count != arr_item.size())
-            {
-                SWSS_LOG_ERROR("Child elements must have both key and op entry. %s",
-                               arr_item.dump().c_str());
-                return false;
-            }
+            throw runtime_error("Root element must be an array.");
+        }
 
-            db_items.push_back(KeyOpFieldsValuesTuple());
-            auto &cur_db_item = db_items[db_items.size() - 1];
+        if (depth != 1 || (event != json::parse_event_t::object_end && event != json::parse_event_t::value))
+        {
+            return true;
+        }
 
-            for (json::iterator child_it = arr_item.begin(); child_it != arr_item.end(); child_it++) {
-                auto cur_obj_key = child_it.key();
-                auto &cur_obj = child_it.value();
+        KeyOpFieldsValuesTuple db_item;
+        if (!parse_json_db_item(parsed, db_item) || !handler(db_item))
+        {
+            throw runtime_error("Invalid entry " + parsed.dump());
+        }
+        return false;
+    };
 
-                string field_str;
-                string value_str;
+    json::parse(fs, cb);
+    return true;
+}
 
-                if (cur_obj.is_object()) {
-                    kfvKey(cur_db_item) = cur_obj_key;
-                    for (json::iterator cur_obj_it = cur_obj.begin(); cur_obj_it != cur_obj.end(); cur_obj_it++)
-                    {
-                        string field_str = cur_obj_it.key();
-                        string value_str;
-                        if ((*cur_obj_it).is_number())
-                            value_str = to_string((*cur_obj_it).get<int>());
-                        else if ((*cur_obj_it).is_string())
-                            value_str = (*cur_obj_it).get<string>();
-                        kfvFieldsValues(cur_db_item).push_back(FieldValueTuple(field_str, value_str));
-                    }
-                }
-                else
-                {
-                    if (op_name != child_it.key())
-                    {
-                        SWSS_LOG_ERROR("Invalid entry. %s", arr_item.dump().c_str());
-                        return false;
-                    }
-                    kfvOp(cur_db_item) = cur_obj.get<string>();
-                 }
+/*
+ * Line-delimited format, one entry per line:
+ *   SET <TABLE>:<key> [field=value ...]
+ *   DEL <TABLE>:<key>
+ * Fields are separated by whitespace, so values cannot contain whitespace.
+ */
+bool stream_line_db_data(istream &fs, const DbItemHandler &handler)
+{
+    string line;
+    size_t line_num = 0;
+
+    while (getline(fs, line))
+    {
+        line_num++;
+
+        istringstream iss(line);
+        KeyOpFieldsValuesTuple db_item;
+        string token;
+
+        if (!(iss >> kfvOp(db_item)) || kfvOp(db_item)[0] == '#')
+        {
+            continue;
+        }
+
+        if (!(iss >> kfvKey(db_item)))
+        {
+            SWSS_LOG_ERROR("Missing key at line %zu: %s", line_num, line.c_str());
+            return false;
+        }
+
+        while (iss >> token)
+        {
+            size_t pos = token.find('=');
+            if (pos == string::npos || pos == 0)
+            {
+                SWSS_LOG_ERROR("Invalid field at line %zu: %s", line_num, token.c_str());
+                return false;
             }
+            kfvFieldsValues(db_item).emplace_back(token.substr(0, pos), token.substr(pos + 1));
         }
-        else
+
+        if (!handler(db_item))
         {
-            SWSS_LOG_ERROR("Child elements must be objects. element:%s", arr_item.dump().c_str());
+            SWSS_LOG_ERROR("Invalid entry at line %zu: %s", line_num, line.c_str());
             return false;
         }
     }
+
     return true;
 }
 
+/*
+ * Write the entries of a file while it is being parsed. The pipeline is
+ * sized to the batch size, so it is flushed once per batch_size entries.
+ */
+bool stream_db_data(istream &fs, bool json_format, size_t batch_size)
+{
+    DBConnector db("APPL_DB", 0, false);
+    RedisPipeline pipeline(&db, batch_size);
+    TableMap table_map;
+    size_t count = 0;
+
+    DbItemHandler handler = [&](KeyOpFieldsValuesTuple &db_item)
+    {
+        count++;
+        return write_db_item(pipeline, table_map, db_item);
+    };
+
+    bool ret = json_format ? stream_json_db_data(fs, handler) : stream_line_db_data(fs, handler);
+
+    pipeline.flush();
+    SWSS_LOG_NOTICE("Streamed %zu entries", count);
+
+    return ret;
+}
+
+/*
+ * Files starting with '[' are JSON, files starting with an operation or a
+ * comment are line-delimited. Empty files and JSON documents whose root is
+ * not an array are rejected.
+ */
+bool get_file_format(istream &fs, bool &json_format)
+{
+    fs >> ws;
+
+    int c = fs.peek();
+    if (c == EOF)
+    {
+        SWSS_LOG_ERROR("File is empty.");
+        return false;
+    }
+
+    json_format = (c == '[');
+    if (!json_format && !isalpha(c) && c != '#')
+    {
+        SWSS_LOG_ERROR("Root element must be an array.");
+        return false;
+    }
+
+    return true;
+}
+
+// The whole argument must be a positive decimal number
+bool parse_batch_size(const string &arg, size_t &batch_size)
+{
+    if (arg.empty() || !isdigit(static_cast<unsigned char>(arg[0])))
+    {
+        return false;
+    }
+
+    try
+    {
+        size_t pos;
+        batch_size = stoul(arg, &pos);
+        return pos == arg.size() && batch_size != 0;
+    }
+    catch (const exception &)
+    {
+        return false;
+    }
+}
+
 vector<string> read_directory(const string &path)
 {
     vector<string> ret;
@@ -165,18 +347,41 @@ vector<string> read_directory(const string &path)
 int main(int argc, char **argv)
 {
     vector<string> files;
-    if (argc == 1)
+    bool stream = false;
+    size_t batch_size = DEFAULT_BATCH_SIZE;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "sb:h")) != -1)
     {
-        files = read_directory(SWSS_CONFIG_DIR);
+        switch (opt)
+        {
+        case 's':
+            stream = true;
+            break;
+        case 'b':
+            if (!parse_batch_size(optarg, batch_size))
+            {
+                cerr << "Invalid batch size " << optarg << endl;
+                usage();
+                exit(EXIT_FAILURE);
+            }
+            break;
+        case 'h':
+            usage();
+            exit(EXIT_SUCCESS);
+        default:
+            usage();
+            exit(EXIT_FAILURE);
+        }
     }
-    if (argc == 2 && !strcmp(argv[1], "-h"))
+
+    if (optind == argc)
     {
-        usage();
-        exit(EXIT_SUCCESS);
+        files = read_directory(SWSS_CONFIG_DIR);
     }
     else
     {
-        for (auto i = 1; i < argc; i++)
+        for (auto i = optind; i < argc; i++)
         {
             files.push_back(string(argv[i]));
         }
@@ -184,7 +389,7 @@ int main(int argc, char **argv)
 
     for (auto i : files)
     {
-        SWSS_LOG_NOTICE("Loading config from JSON file:%s...", i.c_str());
+        SWSS_LOG_NOTICE("Loading config from file:%s...", i.c_str());
 
         vector<KeyOpFieldsValuesTuple> db_items;
         try
@@ -197,6 +402,23 @@ int main(int argc, char **argv)
                 return EXIT_FAILURE;
             }
 
+            bool json_format = false;
+            if (!get_file_format(fs, json_format))
+            {
+                SWSS_LOG_ERROR("Failed loading data from file %s", i.c_str());
+                return EXIT_FAILURE;
+            }
+
+            if (stream || !json_format)
+            {
+                if (!stream_db_data(fs, json_format, batch_size))
+                {
+                    SWSS_LOG_ERROR("Failed applying data from file %s", i.c_str());
+                    return EXIT_FAILURE;
+                }
+                continue;
+            }
+
             if (!load_json_db_data(fs, db_items))
             {
                 SWSS_LOG_ERROR("Failed loading data from JSON file %s", i.c_str());
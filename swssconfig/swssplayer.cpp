@@ -1,5 +1,14 @@
+#include <ctype.h>
+#include <getopt.h>
+#include <time.h>
+
+#include <chrono>
+#include <cmath>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <thread>
+#include <unordered_map>
 
 #include <dbconnector.h>
 #include <producerstatetable.h>
@@ -9,15 +18,69 @@
 using namespace std;
 using namespace swss;
 
+/* Number of operations written per pipeline flush */
+static const size_t DEFAULT_BATCH_SIZE = 1000;
+
 static int line_index = 0;
 static DBConnector db("APPL_DB", 0, true);
 
 void usage()
 {
-	cout << "Usage: swssplayer <file>" << endl;
+	cout << "Usage: swssplayer [-t] [-x SPEEDUP] [-b BATCH_SIZE] <file>" << endl;
+	cout << "       -t: replay with the recorded timing instead of at maximum throughput" << endl;
+	cout << "       -x: speed-up factor applied to the recorded timing (default 1.0)" << endl;
+	cout << "       -b: number of operations per pipeline flush (default " << DEFAULT_BATCH_SIZE << ")" << endl;
 	/* TODO: Add sample input file */
 }
 
+/*
+ * Replays the operations of a swss.rec file into APPL_DB.
+ *
+ * One buffered producer is kept per table, all sharing a single pipeline.
+ * In max-throughput mode the pipeline is flushed once per batch, in
+ * timestamp-faithful mode it is also flushed whenever the player has to
+ * wait for the next recorded timestamp, so every operation reaches the
+ * database at its (scaled) recorded time.
+ */
+class SwssPlayer
+{
+public:
+	SwssPlayer(size_t batchSize, bool timed, double speedup) :
+		m_pipeline(&db, batchSize),
+		m_timed(timed),
+		m_speedup(speedup),
+		m_ops(0),
+		m_started(false),
+		m_firstRecordUsec(-1)
+	{
+	}
+
+	void processLine(const string &line);
+	void finish();
+
+	size_t getOps() const
+	{
+		return m_ops;
+	}
+
+private:
+	typedef chrono::steady_clock Clock;
+
+	RedisPipeline m_pipeline;
+	unordered_map<string, unique_ptr<ProducerStateTable>> m_producers;
+
+	bool m_timed;
+	double m_speedup;
+	size_t m_ops;
+
+	bool m_started;
+	int64_t m_firstRecordUsec;
+	Clock::time_point m_start;
+
+	ProducerStateTable &getProducer(const string &table_name);
+	void waitForTimestamp(const string &timestamp);
+};
+
 vector<FieldValueTuple> processFieldsValuesTuple(string s)
 {
 	vector<FieldValueTuple> result;
@@ -34,46 +97,232 @@ vector<FieldValueTuple> processFieldsValuesTuple(string s)
 	return result;
 }
 
-void processTokens(vector<string> tokens)
+/* Parse a recorded timestamp "YYYY-MM-DD.HH:MM:SS.uuuuuu" into microseconds */
+static bool parseTimestamp(const string &timestamp, int64_t &usec)
 {
-	auto key = tokens[1];
+	struct tm tm = {};
+	const char *rest = strptime(timestamp.c_str(), "%Y-%m-%d.%H:%M:%S", &tm);
+	if (rest == NULL)
+	{
+		return false;
+	}
 
-	/* Process the key */
-	auto v_key = tokenize(key, ':', 1);
-	auto table_name = v_key[0];
-	auto key_name = v_key[1];
+	usec = static_cast<int64_t>(timegm(&tm)) * 1000000;
+	if (*rest == '.')
+	{
+		usec += strtoll(rest + 1, NULL, 10);
+	}
+
+	return true;
+}
+
+ProducerStateTable &SwssPlayer::getProducer(const string &table_name)
+{
+	auto it = m_producers.find(table_name);
+	if (it == m_producers.end())
+	{
+		it = m_producers.emplace(table_name, unique_ptr<ProducerStateTable>(
+				new ProducerStateTable(&m_pipeline, table_name, true))).first;
+	}
+
+	return *it->second;
+}
+
+void SwssPlayer::waitForTimestamp(const string &timestamp)
+{
+	int64_t usec;
+	if (!parseTimestamp(timestamp, usec))
+	{
+		return;
+	}
+
+	if (m_firstRecordUsec < 0)
+	{
+		m_firstRecordUsec = usec;
+		return;
+	}
+
+	auto offset = chrono::microseconds(static_cast<int64_t>(
+			static_cast<double>(usec - m_firstRecordUsec) / m_speedup));
+	auto due = m_start + offset;
+	if (due > Clock::now())
+	{
+		/* Deliver what is due so far before going idle */
+		m_pipeline.flush();
+		this_thread::sleep_until(due);
+	}
+}
+
+void SwssPlayer::processLine(const string &line)
+{
+	auto tokens = tokenize(line, '|', 3);
+
+	/* Skip the lines which are not an operation, e.g. "recording started" */
+	if (tokens.size() < 3)
+	{
+		return;
+	}
+
+	if (m_timed)
+	{
+		waitForTimestamp(tokens[0]);
+	}
 
-	ProducerStateTable producer(&db, table_name);
+	if (!m_started)
+	{
+		m_started = true;
+		m_start = Clock::now();
+	}
+
+	/* Process the key */
+	auto v_key = tokenize(tokens[1], ':', 1);
+	if (v_key.size() != 2)
+	{
+		cerr << "Invalid key at line " << line_index << ": " << tokens[1] << endl;
+		return;
+	}
+	auto &producer = getProducer(v_key[0]);
+	auto &key_name = v_key[1];
 
 	/* Process the operation */
-	auto op = tokens[2];
+	auto &op = tokens[2];
 	if (op == SET_COMMAND)
 	{
-		auto tuples = processFieldsValuesTuple(tokens[3]);
+		auto tuples = processFieldsValuesTuple(tokens.size() > 3 ? tokens[3] : "");
 		producer.set(key_name, tuples, SET_COMMAND);
 	}
 	else if (op == DEL_COMMAND)
 	{
 		producer.del(key_name, DEL_COMMAND);
 	}
+	else
+	{
+		return;
+	}
+
+	m_ops++;
+}
+
+void SwssPlayer::finish()
+{
+	m_pipeline.flush();
+
+	if (!m_started)
+	{
+		cout << "No operations replayed" << endl;
+		return;
+	}
+
+	double elapsed = chrono::duration<double>(Clock::now() - m_start).count();
+	cout << "Replayed " << m_ops << " operations in " << elapsed << " s";
+	if (elapsed > 0)
+	{
+		cout << ", " << static_cast<double>(m_ops) / elapsed << " ops/sec";
+	}
+	cout << endl;
+}
+
+/* Parse a positive batch size, the whole argument has to be a number */
+static bool parseBatchSize(const string &arg, size_t &batch_size)
+{
+	if (arg.empty() || !isdigit(static_cast<unsigned char>(arg[0])))
+	{
+		return false;
+	}
+
+	try
+	{
+		size_t pos;
+		batch_size = stoul(arg, &pos);
+		return pos == arg.size() && batch_size != 0;
+	}
+	catch (const exception &)
+	{
+		return false;
+	}
+}
+
+/* Parse a positive and finite speed-up factor, e.g. "2" or "0.5" */
+static bool parseSpeedup(const string &arg, double &speedup)
+{
+	if (arg.empty() || !(isdigit(static_cast<unsigned char>(arg[0])) || arg[0] == '.'))
+	{
+		return false;
+	}
+
+	try
+	{
+		size_t pos;
+		speedup = stod(arg, &pos);
+		return pos == arg.size() && isfinite(speedup) && speedup > 0;
+	}
+	catch (const exception &)
+	{
+		return false;
+	}
 }
 
 int main(int argc, char **argv)
 {
-	if (argc != 2)
+	bool timed = false;
+	double speedup = 1.0;
+	size_t batch_size = DEFAULT_BATCH_SIZE;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "tx:b:h")) != -1)
+	{
+		switch (opt)
+		{
+		case 't':
+			timed = true;
+			break;
+		case 'x':
+			if (!parseSpeedup(optarg, speedup))
+			{
+				cerr << "Invalid speed-up factor " << optarg << endl;
+				usage();
+				exit(EXIT_FAILURE);
+			}
+			break;
+		case 'b':
+			if (!parseBatchSize(optarg, batch_size))
+			{
+				cerr << "Invalid batch size " << optarg << endl;
+				usage();
+				exit(EXIT_FAILURE);
+			}
+			break;
+		case 'h':
+			usage();
+			exit(EXIT_SUCCESS);
+		default:
+			usage();
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	if (optind != argc - 1)
 	{
 		usage();
 		exit(EXIT_FAILURE);
 	}
 
-	ifstream file(argv[1]);
+	ifstream file(argv[optind]);
+	if (!file)
+	{
+		cerr << "Failed to open file " << argv[optind] << endl;
+		exit(EXIT_FAILURE);
+	}
+
+	SwssPlayer player(batch_size, timed, speedup);
 	string line;
 
 	while (getline(file, line))
 	{
-		auto tokens = tokenize(line, '|', 3);
-		processTokens(tokens);
+		player.processLine(line);
 
 		line_index++;
 	}
+
+	player.finish();
 }
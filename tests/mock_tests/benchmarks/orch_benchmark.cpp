@@ -0,0 +1,447 @@
+#define protected public
+#include "orch.h"
+#undef protected
+#include "ut_helper.h"
+#include "mock_orchagent_main.h"
+#include "mock_orch_test.h"
+#include "mock_table.h"
+#include "aclorch.h"
+
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <new>
+
+/*
+ * Allocation counter, the benchmark binary replaces the global allocation
+ * functions so that the allocations done by every drain can be reported.
+ */
+static std::atomic<uint64_t> g_allocCount(0);
+
+void *operator new(size_t size)
+{
+    g_allocCount.fetch_add(1, std::memory_order_relaxed);
+    void *p = malloc(size ? size : 1);
+    if (p == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *p) noexcept
+{
+    free(p);
+}
+
+void operator delete[](void *p) noexcept
+{
+    free(p);
+}
+
+void operator delete(void *p, size_t) noexcept
+{
+    free(p);
+}
+
+void operator delete[](void *p, size_t) noexcept
+{
+    free(p);
+}
+
+/*
+ * End-to-end orchagent benchmarks: synthetic APPL_DB/CONFIG_DB loads are
+ * pushed through the doTask() path of the orchs against the virtual switch,
+ * one drain of ORCH_BENCHMARK_DRAIN_SIZE entries at a time, the same way
+ * Consumer::execute() hands them over in orchagent.
+ *
+ * The default loads are the target scale of a large deployment and can be
+ * scaled down with ORCH_BENCHMARK_SCALE, e.g. ORCH_BENCHMARK_SCALE=0.01.
+ */
+namespace orch_benchmark
+{
+    using namespace std;
+    using namespace mock_orch_test;
+
+    typedef function<KeyOpFieldsValuesTuple(size_t)> EntryGenerator;
+
+    struct BenchmarkResult
+    {
+        size_t ops;
+        size_t pending;
+        double seconds;
+        double p99DrainUsec;
+        double maxDrainUsec;
+        uint64_t allocs;
+        long peakRssKb;
+    };
+
+    static size_t scaled(size_t count)
+    {
+        const char *scale_env = getenv("ORCH_BENCHMARK_SCALE");
+        double scale = scale_env ? strtod(scale_env, nullptr) : 1.0;
+        return max<size_t>(1, static_cast<size_t>(static_cast<double>(count) * scale));
+    }
+
+    static size_t drainSize()
+    {
+        const char *size_env = getenv("ORCH_BENCHMARK_DRAIN_SIZE");
+        size_t size = size_env ? strtoul(size_env, nullptr, 10) : 1024;
+        return max<size_t>(1, size);
+    }
+
+    static long peakRssKb()
+    {
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_maxrss;
+    }
+
+    static long currentRssKb()
+    {
+        long pages = 0, rss = 0;
+        ifstream statm("/proc/self/statm");
+        statm >> pages >> rss;
+        return rss * sysconf(_SC_PAGESIZE) / 1024;
+    }
+
+    static string ipv4ToString(uint32_t addr)
+    {
+        return to_string(addr >> 24) + "." + to_string((addr >> 16) & 0xff) + "." +
+               to_string((addr >> 8) & 0xff) + "." + to_string(addr & 0xff);
+    }
+
+    static string macToString(uint32_t index)
+    {
+        char mac[18];
+        snprintf(mac, sizeof(mac), "02:00:%02x:%02x:%02x:%02x",
+                 (index >> 24) & 0xff, (index >> 16) & 0xff, (index >> 8) & 0xff, index & 0xff);
+        return mac;
+    }
+
+    /*
+     * Push count generated entries to the consumer of the orch and drain them
+     * with doTask(), drainSize() entries at a time.
+     */
+    static BenchmarkResult runDrains(const string &name, Orch *orch, const string &table,
+                                     size_t count, const EntryGenerator &generator)
+    {
+        auto consumer = dynamic_cast<Consumer *>(orch->getExecutor(table));
+        EXPECT_NE(consumer, nullptr);
+
+        BenchmarkResult result = {};
+        vector<double> drains;
+        size_t drain_size = drainSize();
+
+        for (size_t base = 0; base < count; base += drain_size)
+        {
+            std::deque<KeyOpFieldsValuesTuple> entries;
+            for (size_t i = base; i < min(base + drain_size, count); i++)
+            {
+                entries.push_back(generator(i));
+            }
+
+            auto allocs = g_allocCount.load(std::memory_order_relaxed);
+            auto start = chrono::steady_clock::now();
+
+            consumer->addToSync(entries);
+            orch->doTask(*consumer);
+
+            auto elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            result.allocs += g_allocCount.load(std::memory_order_relaxed) - allocs;
+            result.seconds += elapsed;
+            drains.push_back(elapsed * 1e6);
+        }
+
+        result.ops = count;
+        result.pending = consumer->m_toSync.size();
+        result.peakRssKb = peakRssKb();
+
+        sort(drains.begin(), drains.end());
+        if (!drains.empty())
+        {
+            result.p99DrainUsec = drains[min(drains.size() - 1, drains.size() * 99 / 100)];
+            result.maxDrainUsec = drains.back();
+        }
+
+        cout << "[ BENCHMARK] " << left << setw(28) << name << right
+             << " ops " << setw(8) << result.ops
+             << "  pending " << setw(6) << result.pending
+             << "  time " << fixed << setprecision(3) << setw(8) << result.seconds << " s"
+             << "  " << setprecision(0) << setw(9) << (result.seconds > 0 ? static_cast<double>(result.ops) / result.seconds : 0) << " ops/s"
+             << "  p99 drain " << setw(8) << result.p99DrainUsec << " us"
+             << "  max drain " << setw(8) << result.maxDrainUsec << " us"
+             << "  allocs/op " << setprecision(1) << setw(7) << static_cast<double>(result.allocs) / static_cast<double>(max<size_t>(result.ops, 1))
+             << "  peak RSS " << result.peakRssKb / 1024 << " MiB" << defaultfloat << endl;
+
+        return result;
+    }
+
+    struct OrchBenchmark : public MockOrchTest
+    {
+        PolicerOrch *m_policerOrch = nullptr;
+        AclOrch *m_aclOrch = nullptr;
+
+        OrchBenchmark()
+        {
+        }
+
+        void PostSetUp() override
+        {
+            vector<TableConnector> policer_tables = {
+                TableConnector(m_config_db.get(), CFG_POLICER_TABLE_NAME),
+                TableConnector(m_config_db.get(), CFG_PORT_STORM_CONTROL_TABLE_NAME)
+            };
+            m_policerOrch = new PolicerOrch(policer_tables, gPortsOrch);
+
+            TableConnector stateDbMirrorSession(m_state_db.get(), STATE_MIRROR_SESSION_TABLE_NAME);
+            TableConnector confDbMirrorSession(m_config_db.get(), CFG_MIRROR_SESSION_TABLE_NAME);
+
+            ASSERT_EQ(gMirrorOrch, nullptr);
+            gMirrorOrch = new MirrorOrch(stateDbMirrorSession, confDbMirrorSession,
+                                         gPortsOrch, gRouteOrch, gNeighOrch, gFdbOrch, m_policerOrch);
+
+            vector<TableConnector> acl_table_connectors = {
+                TableConnector(m_config_db.get(), CFG_ACL_TABLE_TABLE_NAME),
+                TableConnector(m_config_db.get(), CFG_ACL_RULE_TABLE_NAME)
+            };
+            m_aclOrch = new AclOrch(acl_table_connectors, m_state_db.get(), gSwitchOrch, gPortsOrch, gMirrorOrch,
+                                    gNeighOrch, gRouteOrch);
+
+            // Ethernet0 carries the ECMP next hops, Ethernet4 the neighbor load
+            Table intfTable = Table(m_app_db.get(), APP_INTF_TABLE_NAME);
+            intfTable.set("Ethernet0", { {"NULL", "NULL" },
+                                         {"mac_addr", "00:00:00:00:00:00" }});
+            intfTable.set("Ethernet0:10.0.0.1/24", { { "scope", "global" },
+                                                     { "family", "IPv4" }});
+            intfTable.set("Ethernet4", { {"NULL", "NULL" },
+                                         {"mac_addr", "00:00:00:00:00:00" }});
+            intfTable.set("Ethernet4:172.16.0.1/16", { { "scope", "global" },
+                                                       { "family", "IPv4" }});
+            gIntfsOrch->addExistingData(&intfTable);
+            static_cast<Orch *>(gIntfsOrch)->doTask();
+
+            Table neighborTable = Table(m_app_db.get(), APP_NEIGH_TABLE_NAME);
+            for (uint32_t i = 2; i < 2 + NEXTHOP_COUNT; i++)
+            {
+                neighborTable.set("Ethernet0:10.0.0." + to_string(i), { {"neigh", macToString(i)},
+                                                                        {"family", "IPv4" }});
+            }
+            gNeighOrch->addExistingData(&neighborTable);
+            static_cast<Orch *>(gNeighOrch)->doTask();
+
+            // Vlan100 on Ethernet8 hosts the FDB load
+            Table vlanTable = Table(m_app_db.get(), APP_VLAN_TABLE_NAME);
+            vlanTable.set("Vlan100", { { "admin_status", "up" },
+                                       { "mtu", "9100" } });
+            gPortsOrch->addExistingData(&vlanTable);
+            Table vlanMemberTable = Table(m_app_db.get(), APP_VLAN_MEMBER_TABLE_NAME);
+            vlanMemberTable.set("Vlan100:Ethernet8", { { "tagging_mode", "untagged" } });
+            gPortsOrch->addExistingData(&vlanMemberTable);
+            static_cast<Orch *>(gPortsOrch)->doTask();
+
+            // Ingress L3 table hosting the ACL rule load
+            Table aclTable = Table(m_config_db.get(), CFG_ACL_TABLE_TABLE_NAME);
+            aclTable.set("BENCHMARK_ACL", { { ACL_TABLE_TYPE, TABLE_TYPE_L3 },
+                                            { ACL_TABLE_STAGE, STAGE_INGRESS },
+                                            { ACL_TABLE_PORTS, "Ethernet12" } });
+            m_aclOrch->addExistingData(&aclTable);
+            static_cast<Orch *>(m_aclOrch)->doTask();
+        }
+
+        void PreTearDown() override
+        {
+            delete m_aclOrch;
+            m_aclOrch = nullptr;
+
+            delete gMirrorOrch;
+            gMirrorOrch = nullptr;
+
+            delete m_policerOrch;
+            m_policerOrch = nullptr;
+        }
+
+        static const uint32_t NEXTHOP_COUNT = 8;
+        static const uint32_t ECMP_WIDTH = 4;
+    };
+
+    // Routes spread over two ECMP groups of ECMP_WIDTH next hops
+    TEST_F(OrchBenchmark, RoutesEcmp)
+    {
+        auto route = [](size_t i) -> KeyOpFieldsValuesTuple
+        {
+            uint32_t first = 2 + static_cast<uint32_t>(i % 2) * ECMP_WIDTH;
+            string nexthops, ifnames;
+            for (uint32_t nh = first; nh < first + ECMP_WIDTH; nh++)
+            {
+                nexthops += (nexthops.empty() ? "" : ",") + string("10.0.0.") + to_string(nh);
+                ifnames += (ifnames.empty() ? "" : ",") + string("Ethernet0");
+            }
+
+            string prefix = ipv4ToString(0x10000000 + static_cast<uint32_t>(i << 8)) + "/24";
+            return KeyOpFieldsValuesTuple(prefix, SET_COMMAND, { { "nexthop", nexthops },
+                                                                 { "ifname", ifnames } });
+        };
+
+        auto result = runDrains("RouteOrch: routes with ECMP", gRouteOrch, APP_ROUTE_TABLE_NAME,
+                                scaled(1000000), route);
+        ASSERT_EQ(result.pending, 0);
+    }
+
+    // Host routes over the same ECMP group, sharing a single copy of their next hop group key
+    TEST_F(OrchBenchmark, RouteMemoryFootprint)
+    {
+        auto route = [](size_t i) -> KeyOpFieldsValuesTuple
+        {
+            string prefix = ipv4ToString(0x14000000 + static_cast<uint32_t>(i)) + "/32";
+            return KeyOpFieldsValuesTuple(prefix, SET_COMMAND, { { "nexthop", "10.0.0.2,10.0.0.3" },
+                                                                 { "ifname", "Ethernet0,Ethernet0" } });
+        };
+
+        size_t count = scaled(1000000);
+        auto nhg_key_count = gRouteOrch->getRouteNhgKeyCount();
+        auto rss_before = currentRssKb();
+
+        auto result = runDrains("RouteOrch: route footprint", gRouteOrch, APP_ROUTE_TABLE_NAME,
+                                count, route);
+        ASSERT_EQ(result.pending, 0);
+        ASSERT_EQ(gRouteOrch->getRouteNhgKeyCount(), nhg_key_count + 1);
+
+        long rss_growth = max(currentRssKb() - rss_before, 0L);
+        cout << "[ BENCHMARK] " << left << setw(28) << "RouteOrch: route footprint" << right
+             << " RSS grew by " << rss_growth / 1024 << " MiB, "
+             << rss_growth * 1024 / static_cast<long>(count) << " bytes per route" << endl;
+    }
+
+    TEST_F(OrchBenchmark, Neighbors)
+    {
+        auto neighbor = [](size_t i) -> KeyOpFieldsValuesTuple
+        {
+            uint32_t addr = 0xac100002 + static_cast<uint32_t>(i);
+            return KeyOpFieldsValuesTuple("Ethernet4:" + ipv4ToString(addr), SET_COMMAND,
+                                          { { "neigh", macToString(addr) },
+                                            { "family", "IPv4" } });
+        };
+
+        auto result = runDrains("NeighOrch: neighbors", gNeighOrch, APP_NEIGH_TABLE_NAME,
+                                min<size_t>(scaled(50000), 65000), neighbor);
+        ASSERT_EQ(result.pending, 0);
+    }
+
+    TEST_F(OrchBenchmark, FdbEntries)
+    {
+        auto fdb = [](size_t i) -> KeyOpFieldsValuesTuple
+        {
+            return KeyOpFieldsValuesTuple("Vlan100:" + macToString(static_cast<uint32_t>(i)), SET_COMMAND,
+                                          { { "port", "Ethernet8" },
+                                            { "type", "static" } });
+        };
+
+        auto result = runDrains("FdbOrch: FDB entries", gFdbOrch, APP_FDB_TABLE_NAME,
+                                scaled(100000), fdb);
+        ASSERT_EQ(result.pending, 0);
+    }
+
+    TEST_F(OrchBenchmark, AclRules)
+    {
+        auto rule = [](size_t i) -> KeyOpFieldsValuesTuple
+        {
+            return KeyOpFieldsValuesTuple("BENCHMARK_ACL|RULE_" + to_string(i), SET_COMMAND,
+                                          { { RULE_PRIORITY, to_string(1000 + i % 8000) },
+                                            { ACTION_PACKET_ACTION, i % 2 ? PACKET_ACTION_FORWARD : PACKET_ACTION_DROP },
+                                            { MATCH_SRC_IP, ipv4ToString(0x0a000000 + static_cast<uint32_t>(i)) + "/32" } });
+        };
+
+        auto result = runDrains("AclOrch: ACL rules", m_aclOrch, CFG_ACL_RULE_TABLE_NAME,
+                                scaled(20000), rule);
+        ASSERT_EQ(result.pending, 0);
+    }
+
+    // VLANs with a tagged member each, the bulk of the PortsOrch work at boot
+    TEST_F(OrchBenchmark, VlanMembers)
+    {
+        // VLAN 101 onwards, Vlan100 is used by the FDB load
+        size_t count = min<size_t>(scaled(3900), 3900);
+
+        auto vlan = [](size_t i) -> KeyOpFieldsValuesTuple
+        {
+            return KeyOpFieldsValuesTuple("Vlan" + to_string(101 + i), SET_COMMAND,
+                                          { { "admin_status", "up" },
+                                            { "mtu", "9100" } });
+        };
+        auto member = [](size_t i) -> KeyOpFieldsValuesTuple
+        {
+            return KeyOpFieldsValuesTuple("Vlan" + to_string(101 + i) + ":Ethernet16", SET_COMMAND,
+                                          { { "tagging_mode", "tagged" } });
+        };
+
+        auto vlans = runDrains("PortsOrch: VLANs", gPortsOrch, APP_VLAN_TABLE_NAME, count, vlan);
+        ASSERT_EQ(vlans.pending, 0);
+
+        auto members = runDrains("PortsOrch: VLAN members", gPortsOrch, APP_VLAN_MEMBER_TABLE_NAME, count, member);
+        ASSERT_EQ(members.pending, 0);
+    }
+
+    // VNI to VLAN maps of a VXLAN tunnel, through the per-request and the batched Orch2 paths
+    TEST_F(OrchBenchmark, VxlanTunnelMaps)
+    {
+        // One VLAN per map from VLAN 101 onwards, half of them for each path
+        size_t count = min<size_t>(scaled(1900), 1900);
+
+        gDirectory.set(gVrfOrch);
+        auto *tunnel_orch = new VxlanTunnelOrch(m_state_db.get(), m_app_db.get(), APP_VXLAN_TUNNEL_TABLE_NAME);
+        gDirectory.set(tunnel_orch);
+        auto *tunnel_map_orch = new VxlanTunnelMapOrch(m_app_db.get(), APP_VXLAN_TUNNEL_MAP_TABLE_NAME);
+        gDirectory.set(tunnel_map_orch);
+
+        Table tunnelTable = Table(m_app_db.get(), APP_VXLAN_TUNNEL_TABLE_NAME);
+        tunnelTable.set("vtep1", { { "src_ip", "10.1.0.1" } });
+        tunnel_orch->addExistingData(&tunnelTable);
+        static_cast<Orch *>(tunnel_orch)->doTask();
+
+        Table vlanTable = Table(m_app_db.get(), APP_VLAN_TABLE_NAME);
+        for (size_t i = 0; i < 2 * count; i++)
+        {
+            vlanTable.set("Vlan" + to_string(101 + i), { { "admin_status", "up" } });
+        }
+        gPortsOrch->addExistingData(&vlanTable);
+        static_cast<Orch *>(gPortsOrch)->doTask();
+
+        auto map = [](size_t i) -> KeyOpFieldsValuesTuple
+        {
+            string vlan = "Vlan" + to_string(101 + i);
+            return KeyOpFieldsValuesTuple("vtep1:map_" + to_string(1000 + i) + "_" + vlan, SET_COMMAND,
+                                          { { "vni", to_string(1000 + i) },
+                                            { "vlan", vlan } });
+        };
+        auto bulk_map = [&map, count](size_t i) -> KeyOpFieldsValuesTuple
+        {
+            return map(count + i);
+        };
+
+        tunnel_map_orch->setBulkMode(false);
+        auto single = runDrains("VxlanTunnelMapOrch: maps", tunnel_map_orch, APP_VXLAN_TUNNEL_MAP_TABLE_NAME,
+                                count, map);
+        ASSERT_EQ(single.pending, 0);
+
+        tunnel_map_orch->setBulkMode(true);
+        auto bulk = runDrains("VxlanTunnelMapOrch: maps, bulk", tunnel_map_orch, APP_VXLAN_TUNNEL_MAP_TABLE_NAME,
+                              count, bulk_map);
+        ASSERT_EQ(bulk.pending, 0);
+
+        delete tunnel_map_orch;
+        delete tunnel_orch;
+    }
+}
@@ -142,4 +142,88 @@ namespace bulker_test
         // Confirm route entry is not pending removal
         ASSERT_FALSE(gRouteBulker.bulk_entry_pending_removal(route_entry_non_remove));
     }
+
+    sai_status_t mockGetNatEntriesAttribute(
+        uint32_t object_count,
+        const sai_nat_entry_t *nat_entry,
+        const uint32_t *attr_count,
+        sai_attribute_t **attr_list,
+        sai_bulk_op_error_mode_t mode,
+        sai_status_t *object_statuses)
+    {
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            // Report the hit bit set for the odd source addresses
+            attr_list[i][0].value.booldata = (nat_entry[i].data.key.src_ip & 1);
+            object_statuses[i] = SAI_STATUS_SUCCESS;
+        }
+        return SAI_STATUS_SUCCESS;
+    }
+
+    TEST_F(BulkerTest, BulkerNatGetEntryAttribute)
+    {
+        sai_nat_api_t nat_api = {};
+        nat_api.get_nat_entries_attribute = mockGetNatEntriesAttribute;
+
+        // Create bulker
+        EntityBulker<sai_nat_api_t> gNatBulker(&nat_api, 2);
+
+        const uint32_t count = 5;
+        sai_nat_entry_t nat_entries[count] = {};
+        sai_attribute_t nat_attrs[count][2] = {};
+        sai_status_t object_statuses[count];
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            nat_entries[i].nat_type = SAI_NAT_TYPE_SOURCE_NAT;
+            nat_entries[i].data.key.src_ip = htonl(0x0a000000) + i;
+            nat_entries[i].data.mask.src_ip = 0xffffffff;
+            nat_attrs[i][0].id = SAI_NAT_ENTRY_ATTR_HIT_BIT;
+            nat_attrs[i][1].id = SAI_NAT_ENTRY_ATTR_HIT_BIT_COR;
+            nat_attrs[i][1].value.booldata = true;
+
+            gNatBulker.get_entry_attribute(&object_statuses[i], &nat_entries[i], 2, nat_attrs[i]);
+            ASSERT_EQ(object_statuses[i], SAI_STATUS_NOT_EXECUTED);
+        }
+
+        // Duplicated entry is not queried twice
+        sai_attribute_t dup_attrs[2] = {};
+        sai_status_t dup_status;
+        gNatBulker.get_entry_attribute(&dup_status, &nat_entries[0], 2, dup_attrs);
+        ASSERT_EQ(dup_status, SAI_STATUS_ITEM_ALREADY_EXISTS);
+        ASSERT_EQ(gNatBulker.getting_entries_count(), count);
+
+        // Entries are queried in chunks of max bulk size
+        gNatBulker.flush();
+        ASSERT_EQ(gNatBulker.getting_entries_count(), 0);
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            ASSERT_EQ(object_statuses[i], SAI_STATUS_SUCCESS);
+            ASSERT_EQ(nat_attrs[i][0].value.booldata, (nat_entries[i].data.key.src_ip & 1) != 0);
+        }
+    }
+
+    TEST_F(BulkerTest, BulkerNatGetEntryAttributeNotSupported)
+    {
+        sai_nat_api_t nat_api = {};
+
+        // Create bulker without bulk get support
+        EntityBulker<sai_nat_api_t> gNatBulker(&nat_api, 1000);
+
+        sai_nat_entry_t nat_entry = {};
+        nat_entry.nat_type = SAI_NAT_TYPE_DESTINATION_NAT;
+        nat_entry.data.key.dst_ip = htonl(0x0a000001);
+        nat_entry.data.mask.dst_ip = 0xffffffff;
+
+        sai_attribute_t nat_attr = {};
+        nat_attr.id = SAI_NAT_ENTRY_ATTR_HIT_BIT;
+        sai_status_t object_status;
+
+        gNatBulker.get_entry_attribute(&object_status, &nat_entry, 1, &nat_attr);
+        gNatBulker.flush();
+
+        // Bulk failure is reported per entry so that the caller can fall back to single get
+        ASSERT_EQ(object_status, SAI_STATUS_NOT_IMPLEMENTED);
+    }
 }
@@ -322,4 +322,66 @@ namespace consumer_test
         validate_syncmap(consumer->m_toSync, 1, key, exp_kofv);
 
     }
+
+    // Processes every entry except the ones keyed "retry"
+    struct StatsTestOrch : public Orch
+    {
+        StatsTestOrch(swss::DBConnector *db, const string &tableName) : Orch(db, tableName)
+        {
+        }
+
+        void doTask(Consumer &consumer) override
+        {
+            auto it = consumer.m_toSync.begin();
+            while (it != consumer.m_toSync.end())
+            {
+                if (it->first == "retry")
+                {
+                    it++;
+                    continue;
+                }
+                it = consumer.m_toSync.erase(it);
+            }
+        }
+    };
+
+    TEST_F(ConsumerTest, ConsumerStats)
+    {
+        StatsTestOrch orch(m_config_db.get(), "CFG_STATS_TEST_TABLE");
+        Consumer stats_consumer(new swss::ConsumerStateTable(m_config_db.get(), "CFG_STATS_TEST_TABLE", 1, 1),
+                                &orch, "CFG_STATS_TEST_TABLE");
+
+        stats_consumer.addToSync(deque<KeyOpFieldsValuesTuple>({
+            { "done", SET_COMMAND, { { f1, v1a } } },
+            { "retry", SET_COMMAND, { { f1, v1a } } }
+        }));
+
+        stats_consumer.drain();
+        stats_consumer.drain();
+
+        auto &stats = stats_consumer.getStats();
+        ASSERT_EQ(stats.drains, 2);
+        ASSERT_EQ(stats.completed, 1);
+        ASSERT_EQ(stats.retries, 2);
+        ASSERT_EQ(stats.latency[0], 1);
+
+        // A DEL replacing the pending task does not complete the key
+        stats_consumer.addToSync(deque<KeyOpFieldsValuesTuple>({ { "retry", DEL_COMMAND, { {} } } }));
+        ASSERT_EQ(stats_consumer.m_toSync.size(), 1);
+        ASSERT_EQ(stats.completed, 1);
+
+        // Nothing pending, nothing to run
+        stats_consumer.m_toSync.clear();
+        stats_consumer.drain();
+        ASSERT_EQ(stats.drains, 2);
+
+        vector<FieldValueTuple> fvs;
+        stats_consumer.dumpStats(fvs);
+        map<string, string> fields(fvs.begin(), fvs.end());
+        ASSERT_EQ(fields["pending"], "0");
+        ASSERT_EQ(fields["completed"], "1");
+        ASSERT_EQ(fields["retries"], "2");
+        ASSERT_EQ(fields["latency_lt_1ms"], "1");
+        ASSERT_EQ(stats.maxDrainTimeUs, 0);
+    }
 }
@@ -0,0 +1,90 @@
+#include "ut_helper.h"
+#include "counterrateorch.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace counterrateorch_test
+{
+    using namespace std;
+
+    /* Port rates, counters are IN_UCAST, IN_NON_UCAST, OUT_UCAST, OUT_NON_UCAST, IN_OCTETS, OUT_OCTETS */
+    enum
+    {
+        RX_BPS,
+        RX_PPS,
+        TX_BPS,
+        TX_PPS
+    };
+
+    const CounterRateType &portType()
+    {
+        const auto &types = CounterRateOrch::getCounterRateTypes();
+        auto it = find_if(types.begin(), types.end(),
+                          [](const CounterRateType &type) { return type.name == COUNTER_RATE_PORT; });
+        return *it;
+    }
+
+    TEST(CounterRateOrchTest, PortRates)
+    {
+        const auto &type = portType();
+        CounterRateEntry entry;
+
+        CounterRateOrch::updateRates(type, entry, { 100, 10, 200, 20, 1000, 2000 }, 0.5, 1000);
+        ASSERT_EQ(entry.state, CounterRateState::COUNTERS_LAST);
+        ASSERT_TRUE(entry.rates.empty());
+
+        /* First rates are stored as is */
+        CounterRateOrch::updateRates(type, entry, { 200, 30, 400, 40, 3000, 6000 }, 0.5, 1000);
+        ASSERT_EQ(entry.state, CounterRateState::DONE);
+        ASSERT_DOUBLE_EQ(entry.rates[RX_BPS], 2000);
+        ASSERT_DOUBLE_EQ(entry.rates[RX_PPS], 120);
+        ASSERT_DOUBLE_EQ(entry.rates[TX_BPS], 4000);
+        ASSERT_DOUBLE_EQ(entry.rates[TX_PPS], 220);
+
+        /* Next ones are smoothed, and scaled by the elapsed time */
+        CounterRateOrch::updateRates(type, entry, { 200, 30, 400, 40, 11000, 6000 }, 0.5, 2000);
+        ASSERT_DOUBLE_EQ(entry.rates[RX_BPS], 0.5 * 4000 + 0.5 * 2000);
+        ASSERT_DOUBLE_EQ(entry.rates[RX_PPS], 0.5 * 120);
+        ASSERT_DOUBLE_EQ(entry.rates[TX_BPS], 0.5 * 4000);
+        ASSERT_DOUBLE_EQ(entry.rates[TX_PPS], 0.5 * 220);
+    }
+
+    TEST(CounterRateOrchTest, WrappedCounter)
+    {
+        const auto &type = portType();
+        CounterRateEntry entry;
+        uint64_t max = numeric_limits<uint64_t>::max();
+
+        CounterRateOrch::updateRates(type, entry, { 0, 0, 0, 0, max - 99, 0 }, 1.0, 1000);
+        CounterRateOrch::updateRates(type, entry, { 0, 0, 0, 0, 400, 0 }, 1.0, 1000);
+        ASSERT_DOUBLE_EQ(entry.rates[RX_BPS], 500);
+    }
+
+    TEST(CounterRateOrchTest, ZeroInterval)
+    {
+        const auto &type = portType();
+        CounterRateEntry entry;
+
+        CounterRateOrch::updateRates(type, entry, { 1, 1, 1, 1, 1, 1 }, 0.5, 1000);
+        CounterRateOrch::updateRates(type, entry, { 2, 2, 2, 2, 2, 2 }, 0.5, 0);
+        ASSERT_EQ(entry.state, CounterRateState::COUNTERS_LAST);
+        ASSERT_EQ(entry.last, vector<uint64_t>({ 1, 1, 1, 1, 1, 1 }));
+    }
+
+    TEST(CounterRateOrchTest, SameSyncdPoll)
+    {
+        const auto &type = portType();
+        CounterRateEntry entry;
+
+        ASSERT_TRUE(CounterRateOrch::isNewSnapshot(entry, { 1, 1, 1, 1, 1, 1 }, 0, 1000));
+        CounterRateOrch::updateRates(type, entry, { 1, 1, 1, 1, 1, 1 }, 0.5, 1000);
+
+        /* Unchanged counters were read within the same syncd poll */
+        ASSERT_FALSE(CounterRateOrch::isNewSnapshot(entry, { 1, 1, 1, 1, 1, 1 }, 1000, 1000));
+        ASSERT_TRUE(CounterRateOrch::isNewSnapshot(entry, { 1, 1, 1, 1, 2, 1 }, 1000, 1000));
+
+        /* Idle counters still bring the rates down to zero */
+        ASSERT_TRUE(CounterRateOrch::isNewSnapshot(entry, { 1, 1, 1, 1, 1, 1 }, 2000, 1000));
+    }
+}
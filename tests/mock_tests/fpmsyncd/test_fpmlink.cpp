@@ -5,6 +5,9 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <chrono>
+#include <thread>
+
 using namespace swss;
 
 using ::testing::_;
@@ -66,3 +69,100 @@ TEST_F(FpmLinkTest, TwoNlMessagesInFpmMessage)
     m_fpm.processFpmMessage(reinterpret_cast<fpm_msg_hdr_t*>(static_cast<void*>(fpmMsgBuffer)));
 }
 
+
+TEST_F(FpmLinkTest, FpmMessageSplitAcrossReads)
+{
+    alignas(fpm_msg_hdr_t) unsigned char fpmMsgBuffer[] = {
+        0x01, 0x01, 0x00, 0x40, 0x3C, 0x00, 0x00, 0x00, 0x18, 0x00, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0xE0,
+        0x12, 0x6F, 0xC4, 0x02, 0x18, 0x00, 0x00, 0xFE, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+        0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x08, 0x00, 0x06, 0x00, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x05,
+        0x00, 0xAC, 0x1E, 0x38, 0xA6, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00
+    };
+
+    int client = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP);
+    ASSERT_GE(client, 0);
+
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(FPM_DEFAULT_PORT);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ASSERT_EQ(connect(client, (struct sockaddr *)&addr, sizeof(addr)), 0);
+
+    m_fpm.accept();
+
+    auto waitForData = [this]() {
+        for (int i = 0; i < 1000 && !m_fpm.hasCachedData(); i++)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return m_fpm.hasCachedData();
+    };
+
+    // Header and message body arrive in separate reads
+    ASSERT_EQ(write(client, fpmMsgBuffer, 10), 10);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    EXPECT_FALSE(m_fpm.hasCachedData());
+    ASSERT_EQ(write(client, fpmMsgBuffer + 10, sizeof(fpmMsgBuffer) - 10), (ssize_t)(sizeof(fpmMsgBuffer) - 10));
+
+    EXPECT_CALL(m_mock, onMsg(_, _)).Times(1);
+
+    ASSERT_TRUE(waitForData());
+    m_fpm.readData();
+
+    auto stats = m_fpm.getStats();
+    EXPECT_EQ(stats.rxBytes, sizeof(fpmMsgBuffer));
+    EXPECT_EQ(stats.rxMessages, 1);
+    EXPECT_EQ(stats.maxMessageSize, sizeof(fpmMsgBuffer));
+    EXPECT_EQ(stats.queueDepth, 0);
+
+    // Connection close is reported once queued messages are consumed
+    close(client);
+    ASSERT_TRUE(waitForData());
+    EXPECT_THROW(m_fpm.readData(), FpmLink::FpmConnectionClosedException);
+}
+
+TEST_F(FpmLinkTest, BurstTailHandedOverWhenLinkGoesQuiet)
+{
+    alignas(fpm_msg_hdr_t) unsigned char fpmMsgBuffer[] = {
+        0x01, 0x01, 0x00, 0x40, 0x3C, 0x00, 0x00, 0x00, 0x18, 0x00, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0xE0,
+        0x12, 0x6F, 0xC4, 0x02, 0x18, 0x00, 0x00, 0xFE, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+        0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x08, 0x00, 0x06, 0x00, 0x14, 0x00, 0x00, 0x00, 0x08, 0x00, 0x05,
+        0x00, 0xAC, 0x1E, 0x38, 0xA6, 0x08, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00
+    };
+
+    int client = socket(PF_INET, SOCK_STREAM, IPPROTO_TCP);
+    ASSERT_GE(client, 0);
+
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(FPM_DEFAULT_PORT);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ASSERT_EQ(connect(client, (struct sockaddr *)&addr, sizeof(addr)), 0);
+
+    m_fpm.accept();
+
+    auto waitForQueueDepth = [this](uint64_t depth) {
+        for (int i = 0; i < 1000 && m_fpm.getStats().queueDepth < depth; i++)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return m_fpm.getStats().queueDepth == depth;
+    };
+
+    // The first message is handed over right away, the link is idle
+    ASSERT_EQ(write(client, fpmMsgBuffer, sizeof(fpmMsgBuffer)), (ssize_t)sizeof(fpmMsgBuffer));
+    ASSERT_TRUE(waitForQueueDepth(1));
+
+    // The end of the burst is handed over too while the first buffer is still queued,
+    // nothing follows it on the link
+    ASSERT_EQ(write(client, fpmMsgBuffer, sizeof(fpmMsgBuffer)), (ssize_t)sizeof(fpmMsgBuffer));
+    ASSERT_TRUE(waitForQueueDepth(2));
+
+    EXPECT_CALL(m_mock, onMsg(_, _)).Times(2);
+
+    m_fpm.readData();
+    m_fpm.readData();
+    EXPECT_FALSE(m_fpm.hasCachedData());
+
+    close(client);
+}
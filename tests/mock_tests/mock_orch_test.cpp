@@ -0,0 +1,217 @@
+#define private public // make Directory::m_values available to clean it.
+#include "directory.h"
+#undef private
+#include "mock_orch_test.h"
+
+extern string gMySwitchType;
+
+namespace mock_orch_test
+{
+    void MockOrchTest::SetUp()
+    {
+        ASSERT_EQ(sai_route_api, nullptr);
+        map<string, string> profile = {
+            { "SAI_VS_SWITCH_TYPE", "SAI_VS_SWITCH_TYPE_BCM56850" },
+            { "KV_DEVICE_MAC_ADDRESS", "20:03:04:05:06:00" }
+        };
+
+        ut_helper::initSaiApi(profile);
+        ApplySaiHooks();
+
+        // Init switch and create dependencies
+        m_app_db = make_shared<swss::DBConnector>("APPL_DB", 0);
+        m_config_db = make_shared<swss::DBConnector>("CONFIG_DB", 0);
+        m_state_db = make_shared<swss::DBConnector>("STATE_DB", 0);
+        if(gMySwitchType == "voq")
+            m_chassis_app_db = make_shared<swss::DBConnector>("CHASSIS_APP_DB", 0);
+
+        sai_attribute_t attr;
+
+        attr.id = SAI_SWITCH_ATTR_INIT_SWITCH;
+        attr.value.booldata = true;
+
+        auto status = sai_switch_api->create_switch(&gSwitchId, 1, &attr);
+        ASSERT_EQ(status, SAI_STATUS_SUCCESS);
+
+        // Get switch source MAC address
+        attr.id = SAI_SWITCH_ATTR_SRC_MAC_ADDRESS;
+        status = sai_switch_api->get_switch_attribute(gSwitchId, 1, &attr);
+        ASSERT_EQ(status, SAI_STATUS_SUCCESS);
+        gMacAddress = attr.value.mac;
+
+        // Get the default virtual router ID
+        attr.id = SAI_SWITCH_ATTR_DEFAULT_VIRTUAL_ROUTER_ID;
+        status = sai_switch_api->get_switch_attribute(gSwitchId, 1, &attr);
+        ASSERT_EQ(status, SAI_STATUS_SUCCESS);
+        gVirtualRouterId = attr.value.oid;
+
+        ASSERT_EQ(gCrmOrch, nullptr);
+        gCrmOrch = new CrmOrch(m_config_db.get(), CFG_CRM_TABLE_NAME);
+
+        TableConnector stateDbSwitchTable(m_state_db.get(), "SWITCH_CAPABILITY");
+        TableConnector conf_asic_sensors(m_config_db.get(), CFG_ASIC_SENSORS_TABLE_NAME);
+        TableConnector app_switch_table(m_app_db.get(),  APP_SWITCH_TABLE_NAME);
+
+        vector<TableConnector> switch_tables = {
+            conf_asic_sensors,
+            app_switch_table
+        };
+
+        ASSERT_EQ(gSwitchOrch, nullptr);
+        gSwitchOrch = new SwitchOrch(m_app_db.get(), switch_tables, stateDbSwitchTable);
+
+        const int portsorch_base_pri = 40;
+
+        vector<table_name_with_pri_t> ports_tables = {
+            { APP_PORT_TABLE_NAME, portsorch_base_pri + 5 },
+            { APP_VLAN_TABLE_NAME, portsorch_base_pri + 2 },
+            { APP_VLAN_MEMBER_TABLE_NAME, portsorch_base_pri },
+            { APP_LAG_TABLE_NAME, portsorch_base_pri + 4 },
+            { APP_LAG_MEMBER_TABLE_NAME, portsorch_base_pri }
+        };
+
+        ASSERT_EQ(gPortsOrch, nullptr);
+        gPortsOrch = new PortsOrch(m_app_db.get(), m_state_db.get(), ports_tables, m_chassis_app_db.get());
+
+        vector<string> flex_counter_tables = {
+            CFG_FLEX_COUNTER_TABLE_NAME
+        };
+        m_flexCounterOrch = new FlexCounterOrch(m_config_db.get(), flex_counter_tables);
+        gDirectory.set(m_flexCounterOrch);
+
+        static const  vector<string> route_pattern_tables = {
+            CFG_FLOW_COUNTER_ROUTE_PATTERN_TABLE_NAME,
+        };
+        gFlowCounterRouteOrch = new FlowCounterRouteOrch(m_config_db.get(), route_pattern_tables);
+        gDirectory.set(gFlowCounterRouteOrch);
+
+        ASSERT_EQ(gVrfOrch, nullptr);
+        gVrfOrch = new VRFOrch(m_app_db.get(), APP_VRF_TABLE_NAME, m_state_db.get(), STATE_VRF_OBJECT_TABLE_NAME);
+
+        ASSERT_EQ(gIntfsOrch, nullptr);
+        gIntfsOrch = new IntfsOrch(m_app_db.get(), APP_INTF_TABLE_NAME, gVrfOrch, m_chassis_app_db.get());
+
+        const int fdborch_pri = 20;
+
+        vector<table_name_with_pri_t> app_fdb_tables = {
+            { APP_FDB_TABLE_NAME,        FdbOrch::fdborch_pri},
+            { APP_VXLAN_FDB_TABLE_NAME,  FdbOrch::fdborch_pri},
+            { APP_MCLAG_FDB_TABLE_NAME,  fdborch_pri}
+        };
+
+        TableConnector stateDbFdb(m_state_db.get(), STATE_FDB_TABLE_NAME);
+        TableConnector stateMclagDbFdb(m_state_db.get(), STATE_MCLAG_REMOTE_FDB_TABLE_NAME);
+        ASSERT_EQ(gFdbOrch, nullptr);
+        gFdbOrch = new FdbOrch(m_app_db.get(), app_fdb_tables, stateDbFdb, stateMclagDbFdb, gPortsOrch);
+
+        ASSERT_EQ(gNeighOrch, nullptr);
+        gNeighOrch = new NeighOrch(m_app_db.get(), APP_NEIGH_TABLE_NAME, gIntfsOrch, gFdbOrch, gPortsOrch, m_chassis_app_db.get());
+
+        m_tunnelDecapOrch = new TunnelDecapOrch(m_app_db.get(), APP_TUNNEL_DECAP_TABLE_NAME);
+        vector<string> mux_tables = {
+            CFG_MUX_CABLE_TABLE_NAME,
+            CFG_PEER_SWITCH_TABLE_NAME
+        };
+        m_muxOrch = new MuxOrch(m_config_db.get(), mux_tables, m_tunnelDecapOrch, gNeighOrch, gFdbOrch);
+        gDirectory.set(m_muxOrch);
+
+        ASSERT_EQ(gFgNhgOrch, nullptr);
+        const int fgnhgorch_pri = 15;
+
+        vector<table_name_with_pri_t> fgnhg_tables = {
+            { CFG_FG_NHG,                 fgnhgorch_pri },
+            { CFG_FG_NHG_PREFIX,          fgnhgorch_pri },
+            { CFG_FG_NHG_MEMBER,          fgnhgorch_pri }
+        };
+        gFgNhgOrch = new FgNhgOrch(m_config_db.get(), m_app_db.get(), m_state_db.get(), fgnhg_tables, gNeighOrch, gIntfsOrch, gVrfOrch);
+
+        ASSERT_EQ(gSrv6Orch, nullptr);
+        vector<string> srv6_tables = {
+            APP_SRV6_SID_LIST_TABLE_NAME,
+            APP_SRV6_MY_SID_TABLE_NAME
+        };
+        gSrv6Orch = new Srv6Orch(m_app_db.get(), srv6_tables, gSwitchOrch, gVrfOrch, gNeighOrch);
+
+        ASSERT_EQ(gRouteOrch, nullptr);
+        const int routeorch_pri = 5;
+        vector<table_name_with_pri_t> route_tables = {
+            { APP_ROUTE_TABLE_NAME,        routeorch_pri },
+            { APP_LABEL_ROUTE_TABLE_NAME,  routeorch_pri }
+        };
+        gRouteOrch = new RouteOrch(m_app_db.get(), route_tables, gSwitchOrch, gNeighOrch, gIntfsOrch, gVrfOrch, gFgNhgOrch, gSrv6Orch);
+
+        Table portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+
+        // Get SAI default ports to populate DB
+        auto ports = ut_helper::getInitialSaiPorts();
+
+        // Populate pot table with SAI ports
+        for (const auto &it : ports)
+        {
+            portTable.set(it.first, it.second);
+        }
+
+        // Set PortConfigDone
+        portTable.set("PortConfigDone", { { "count", to_string(ports.size()) } });
+        gPortsOrch->addExistingData(&portTable);
+        static_cast<Orch *>(gPortsOrch)->doTask();
+
+        portTable.set("PortInitDone", { { "lanes", "0" } });
+        gPortsOrch->addExistingData(&portTable);
+        static_cast<Orch *>(gPortsOrch)->doTask();
+
+        PostSetUp();
+    }
+
+    void MockOrchTest::TearDown()
+    {
+        PreTearDown();
+
+        gDirectory.m_values.clear();
+
+        delete gRouteOrch;
+        gRouteOrch = nullptr;
+
+        delete gSrv6Orch;
+        gSrv6Orch = nullptr;
+
+        delete gFgNhgOrch;
+        gFgNhgOrch = nullptr;
+
+        delete m_muxOrch;
+        m_muxOrch = nullptr;
+
+        delete m_tunnelDecapOrch;
+        m_tunnelDecapOrch = nullptr;
+
+        delete gNeighOrch;
+        gNeighOrch = nullptr;
+
+        delete gFdbOrch;
+        gFdbOrch = nullptr;
+
+        delete gIntfsOrch;
+        gIntfsOrch = nullptr;
+
+        delete gVrfOrch;
+        gVrfOrch = nullptr;
+
+        delete gFlowCounterRouteOrch;
+        gFlowCounterRouteOrch = nullptr;
+
+        delete m_flexCounterOrch;
+        m_flexCounterOrch = nullptr;
+
+        delete gPortsOrch;
+        gPortsOrch = nullptr;
+
+        delete gSwitchOrch;
+        gSwitchOrch = nullptr;
+
+        delete gCrmOrch;
+        gCrmOrch = nullptr;
+
+        RemoveSaiHooks();
+        ut_helper::uninitSaiApi();
+    }
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "ut_helper.h"
+#include "mock_orchagent_main.h"
+
+namespace mock_orch_test
+{
+    using namespace std;
+
+    /*
+     * Mocked orchagent on the virtual switch with the orchs the routing
+     * tests depend on, from SwitchOrch up to RouteOrch, and the SAI ports
+     * populated. Fixtures add their own orchs and configuration in
+     * PostSetUp() and remove them in PreTearDown(), SAI API stubs are
+     * installed in ApplySaiHooks() before any orch is created.
+     */
+    struct MockOrchTest : public ::testing::Test
+    {
+        shared_ptr<swss::DBConnector> m_app_db;
+        shared_ptr<swss::DBConnector> m_config_db;
+        shared_ptr<swss::DBConnector> m_state_db;
+        shared_ptr<swss::DBConnector> m_chassis_app_db;
+
+        FlexCounterOrch *m_flexCounterOrch = nullptr;
+        TunnelDecapOrch *m_tunnelDecapOrch = nullptr;
+        MuxOrch *m_muxOrch = nullptr;
+
+        void SetUp() override;
+        void TearDown() override;
+
+        virtual void ApplySaiHooks() {}
+        virtual void RemoveSaiHooks() {}
+        virtual void PostSetUp() {}
+        virtual void PreTearDown() {}
+    };
+}
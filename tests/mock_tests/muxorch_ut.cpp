@@ -0,0 +1,156 @@
+#define protected public
+#include "orch.h"
+#undef protected
+#define private public
+#include "muxorch.h"
+#undef private
+#include "ut_helper.h"
+#include "mock_orchagent_main.h"
+#include "mock_orch_test.h"
+#include "mock_table.h"
+
+namespace muxorch_test
+{
+    using namespace std;
+    using namespace mock_orch_test;
+
+    struct MuxOrchTest : public MockOrchTest
+    {
+        void PostSetUp() override
+        {
+            m_muxOrch->mux_peer_switch_ = IpAddress("10.1.0.32");
+
+            Table vlanTable = Table(m_app_db.get(), APP_VLAN_TABLE_NAME);
+            vlanTable.set("Vlan1000", { { "admin_status", "up" }, { "mtu", "9100" } });
+            gPortsOrch->addExistingData(&vlanTable);
+            static_cast<Orch *>(gPortsOrch)->doTask();
+        }
+
+        /*
+         * Configure or remove the MUX cable of a port as the MUX_CABLE table does.
+         * The ports are not in the port table, so that the cables are created in
+         * standby without programming neighbors or ACLs.
+         */
+        void setMuxCable(const string &op, const string &port, const string &server_ipv4, const string &server_ipv6)
+        {
+            KeyOpFieldsValuesTuple t { port, op,
+                                       {
+                                           { "server_ipv4", server_ipv4 },
+                                           { "server_ipv6", server_ipv6 },
+                                       }
+                                     };
+            MuxCfgRequest request;
+            request.parse(t);
+            ASSERT_TRUE(m_muxOrch->handleMuxCfg(request));
+        }
+
+        MuxCable *findCable(const string &ip)
+        {
+            return m_muxOrch->findMuxCableInSubnet(IpAddress(ip));
+        }
+
+        string getMuxPort(const MacAddress &mac)
+        {
+            string port;
+            EXPECT_TRUE(m_muxOrch->getMuxPort(mac, "Vlan1000", port));
+            return port;
+        }
+
+        void notifyFdb(const MacAddress &mac, sai_object_id_t bv_id, const string &port, bool add)
+        {
+            FdbUpdate update;
+            update.entry = { mac, bv_id, port };
+            update.type = "dynamic";
+            update.add = add;
+            m_muxOrch->update(SUBJECT_TYPE_FDB_CHANGE, &update);
+        }
+    };
+
+    TEST_F(MuxOrchTest, FindMuxCableByLongestServerPrefix)
+    {
+        setMuxCable(SET_COMMAND, "MuxPort0", "192.168.0.2/32", "fc02:1000::2/128");
+        setMuxCable(SET_COMMAND, "MuxPort1", "192.168.0.0/24", "fc02:1000::/64");
+
+        auto cable0 = m_muxOrch->getMuxCable("MuxPort0");
+        auto cable1 = m_muxOrch->getMuxCable("MuxPort1");
+
+        // The most specific server prefix wins, whatever the cable names
+        ASSERT_EQ(findCable("192.168.0.2"), cable0);
+        ASSERT_EQ(findCable("fc02:1000::2"), cable0);
+        ASSERT_EQ(findCable("192.168.0.3"), cable1);
+        ASSERT_EQ(findCable("fc02:1000::3"), cable1);
+        ASSERT_EQ(findCable("192.168.1.2"), nullptr);
+        ASSERT_EQ(findCable("fc02:1001::2"), nullptr);
+
+        // The covering prefix takes over the IPs of a removed cable
+        setMuxCable(DEL_COMMAND, "MuxPort0", "192.168.0.2/32", "fc02:1000::2/128");
+        ASSERT_EQ(findCable("192.168.0.2"), cable1);
+        ASSERT_EQ(findCable("fc02:1000::2"), cable1);
+
+        setMuxCable(DEL_COMMAND, "MuxPort1", "192.168.0.0/24", "fc02:1000::/64");
+        ASSERT_EQ(findCable("192.168.0.2"), nullptr);
+        ASSERT_TRUE(m_muxOrch->mux_subnet_index_.empty());
+    }
+
+    TEST_F(MuxOrchTest, DuplicateServerPrefixResolvesToLastCable)
+    {
+        setMuxCable(SET_COMMAND, "MuxPort1", "192.168.0.2/32", "fc02:1000::2/128");
+        setMuxCable(SET_COMMAND, "MuxPort0", "192.168.0.2/32", "fc02:1000::3/128");
+
+        auto cable0 = m_muxOrch->getMuxCable("MuxPort0");
+        auto cable1 = m_muxOrch->getMuxCable("MuxPort1");
+
+        // The prefix configured last wins, not the first cable by name
+        ASSERT_EQ(findCable("192.168.0.2"), cable0);
+        ASSERT_EQ(findCable("fc02:1000::2"), cable1);
+
+        // Removing a cable which does not own the prefix keeps it in place
+        setMuxCable(DEL_COMMAND, "MuxPort1", "192.168.0.2/32", "fc02:1000::2/128");
+        ASSERT_EQ(findCable("192.168.0.2"), cable0);
+        ASSERT_EQ(findCable("fc02:1000::2"), nullptr);
+
+        // The prefix passes to the remaining cable configured with it
+        setMuxCable(SET_COMMAND, "MuxPort1", "192.168.0.2/32", "fc02:1000::2/128");
+        cable1 = m_muxOrch->getMuxCable("MuxPort1");
+        ASSERT_EQ(findCable("192.168.0.2"), cable1);
+
+        setMuxCable(DEL_COMMAND, "MuxPort1", "192.168.0.2/32", "fc02:1000::2/128");
+        ASSERT_EQ(findCable("192.168.0.2"), cable0);
+    }
+
+    TEST_F(MuxOrchTest, FdbPortCacheEviction)
+    {
+        Port vlan;
+        ASSERT_TRUE(gPortsOrch->getPort("Vlan1000", vlan));
+        auto bv_id = vlan.m_vlan_info.vlan_oid;
+
+        MacAddress mac1("00:11:22:33:44:01");
+        MacAddress mac2("00:11:22:33:44:02");
+
+        // Not notified by FdbOrch, the lookup falls back to the FDB
+        ASSERT_EQ(getMuxPort(mac1), "");
+
+        notifyFdb(mac1, bv_id, "Ethernet4", true);
+        notifyFdb(mac2, bv_id, "Ethernet8", true);
+        ASSERT_EQ(getMuxPort(mac1), "Ethernet4");
+        ASSERT_EQ(getMuxPort(mac2), "Ethernet8");
+
+        // A MAC move replaces the cached port
+        notifyFdb(mac1, bv_id, "Ethernet12", true);
+        ASSERT_EQ(getMuxPort(mac1), "Ethernet12");
+
+        // Deleted entries are evicted
+        notifyFdb(mac1, bv_id, "Ethernet12", false);
+        ASSERT_EQ(getMuxPort(mac1), "");
+        ASSERT_EQ(getMuxPort(mac2), "Ethernet8");
+
+        // and so are flushed ones
+        notifyFdb(mac1, bv_id, "Ethernet4", true);
+        FdbFlushUpdate flush;
+        flush.entries = { { mac1, bv_id, "Ethernet4" }, { mac2, bv_id, "Ethernet8" } };
+        m_muxOrch->update(SUBJECT_TYPE_FDB_FLUSH_CHANGE, &flush);
+        ASSERT_EQ(getMuxPort(mac1), "");
+        ASSERT_EQ(getMuxPort(mac2), "");
+        ASSERT_TRUE(m_muxOrch->fdb_port_cache_.empty());
+    }
+}
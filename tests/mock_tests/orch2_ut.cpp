@@ -0,0 +1,140 @@
+#define protected public
+#include "orch.h"
+#undef protected
+#include "ut_helper.h"
+#include "mock_orchagent_main.h"
+#include "mock_table.h"
+#include "request_parser.h"
+
+namespace orch2_test
+{
+    using namespace std;
+
+    const request_description_t test_request_description = {
+        { REQ_T_STRING },
+        {
+            { "value", REQ_T_STRING },
+        },
+        { }
+    };
+
+    class TestRequest : public Request
+    {
+    public:
+        TestRequest() : Request(test_request_description, ':') { }
+    };
+
+    // Logs the operations in the order they run, the batches of the bulk mode included
+    class TestOrch2 : public Orch2
+    {
+    public:
+        TestOrch2(swss::DBConnector *db, const string &tableName) : Orch2(db, tableName, request_)
+        {
+        }
+
+        void enableBulkMode()
+        {
+            setBulkMode(true);
+        }
+
+        vector<string> log;
+        // Number of times the requests of this key are retried before they succeed
+        map<string, int> retries;
+
+    private:
+        TestRequest request_;
+
+        void addOperations(vector<Orch2BulkRequest> &requests) override
+        {
+            log.push_back("batch " + to_string(requests.size()));
+            Orch2::addOperations(requests);
+        }
+
+        bool addOperation(const Request &request) override
+        {
+            const auto &key = request.getKeyString(0);
+            if (retries[key] > 0)
+            {
+                retries[key]--;
+                log.push_back("retry " + key);
+                return false;
+            }
+            log.push_back("add " + key + "=" + request.getAttrString("value"));
+            return true;
+        }
+
+        bool delOperation(const Request &request) override
+        {
+            log.push_back("del " + request.getKeyString(0));
+            return true;
+        }
+    };
+
+    struct Orch2Test : public ::testing::Test
+    {
+        shared_ptr<swss::DBConnector> m_app_db;
+        unique_ptr<TestOrch2> m_orch;
+        Consumer *m_consumer;
+
+        void SetUp() override
+        {
+            ::testing_db::reset();
+
+            m_app_db = make_shared<swss::DBConnector>("APPL_DB", 0);
+            m_orch = unique_ptr<TestOrch2>(new TestOrch2(m_app_db.get(), "TEST_ORCH2_TABLE"));
+            m_orch->enableBulkMode();
+            m_consumer = dynamic_cast<Consumer *>(m_orch->getExecutor("TEST_ORCH2_TABLE"));
+        }
+
+        void TearDown() override
+        {
+            m_orch.reset();
+            ::testing_db::reset();
+        }
+
+        void drain(const deque<KeyOpFieldsValuesTuple> &entries)
+        {
+            m_orch->log.clear();
+            m_consumer->addToSync(entries);
+            static_cast<Orch *>(m_orch.get())->doTask(*m_consumer);
+        }
+    };
+
+    TEST_F(Orch2Test, BulkSetDelSetSameKey)
+    {
+        drain({
+            { "a", SET_COMMAND, { { "value", "1" } } },
+            { "b", SET_COMMAND, { { "value", "1" } } }
+        });
+        ASSERT_EQ(m_orch->log, vector<string>({ "batch 2", "add a=1", "add b=1" }));
+        ASSERT_TRUE(m_consumer->m_toSync.empty());
+
+        // The DEL ends the batch, the SET which follows it goes to a new one
+        drain({
+            { "a", SET_COMMAND, { { "value", "2" } } },
+            { "a", DEL_COMMAND, { } },
+            { "a", SET_COMMAND, { { "value", "3" } } },
+            { "c", SET_COMMAND, { { "value", "1" } } }
+        });
+        ASSERT_EQ(m_orch->log, vector<string>({ "del a", "batch 2", "add a=3", "add c=1" }));
+        ASSERT_TRUE(m_consumer->m_toSync.empty());
+    }
+
+    TEST_F(Orch2Test, BulkRetriedRequest)
+    {
+        m_orch->retries["b"] = 1;
+
+        drain({
+            { "a", SET_COMMAND, { { "value", "1" } } },
+            { "b", SET_COMMAND, { { "value", "1" } } },
+            { "c", SET_COMMAND, { { "value", "1" } } }
+        });
+        ASSERT_EQ(m_orch->log, vector<string>({ "batch 3", "add a=1", "retry b", "add c=1" }));
+
+        // Only the retried request is left, with the update received in between
+        ASSERT_EQ(m_consumer->m_toSync.size(), 1);
+        drain({ { "b", SET_COMMAND, { { "value", "2" } } } });
+        ASSERT_EQ(m_orch->log, vector<string>({ "batch 1", "add b=2" }));
+        ASSERT_TRUE(m_consumer->m_toSync.empty());
+    }
+}
@@ -138,6 +138,22 @@ namespace portsorch_test
         return SAI_STATUS_SUCCESS;
     }
 
+    // Packets counted on every queue, read by the PFC watchdog handlers
+    uint64_t _sai_queue_packets = 0;
+
+    sai_status_t _ut_stub_sai_get_queue_stats(
+        _In_ sai_object_id_t queue_id,
+        _In_ uint32_t number_of_counters,
+        _In_ const sai_stat_id_t *counter_ids,
+        _Out_ uint64_t *counters)
+    {
+        for (uint32_t i = 0; i < number_of_counters; i++)
+        {
+            counters[i] = counter_ids[i] == SAI_QUEUE_STAT_PACKETS ? _sai_queue_packets : 0;
+        }
+        return SAI_STATUS_SUCCESS;
+    }
+
     void _hook_sai_queue_api()
     {
         ut_sai_queue_api = *sai_queue_api;
@@ -797,6 +813,60 @@ namespace portsorch_test
         _unhook_sai_queue_api();
     }
 
+    TEST_F(PortsOrchTest, PfcWdHandlerCommitCountersDelta)
+    {
+        _hook_sai_queue_api();
+        ut_sai_queue_api.get_queue_stats = _ut_stub_sai_get_queue_stats;
+        Table portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+
+        // Get SAI default ports to populate DB
+        auto ports = ut_helper::getInitialSaiPorts();
+
+        // Populate port table with SAI ports
+        for (const auto &it : ports)
+        {
+            portTable.set(it.first, it.second);
+        }
+
+        // Set PortConfigDone, PortInitDone
+        portTable.set("PortConfigDone", { { "count", to_string(ports.size()) } });
+        portTable.set("PortInitDone", { { "lanes", "0" } });
+
+        // refill consumer
+        gPortsOrch->addExistingData(&portTable);
+
+        // Apply configuration :
+        //  create ports
+
+        static_cast<Orch *>(gPortsOrch)->doTask();
+
+        // Apply configuration
+        //          ports
+        static_cast<Orch *>(gPortsOrch)->doTask();
+
+        ASSERT_TRUE(gPortsOrch->allPortsReady());
+
+        // Simulate storm drop handler started on Ethernet0 TC 3
+        Port port;
+        gPortsOrch->getPort("Ethernet0", port);
+        auto countersTable = make_shared<Table>(m_counters_db.get(), COUNTERS_TABLE);
+        auto dropHandler = make_unique<PfcWdDlrHandler>(port.m_port_id, port.m_queue_ids[3], 3, countersTable);
+
+        // Periodic commit pushes the counters read since the handler was created
+        RedisPipeline countersPipe(m_counters_db.get());
+        _sai_queue_packets = 100;
+        ASSERT_TRUE(dropHandler->commitCountersDelta(countersPipe));
+
+        // and skips the queue when counters did not change since the last commit
+        ASSERT_FALSE(dropHandler->commitCountersDelta(countersPipe));
+        countersPipe.flush();
+
+        dropHandler.reset();
+        _sai_queue_packets = 0;
+
+        _unhook_sai_queue_api();
+    }
+
     TEST_F(PortsOrchTest, PfcZeroBufferHandler)
     {
         Table portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
@@ -1,25 +1,19 @@
-#define private public // make Directory::m_values available to clean it.
-#include "directory.h"
-#undef private
 #define protected public
 #include "orch.h"
 #undef protected
 #include "ut_helper.h"
 #include "mock_orchagent_main.h"
+#include "mock_orch_test.h"
 #include "mock_table.h"
 #include "bulker.h"
 
-extern string gMySwitchType;
+extern sai_next_hop_group_api_t* sai_next_hop_group_api;
 
 
 namespace routeorch_test
 {
     using namespace std;
-
-    shared_ptr<swss::DBConnector> m_app_db;
-    shared_ptr<swss::DBConnector> m_config_db;
-    shared_ptr<swss::DBConnector> m_state_db;
-    shared_ptr<swss::DBConnector> m_chassis_app_db;
+    using namespace mock_orch_test;
 
     int create_route_count;
     int set_route_count;
@@ -33,6 +27,59 @@ namespace routeorch_test
     sai_bulk_remove_route_entry_fn              old_remove_route_entries;
     sai_bulk_set_route_entry_attribute_fn       old_set_route_entries_attribute;
 
+    sai_next_hop_group_api_t ut_sai_next_hop_group_api;
+    sai_next_hop_group_api_t *pold_sai_next_hop_group_api;
+
+    // Number of trailing next hop group members the next bulk call does not execute
+    uint32_t nhgm_not_executed_count;
+
+    sai_status_t _ut_stub_sai_bulk_create_next_hop_group_members(
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t object_count,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_object_id_t *object_id,
+        _Out_ sai_status_t *object_statuses)
+    {
+        uint32_t executed = object_count - min(object_count, nhgm_not_executed_count);
+        sai_status_t status = SAI_STATUS_SUCCESS;
+        if (executed)
+        {
+            status = pold_sai_next_hop_group_api->create_next_hop_group_members(switch_id, executed, attr_count,
+                                                                               attr_list, mode, object_id, object_statuses);
+        }
+        for (uint32_t i = executed; i < object_count; i++)
+        {
+            object_id[i] = SAI_NULL_OBJECT_ID;
+            object_statuses[i] = SAI_STATUS_NOT_EXECUTED;
+            status = SAI_STATUS_FAILURE;
+        }
+        nhgm_not_executed_count = 0;
+        return status;
+    }
+
+    sai_status_t _ut_stub_sai_bulk_remove_next_hop_group_members(
+        _In_ uint32_t object_count,
+        _In_ const sai_object_id_t *object_id,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        uint32_t executed = object_count - min(object_count, nhgm_not_executed_count);
+        sai_status_t status = SAI_STATUS_SUCCESS;
+        if (executed)
+        {
+            status = pold_sai_next_hop_group_api->remove_next_hop_group_members(executed, object_id, mode, object_statuses);
+        }
+        for (uint32_t i = executed; i < object_count; i++)
+        {
+            object_statuses[i] = SAI_STATUS_NOT_EXECUTED;
+            status = SAI_STATUS_FAILURE;
+        }
+        nhgm_not_executed_count = 0;
+        return status;
+    }
+
     sai_status_t _ut_stub_sai_bulk_create_route_entry(
         _In_ uint32_t object_count,
         _In_ const sai_route_entry_t *route_entry,
@@ -89,22 +136,14 @@ namespace routeorch_test
         return old_set_route_entries_attribute(object_count, route_entry, attr_list, mode, object_statuses);
     }
 
-    struct RouteOrchTest : public ::testing::Test
+    struct RouteOrchTest : public MockOrchTest
     {
         RouteOrchTest()
         {
         }
 
-        void SetUp() override
+        void ApplySaiHooks() override
         {
-            ASSERT_EQ(sai_route_api, nullptr);
-            map<string, string> profile = {
-                { "SAI_VS_SWITCH_TYPE", "SAI_VS_SWITCH_TYPE_BCM56850" },
-                { "KV_DEVICE_MAC_ADDRESS", "20:03:04:05:06:00" }
-            };
-
-            ut_helper::initSaiApi(profile);
-
             // Hack the route create function
             old_create_route_entries = sai_route_api->create_route_entries;
             old_remove_route_entries = sai_route_api->remove_route_entries;
@@ -114,137 +153,26 @@ namespace routeorch_test
             ut_sai_route_api = *sai_route_api;
             sai_route_api = &ut_sai_route_api;
 
+            pold_sai_next_hop_group_api = sai_next_hop_group_api;
+            ut_sai_next_hop_group_api = *sai_next_hop_group_api;
+            sai_next_hop_group_api = &ut_sai_next_hop_group_api;
+            sai_next_hop_group_api->create_next_hop_group_members = _ut_stub_sai_bulk_create_next_hop_group_members;
+            sai_next_hop_group_api->remove_next_hop_group_members = _ut_stub_sai_bulk_remove_next_hop_group_members;
+            nhgm_not_executed_count = 0;
+
             sai_route_api->create_route_entries = _ut_stub_sai_bulk_create_route_entry;
             sai_route_api->remove_route_entries = _ut_stub_sai_bulk_remove_route_entry;
             sai_route_api->set_route_entries_attribute = _ut_stub_sai_bulk_set_route_entry_attribute;
+        }
 
-            // Init switch and create dependencies
-            m_app_db = make_shared<swss::DBConnector>("APPL_DB", 0);
-            m_config_db = make_shared<swss::DBConnector>("CONFIG_DB", 0);
-            m_state_db = make_shared<swss::DBConnector>("STATE_DB", 0);
-            if(gMySwitchType == "voq")
-                m_chassis_app_db = make_shared<swss::DBConnector>("CHASSIS_APP_DB", 0);
-
-            sai_attribute_t attr;
-
-            attr.id = SAI_SWITCH_ATTR_INIT_SWITCH;
-            attr.value.booldata = true;
-
-            auto status = sai_switch_api->create_switch(&gSwitchId, 1, &attr);
-            ASSERT_EQ(status, SAI_STATUS_SUCCESS);
-
-            // Get switch source MAC address
-            attr.id = SAI_SWITCH_ATTR_SRC_MAC_ADDRESS;
-            status = sai_switch_api->get_switch_attribute(gSwitchId, 1, &attr);
-
-            ASSERT_EQ(status, SAI_STATUS_SUCCESS);
-
-            gMacAddress = attr.value.mac;
-
-            // Get the default virtual router ID
-            attr.id = SAI_SWITCH_ATTR_DEFAULT_VIRTUAL_ROUTER_ID;
-            status = sai_switch_api->get_switch_attribute(gSwitchId, 1, &attr);
-
-            ASSERT_EQ(status, SAI_STATUS_SUCCESS);
-
-            gVirtualRouterId = attr.value.oid;
-
-            ASSERT_EQ(gCrmOrch, nullptr);
-            gCrmOrch = new CrmOrch(m_config_db.get(), CFG_CRM_TABLE_NAME);
-
-            TableConnector stateDbSwitchTable(m_state_db.get(), "SWITCH_CAPABILITY");
-            TableConnector conf_asic_sensors(m_config_db.get(), CFG_ASIC_SENSORS_TABLE_NAME);
-            TableConnector app_switch_table(m_app_db.get(),  APP_SWITCH_TABLE_NAME);
-
-            vector<TableConnector> switch_tables = {
-                conf_asic_sensors,
-                app_switch_table
-            };
-
-            ASSERT_EQ(gSwitchOrch, nullptr);
-            gSwitchOrch = new SwitchOrch(m_app_db.get(), switch_tables, stateDbSwitchTable);
-
-            // Create dependencies ...
-
-            const int portsorch_base_pri = 40;
-
-            vector<table_name_with_pri_t> ports_tables = {
-                { APP_PORT_TABLE_NAME, portsorch_base_pri + 5 },
-                { APP_VLAN_TABLE_NAME, portsorch_base_pri + 2 },
-                { APP_VLAN_MEMBER_TABLE_NAME, portsorch_base_pri },
-                { APP_LAG_TABLE_NAME, portsorch_base_pri + 4 },
-                { APP_LAG_MEMBER_TABLE_NAME, portsorch_base_pri }
-            };
-
-            ASSERT_EQ(gPortsOrch, nullptr);
-            gPortsOrch = new PortsOrch(m_app_db.get(), m_state_db.get(), ports_tables, m_chassis_app_db.get());
-
-            vector<string> flex_counter_tables = {
-                CFG_FLEX_COUNTER_TABLE_NAME
-            };
-            auto* flexCounterOrch = new FlexCounterOrch(m_config_db.get(), flex_counter_tables);
-            gDirectory.set(flexCounterOrch);
-
-            static const  vector<string> route_pattern_tables = {
-                CFG_FLOW_COUNTER_ROUTE_PATTERN_TABLE_NAME,
-            };
-            gFlowCounterRouteOrch = new FlowCounterRouteOrch(m_config_db.get(), route_pattern_tables);
-            gDirectory.set(gFlowCounterRouteOrch);
-
-            ASSERT_EQ(gVrfOrch, nullptr);
-            gVrfOrch = new VRFOrch(m_app_db.get(), APP_VRF_TABLE_NAME, m_state_db.get(), STATE_VRF_OBJECT_TABLE_NAME);
-
-            ASSERT_EQ(gIntfsOrch, nullptr);
-            gIntfsOrch = new IntfsOrch(m_app_db.get(), APP_INTF_TABLE_NAME, gVrfOrch, m_chassis_app_db.get());
-
-            const int fdborch_pri = 20;
-
-            vector<table_name_with_pri_t> app_fdb_tables = {
-                { APP_FDB_TABLE_NAME,        FdbOrch::fdborch_pri},
-                { APP_VXLAN_FDB_TABLE_NAME,  FdbOrch::fdborch_pri},
-                { APP_MCLAG_FDB_TABLE_NAME,  fdborch_pri}
-            };
-
-            TableConnector stateDbFdb(m_state_db.get(), STATE_FDB_TABLE_NAME);
-            TableConnector stateMclagDbFdb(m_state_db.get(), STATE_MCLAG_REMOTE_FDB_TABLE_NAME);
-            ASSERT_EQ(gFdbOrch, nullptr);
-            gFdbOrch = new FdbOrch(m_app_db.get(), app_fdb_tables, stateDbFdb, stateMclagDbFdb, gPortsOrch);
-
-            ASSERT_EQ(gNeighOrch, nullptr);
-            gNeighOrch = new NeighOrch(m_app_db.get(), APP_NEIGH_TABLE_NAME, gIntfsOrch, gFdbOrch, gPortsOrch, m_chassis_app_db.get());
-
-            TunnelDecapOrch *tunnel_decap_orch = new TunnelDecapOrch(m_app_db.get(), APP_TUNNEL_DECAP_TABLE_NAME);
-            vector<string> mux_tables = {
-                CFG_MUX_CABLE_TABLE_NAME,
-                CFG_PEER_SWITCH_TABLE_NAME
-            };
-            MuxOrch *mux_orch = new MuxOrch(m_config_db.get(), mux_tables, tunnel_decap_orch, gNeighOrch, gFdbOrch);
-            gDirectory.set(mux_orch);
-
-            ASSERT_EQ(gFgNhgOrch, nullptr);
-            const int fgnhgorch_pri = 15;
+        void RemoveSaiHooks() override
+        {
+            sai_route_api = pold_sai_route_api;
+            sai_next_hop_group_api = pold_sai_next_hop_group_api;
+        }
 
-            vector<table_name_with_pri_t> fgnhg_tables = {
-                { CFG_FG_NHG,                 fgnhgorch_pri },
-                { CFG_FG_NHG_PREFIX,          fgnhgorch_pri },
-                { CFG_FG_NHG_MEMBER,          fgnhgorch_pri }
-            };
-            gFgNhgOrch = new FgNhgOrch(m_config_db.get(), m_app_db.get(), m_state_db.get(), fgnhg_tables, gNeighOrch, gIntfsOrch, gVrfOrch);
-
-            ASSERT_EQ(gSrv6Orch, nullptr);
-            vector<string> srv6_tables = {
-                APP_SRV6_SID_LIST_TABLE_NAME,
-                APP_SRV6_MY_SID_TABLE_NAME
-            };
-            gSrv6Orch = new Srv6Orch(m_app_db.get(), srv6_tables, gSwitchOrch, gVrfOrch, gNeighOrch);
-
-            ASSERT_EQ(gRouteOrch, nullptr);
-            const int routeorch_pri = 5;
-            vector<table_name_with_pri_t> route_tables = {
-                { APP_ROUTE_TABLE_NAME,        routeorch_pri },
-                { APP_LABEL_ROUTE_TABLE_NAME,  routeorch_pri }
-            };
-            gRouteOrch = new RouteOrch(m_app_db.get(), route_tables, gSwitchOrch, gNeighOrch, gIntfsOrch, gVrfOrch, gFgNhgOrch, gSrv6Orch);
+        void PostSetUp() override
+        {
             gNhgOrch = new NhgOrch(m_app_db.get(), APP_NEXTHOP_GROUP_TABLE_NAME);
 
             // Recreate buffer orch to read populated data
@@ -257,26 +185,6 @@ namespace routeorch_test
 
             gBufferOrch = new BufferOrch(m_app_db.get(), m_config_db.get(), m_state_db.get(), buffer_tables);
 
-            Table portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
-
-            // Get SAI default ports to populate DB
-            auto ports = ut_helper::getInitialSaiPorts();
-
-            // Populate pot table with SAI ports
-            for (const auto &it : ports)
-            {
-                portTable.set(it.first, it.second);
-            }
-
-            // Set PortConfigDone
-            portTable.set("PortConfigDone", { { "count", to_string(ports.size()) } });
-            gPortsOrch->addExistingData(&portTable);
-            static_cast<Orch *>(gPortsOrch)->doTask();
-
-            portTable.set("PortInitDone", { { "lanes", "0" } });
-            gPortsOrch->addExistingData(&portTable);
-            static_cast<Orch *>(gPortsOrch)->doTask();
-
             Table intfTable = Table(m_app_db.get(), APP_INTF_TABLE_NAME);
             intfTable.set("Ethernet0", { {"NULL", "NULL" },
                                          {"mac_addr", "00:00:00:00:00:00" }});
@@ -305,42 +213,26 @@ namespace routeorch_test
             static_cast<Orch *>(gRouteOrch)->doTask();
         }
 
-        void TearDown() override
+        /*
+         * Two ECMP groups share next hop 10.0.0.2, so that switching it over
+         * (as MuxNbrHandler does) touches a member in each group with one bulk call.
+         */
+        void addSharedNextHopGroups()
         {
-            gDirectory.m_values.clear();
-
-            delete gCrmOrch;
-            gCrmOrch = nullptr;
-
-            delete gSwitchOrch;
-            gSwitchOrch = nullptr;
-
-            delete gVrfOrch;
-            gVrfOrch = nullptr;
-
-            delete gIntfsOrch;
-            gIntfsOrch = nullptr;
-
-            delete gNeighOrch;
-            gNeighOrch = nullptr;
-
-            delete gFdbOrch;
-            gFdbOrch = nullptr;
-
-            delete gFgNhgOrch;
-            gFgNhgOrch = nullptr;
-
-            delete gSrv6Orch;
-            gSrv6Orch = nullptr;
-
-            delete gRouteOrch;
-            gRouteOrch = nullptr;
-
-            delete gPortsOrch;
-            gPortsOrch = nullptr;
+            Table neighborTable = Table(m_app_db.get(), APP_NEIGH_TABLE_NAME);
+            neighborTable.set("Ethernet0:10.0.0.4", { {"neigh", "00:00:0a:00:00:04"},
+                                                      {"family", "IPv4" }});
+            gNeighOrch->addExistingData(&neighborTable);
+            static_cast<Orch *>(gNeighOrch)->doTask();
 
-            sai_route_api = pold_sai_route_api;
-            ut_helper::uninitSaiApi();
+            std::deque<KeyOpFieldsValuesTuple> entries;
+            entries.push_back({"2.2.2.0/24", "SET", { {"ifname", "Ethernet0,Ethernet0"},
+                                                      {"nexthop", "10.0.0.2,10.0.0.3"}}});
+            entries.push_back({"3.3.3.0/24", "SET", { {"ifname", "Ethernet0,Ethernet0"},
+                                                      {"nexthop", "10.0.0.2,10.0.0.4"}}});
+            auto consumer = dynamic_cast<Consumer *>(gRouteOrch->getExecutor(APP_ROUTE_TABLE_NAME));
+            consumer->addToSync(entries);
+            static_cast<Orch *>(gRouteOrch)->doTask();
         }
     };
 
@@ -422,4 +314,280 @@ namespace routeorch_test
         ASSERT_EQ(current_set_count + 1, set_route_count);
         ASSERT_EQ(sai_fail_count, 0);
     }
+
+    TEST_F(RouteOrchTest, RouteOrchTestUpdateNextHopRoutesBulk)
+    {
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        entries.push_back({"2.2.2.0/24", "SET", { {"ifname", "Ethernet0"},
+                                                  {"nexthop", "10.0.0.2"}}});
+        entries.push_back({"3.3.3.0/24", "SET", { {"ifname", "Ethernet0"},
+                                                  {"nexthop", "10.0.0.2"}}});
+        entries.push_back({"4.4.4.0/24", "SET", { {"ifname", "Ethernet0"},
+                                                  {"nexthop", "10.0.0.2"}}});
+
+        auto consumer = dynamic_cast<Consumer *>(gRouteOrch->getExecutor(APP_ROUTE_TABLE_NAME));
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gRouteOrch)->doTask();
+
+        auto current_set_count = set_route_count;
+
+        // All the routes behind the next hop are re-pointed with a single bulk call
+        uint32_t num_routes = 0;
+        NextHopKey nh_key("10.0.0.2", "Ethernet0");
+        ASSERT_TRUE(gRouteOrch->updateNextHopRoutes(nh_key, num_routes));
+        ASSERT_GE(num_routes, 3);
+        ASSERT_EQ(current_set_count + 1, set_route_count);
+        ASSERT_EQ(sai_fail_count, 0);
+    }
+
+    TEST_F(RouteOrchTest, RouteOrchTestResyncRemovesStaleRoutes)
+    {
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        entries.push_back({"2.2.2.0/24", "SET", { {"ifname", "Ethernet0"},
+                                                  {"nexthop", "10.0.0.3"}}});
+        auto consumer = dynamic_cast<Consumer *>(gRouteOrch->getExecutor(APP_ROUTE_TABLE_NAME));
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gRouteOrch)->doTask();
+
+        const auto& routes = gRouteOrch->getSyncdRoutes().at(gVirtualRouterId);
+        ASSERT_EQ(routes.count(IpPrefix("2.2.2.0/24")), 1);
+
+        // Only 1.1.1.0/24 is refreshed during the resync window
+        entries.clear();
+        entries.push_back({"resync", "SET", { {} }});
+        entries.push_back({"1.1.1.0/24", "SET", { {"ifname", "Ethernet0"},
+                                                  {"nexthop", "10.0.0.2"}}});
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gRouteOrch)->doTask();
+
+        // Nothing is processed until the resync completes
+        ASSERT_EQ(routes.count(IpPrefix("2.2.2.0/24")), 1);
+
+        auto current_create_count = create_route_count;
+        auto current_remove_count = remove_route_count;
+
+        entries.clear();
+        entries.push_back({"resync", "DEL", { {} }});
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gRouteOrch)->doTask();
+
+        // Stale routes are removed with a single bulk call, refreshed ones are kept as is
+        ASSERT_EQ(current_remove_count + 1, remove_route_count);
+        ASSERT_EQ(current_create_count, create_route_count);
+        ASSERT_EQ(routes.count(IpPrefix("2.2.2.0/24")), 0);
+        ASSERT_EQ(routes.count(IpPrefix("1.1.1.0/24")), 1);
+        ASSERT_EQ(routes.at(IpPrefix("1.1.1.0/24")).nhg_key, NextHopGroupKey("10.0.0.2@Ethernet0"));
+        ASSERT_TRUE(consumer->m_toSync.empty());
+    }
+
+    TEST_F(RouteOrchTest, RouteOrchTestNextHopGroupMemberPartialRemove)
+    {
+        addSharedNextHopGroups();
+
+        NextHopKey nh_key("10.0.0.2", "Ethernet0");
+        vector<NextHopKey> nh_keys = { nh_key };
+        vector<uint32_t> counts;
+        auto ref_count = gNeighOrch->getNextHopRefCount(nh_key);
+
+        // The bulk call stops before the second member, only the removed one is accounted
+        nhgm_not_executed_count = 1;
+        ASSERT_FALSE(gRouteOrch->invalidnexthopinNextHopGroup(nh_keys, counts));
+        ASSERT_EQ(counts.size(), 1);
+        ASSERT_EQ(counts[0], 1);
+
+        // The neighbor keeps the reference of the member still in its group
+        gNeighOrch->decreaseNextHopRefCount(nh_key, counts[0]);
+        ASSERT_EQ(gNeighOrch->getNextHopRefCount(nh_key), ref_count - 1);
+    }
+
+    TEST_F(RouteOrchTest, RouteOrchTestNextHopGroupMemberPartialAdd)
+    {
+        addSharedNextHopGroups();
+
+        NextHopKey nh_key("10.0.0.2", "Ethernet0");
+        vector<NextHopKey> nh_keys = { nh_key };
+        vector<uint32_t> counts;
+        auto ref_count = gNeighOrch->getNextHopRefCount(nh_key);
+
+        ASSERT_TRUE(gRouteOrch->invalidnexthopinNextHopGroup(nh_keys, counts));
+        ASSERT_EQ(counts[0], 2);
+        gNeighOrch->decreaseNextHopRefCount(nh_key, counts[0]);
+
+        // The bulk call stops before the second member, only the added one is accounted
+        nhgm_not_executed_count = 1;
+        ASSERT_FALSE(gRouteOrch->validnexthopinNextHopGroup(nh_keys, counts));
+        ASSERT_EQ(counts.size(), 1);
+        ASSERT_EQ(counts[0], 1);
+
+        gNeighOrch->increaseNextHopRefCount(nh_key, counts[0]);
+        ASSERT_EQ(gNeighOrch->getNextHopRefCount(nh_key), ref_count - 1);
+    }
+
+    // All the synced routes with the same next hops share a single copy of their next hop group key
+    TEST_F(RouteOrchTest, RouteOrchTestRouteNhgKeyShared)
+    {
+        const uint32_t route_count = 100;
+
+        auto consumer = dynamic_cast<Consumer *>(gRouteOrch->getExecutor(APP_ROUTE_TABLE_NAME));
+        auto nhg_key_count = gRouteOrch->getRouteNhgKeyCount();
+
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        for (uint32_t i = 0; i < route_count; i++)
+        {
+            entries.push_back({"20.0.0." + to_string(i) + "/32", "SET", { {"ifname", "Ethernet0,Ethernet0"},
+                                                                          {"nexthop", "10.0.0.2,10.0.0.3"}}});
+        }
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gRouteOrch)->doTask();
+
+        size_t routes = 0;
+        for (const auto &vrf : gRouteOrch->getSyncdRoutes())
+        {
+            routes += vrf.second.size();
+        }
+        ASSERT_GE(routes, route_count);
+        ASSERT_EQ(gRouteOrch->getRouteNhgKeyCount(), nhg_key_count + 1);
+    }
+
+    struct NextHopTestObserver : public Observer
+    {
+        vector<NextHopUpdate> updates;
+
+        void update(SubjectType type, void *cntx) override
+        {
+            ASSERT_EQ(type, SUBJECT_TYPE_NEXTHOP_CHANGE);
+            updates.push_back(*static_cast<NextHopUpdate *>(cntx));
+        }
+    };
+
+    TEST_F(RouteOrchTest, RouteOrchTestNextHopObservers)
+    {
+        NextHopTestObserver observer;
+        IpAddress dst("5.5.5.5");
+
+        // The default route is the best match when attaching
+        gRouteOrch->attach(&observer, dst);
+        ASSERT_EQ(observer.updates.size(), 1);
+        ASSERT_EQ(observer.updates.back().prefix.to_string(), "0.0.0.0/0");
+
+        auto consumer = dynamic_cast<Consumer *>(gRouteOrch->getExecutor(APP_ROUTE_TABLE_NAME));
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        entries.push_back({"5.5.5.0/24", "SET", { {"ifname", "Ethernet0"},
+                                                  {"nexthop", "10.0.0.2"}}});
+        entries.push_back({"6.6.6.0/24", "SET", { {"ifname", "Ethernet0"},
+                                                  {"nexthop", "10.0.0.2"}}});
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gRouteOrch)->doTask();
+
+        // Only the route covering the observed address is notified
+        ASSERT_EQ(observer.updates.size(), 2);
+        ASSERT_EQ(observer.updates.back().prefix.to_string(), "5.5.5.0/24");
+        ASSERT_EQ(observer.updates.back().destination, dst);
+
+        // A less specific route does not change the best match
+        entries.clear();
+        entries.push_back({"5.5.0.0/16", "SET", { {"ifname", "Ethernet0"},
+                                                  {"nexthop", "10.0.0.3"}}});
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gRouteOrch)->doTask();
+        ASSERT_EQ(observer.updates.size(), 2);
+
+        // Removing the best match falls back to the next covering route
+        entries.clear();
+        entries.push_back({"5.5.5.0/24", "DEL", { {} }});
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gRouteOrch)->doTask();
+        ASSERT_EQ(observer.updates.size(), 3);
+        ASSERT_EQ(observer.updates.back().prefix.to_string(), "5.5.0.0/16");
+
+        // A second observer of the same address starts from the covering routes already found
+        NextHopTestObserver observer2;
+        gRouteOrch->attach(&observer2, dst);
+        ASSERT_EQ(observer2.updates.size(), 1);
+        ASSERT_EQ(observer2.updates.back().prefix.to_string(), "5.5.0.0/16");
+
+        gRouteOrch->detach(&observer, dst);
+        gRouteOrch->detach(&observer2, dst);
+
+        // Nothing is notified once detached
+        entries.clear();
+        entries.push_back({"5.5.5.0/24", "SET", { {"ifname", "Ethernet0"},
+                                                  {"nexthop", "10.0.0.2"}}});
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gRouteOrch)->doTask();
+        ASSERT_EQ(observer.updates.size(), 3);
+        ASSERT_EQ(observer2.updates.size(), 1);
+    }
+
+    TEST(IpPrefixTrieTest, CoveringAndCoveredEntries)
+    {
+        IpPrefixTrie<string> trie;
+        trie.insert(IpPrefix("0.0.0.0/0"), "default");
+        trie.insert(IpPrefix("10.0.0.0/8"), "10/8");
+        trie.insert(IpPrefix("10.1.0.0/16"), "10.1/16");
+        trie.insert(IpPrefix("10.1.2.3/32"), "host");
+        trie.insert(IpPrefix("2001:db8::/32"), "v6");
+        ASSERT_EQ(trie.size(), 5);
+
+        // Covering entries are visited shortest prefix first
+        vector<string> covering;
+        trie.forEachCovering(IpAddress("10.1.2.3"), [&covering](int len, string &value) {
+            covering.push_back(value);
+        });
+        ASSERT_EQ(covering, vector<string>({ "default", "10/8", "10.1/16", "host" }));
+
+        covering.clear();
+        trie.forEachCovering(IpAddress("2001:db8::1"), [&covering](int len, string &value) {
+            covering.push_back(value);
+        });
+        ASSERT_EQ(covering, vector<string>({ "v6" }));
+
+        size_t covered = 0;
+        trie.forEachCovered(IpPrefix("10.0.0.0/8"), [&covered](string &value) {
+            covered++;
+        });
+        ASSERT_EQ(covered, 3);
+
+        // Erasing a prefix keeps the more specific entries below it
+        ASSERT_TRUE(trie.erase(IpPrefix("10.1.0.0/16")));
+        ASSERT_FALSE(trie.erase(IpPrefix("10.1.0.0/16")));
+        ASSERT_EQ(trie.find(IpPrefix("10.1.0.0/16")), nullptr);
+        ASSERT_NE(trie.find(IpPrefix("10.1.2.3/32")), nullptr);
+        ASSERT_EQ(*trie.find(IpPrefix("10.1.2.3/32")), "host");
+        ASSERT_EQ(trie.size(), 4);
+    }
+
+    TEST(NextHopGroupKeyTest, InternedKeys)
+    {
+        NextHopGroupKey nhg1("10.0.0.2@Ethernet0,10.0.0.3@Ethernet0");
+        NextHopGroupKey nhg2("10.0.0.2@Ethernet0,10.0.0.3@Ethernet0");
+        NextHopGroupKey nhg3("10.0.0.3@Ethernet0,10.0.0.2@Ethernet0");
+
+        // Keys with the same next hops are equal and hash the same regardless of the string
+        ASSERT_EQ(nhg1, nhg2);
+        ASSERT_EQ(nhg1, nhg3);
+        ASSERT_EQ(std::hash<NextHopGroupKey>()(nhg1), std::hash<NextHopGroupKey>()(nhg3));
+
+        // Modifying a key does not affect the keys sharing its next hops
+        NextHopGroupKey nhg4 = nhg1;
+        nhg4.remove("10.0.0.3@Ethernet0");
+        ASSERT_EQ(nhg4.getSize(), 1);
+        ASSERT_EQ(nhg1.getSize(), 2);
+        ASSERT_NE(nhg1, nhg4);
+        ASSERT_EQ(nhg2, NextHopGroupKey("10.0.0.2@Ethernet0,10.0.0.3@Ethernet0"));
+
+        // Weights are part of the key
+        NextHopGroupKey wnhg1("10.0.0.2@Ethernet0,10.0.0.3@Ethernet0", "1,2");
+        NextHopGroupKey wnhg2("10.0.0.2@Ethernet0,10.0.0.3@Ethernet0", "2,1");
+        ASSERT_NE(wnhg1, wnhg2);
+        ASSERT_NE(wnhg1, nhg1);
+        ASSERT_EQ(wnhg1, NextHopGroupKey("10.0.0.2@Ethernet0,10.0.0.3@Ethernet0", "1,2"));
+
+        std::unordered_map<NextHopGroupKey, int> table;
+        table[nhg1] = 1;
+        table[wnhg1] = 2;
+        ASSERT_EQ(table.at(nhg3), 1);
+        ASSERT_EQ(table.at(NextHopGroupKey("10.0.0.2@Ethernet0,10.0.0.3@Ethernet0", "1,2")), 2);
+        ASSERT_EQ(table.count(nhg4), 0);
+    }
 }
@@ -0,0 +1,299 @@
+#define protected public
+#include "orch.h"
+#undef protected
+#define private public
+#include "vnetorch.h"
+#undef private
+#include "ut_helper.h"
+#include "mock_orchagent_main.h"
+#include "mock_orch_test.h"
+#include "mock_table.h"
+
+extern sai_next_hop_group_api_t* sai_next_hop_group_api;
+
+namespace vnetorch_test
+{
+    using namespace std;
+    using namespace mock_orch_test;
+
+    int create_nhg_count;
+    int remove_nhg_count;
+
+    // Destination of the route entries the next bulk create fails, none when 0
+    uint32_t failed_route_ip4;
+
+    sai_route_api_t ut_sai_route_api;
+    sai_route_api_t *pold_sai_route_api;
+
+    sai_next_hop_group_api_t ut_sai_next_hop_group_api;
+    sai_next_hop_group_api_t *pold_sai_next_hop_group_api;
+
+    sai_status_t _ut_stub_sai_bulk_create_route_entry(
+        _In_ uint32_t object_count,
+        _In_ const sai_route_entry_t *route_entry,
+        _In_ const uint32_t *attr_count,
+        _In_ const sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        vector<uint32_t> executed;
+        vector<sai_route_entry_t> entries;
+        vector<uint32_t> counts;
+        vector<const sai_attribute_t *> attrs;
+        sai_status_t status = SAI_STATUS_SUCCESS;
+
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            const auto &dst = route_entry[i].destination;
+            if (failed_route_ip4 && dst.addr_family == SAI_IP_ADDR_FAMILY_IPV4 && dst.addr.ip4 == failed_route_ip4)
+            {
+                object_statuses[i] = SAI_STATUS_FAILURE;
+                status = SAI_STATUS_FAILURE;
+                continue;
+            }
+            executed.push_back(i);
+            entries.push_back(route_entry[i]);
+            counts.push_back(attr_count[i]);
+            attrs.push_back(attr_list[i]);
+        }
+
+        if (status != SAI_STATUS_SUCCESS)
+        {
+            failed_route_ip4 = 0;
+        }
+
+        if (!entries.empty())
+        {
+            vector<sai_status_t> statuses(entries.size());
+            sai_status_t rc = pold_sai_route_api->create_route_entries((uint32_t)entries.size(), entries.data(), counts.data(),
+                                                                       attrs.data(), mode, statuses.data());
+            for (size_t j = 0; j < executed.size(); j++)
+            {
+                object_statuses[executed[j]] = statuses[j];
+            }
+            if (rc != SAI_STATUS_SUCCESS)
+            {
+                status = rc;
+            }
+        }
+
+        return status;
+    }
+
+    sai_status_t _ut_stub_sai_create_next_hop_group(
+        _Out_ sai_object_id_t *next_hop_group_id,
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
+    {
+        create_nhg_count++;
+        return pold_sai_next_hop_group_api->create_next_hop_group(next_hop_group_id, switch_id, attr_count, attr_list);
+    }
+
+    sai_status_t _ut_stub_sai_remove_next_hop_group(
+        _In_ sai_object_id_t next_hop_group_id)
+    {
+        remove_nhg_count++;
+        return pold_sai_next_hop_group_api->remove_next_hop_group(next_hop_group_id);
+    }
+
+    struct VNetRouteOrchTest : public MockOrchTest
+    {
+        VxlanTunnelOrch *m_vxlanTunnelOrch = nullptr;
+        VNetOrch *m_vnetOrch = nullptr;
+        VNetRouteOrch *m_vnetRouteOrch = nullptr;
+        Consumer *m_consumer = nullptr;
+
+        void ApplySaiHooks() override
+        {
+            pold_sai_route_api = sai_route_api;
+            ut_sai_route_api = *sai_route_api;
+            sai_route_api = &ut_sai_route_api;
+            sai_route_api->create_route_entries = _ut_stub_sai_bulk_create_route_entry;
+            failed_route_ip4 = 0;
+
+            pold_sai_next_hop_group_api = sai_next_hop_group_api;
+            ut_sai_next_hop_group_api = *sai_next_hop_group_api;
+            sai_next_hop_group_api = &ut_sai_next_hop_group_api;
+            sai_next_hop_group_api->create_next_hop_group = _ut_stub_sai_create_next_hop_group;
+            sai_next_hop_group_api->remove_next_hop_group = _ut_stub_sai_remove_next_hop_group;
+            create_nhg_count = 0;
+            remove_nhg_count = 0;
+        }
+
+        void RemoveSaiHooks() override
+        {
+            sai_route_api = pold_sai_route_api;
+            sai_next_hop_group_api = pold_sai_next_hop_group_api;
+        }
+
+        void PostSetUp() override
+        {
+            TableConnector stateDbBfdSessionTable(m_state_db.get(), STATE_BFD_SESSION_TABLE_NAME);
+            ASSERT_EQ(gBfdOrch, nullptr);
+            gBfdOrch = new BfdOrch(m_app_db.get(), APP_BFD_SESSION_TABLE_NAME, stateDbBfdSessionTable);
+
+            m_vxlanTunnelOrch = new VxlanTunnelOrch(m_state_db.get(), m_app_db.get(), APP_VXLAN_TUNNEL_TABLE_NAME);
+            gDirectory.set(m_vxlanTunnelOrch);
+
+            m_vnetOrch = new VNetOrch(m_app_db.get(), APP_VNET_TABLE_NAME);
+            gDirectory.set(m_vnetOrch);
+
+            vector<string> vnet_tables = {
+                APP_VNET_RT_TABLE_NAME,
+                APP_VNET_RT_TUNNEL_TABLE_NAME
+            };
+            m_vnetRouteOrch = new VNetRouteOrch(m_app_db.get(), vnet_tables, m_vnetOrch);
+            gDirectory.set(m_vnetRouteOrch);
+            m_consumer = dynamic_cast<Consumer *>(m_vnetRouteOrch->getExecutor(APP_VNET_RT_TUNNEL_TABLE_NAME));
+
+            Table tunnelTable = Table(m_app_db.get(), APP_VXLAN_TUNNEL_TABLE_NAME);
+            tunnelTable.set("tunnel_1", { { "src_ip", "10.0.0.1" } });
+            m_vxlanTunnelOrch->addExistingData(&tunnelTable);
+            static_cast<Orch *>(m_vxlanTunnelOrch)->doTask();
+
+            Table vnetTable = Table(m_app_db.get(), APP_VNET_TABLE_NAME);
+            vnetTable.set("Vnet1", { { "vxlan_tunnel", "tunnel_1" },
+                                     { "vni", "10001" } });
+            m_vnetOrch->addExistingData(&vnetTable);
+            static_cast<Orch *>(m_vnetOrch)->doTask();
+            ASSERT_TRUE(m_vnetOrch->isVnetExists("Vnet1"));
+        }
+
+        void PreTearDown() override
+        {
+            delete m_vnetRouteOrch;
+            m_vnetRouteOrch = nullptr;
+
+            delete m_vnetOrch;
+            m_vnetOrch = nullptr;
+
+            delete m_vxlanTunnelOrch;
+            m_vxlanTunnelOrch = nullptr;
+
+            delete gBfdOrch;
+            gBfdOrch = nullptr;
+        }
+
+        void drain(const deque<KeyOpFieldsValuesTuple> &entries)
+        {
+            m_consumer->addToSync(entries);
+            static_cast<Orch *>(m_vnetRouteOrch)->doTask(*m_consumer);
+        }
+
+        bool hasRoute(const string &prefix)
+        {
+            auto it = m_vnetRouteOrch->syncd_tunnel_routes_.find("Vnet1");
+            return it != m_vnetRouteOrch->syncd_tunnel_routes_.end() &&
+                   it->second.find(IpPrefix(prefix)) != it->second.end();
+        }
+
+        NextHopGroupKey routeNextHops(const string &prefix)
+        {
+            return m_vnetRouteOrch->syncd_tunnel_routes_.at("Vnet1").at(IpPrefix(prefix));
+        }
+    };
+
+    TEST_F(VNetRouteOrchTest, BulkReuseReleasedNextHopGroup)
+    {
+        drain({ { "Vnet1:10.1.0.0/24", SET_COMMAND, { { "endpoint", "9.0.0.1,9.0.0.2" } } } });
+        ASSERT_TRUE(m_consumer->m_toSync.empty());
+        ASSERT_EQ(create_nhg_count, 1);
+
+        auto nhg = routeNextHops("10.1.0.0/24");
+        auto nhg_id = m_vnetRouteOrch->getNextHopGroupId("Vnet1", nhg);
+
+        // The first route drops the group, the second route of the same batch picks it up again
+        drain({
+            { "Vnet1:10.1.0.0/24", SET_COMMAND, { { "endpoint", "9.0.0.3" } } },
+            { "Vnet1:10.2.0.0/24", SET_COMMAND, { { "endpoint", "9.0.0.1,9.0.0.2" } } }
+        });
+        ASSERT_TRUE(m_consumer->m_toSync.empty());
+        ASSERT_TRUE(m_vnetRouteOrch->released_nhgs_.empty());
+        ASSERT_EQ(create_nhg_count, 1);
+        ASSERT_EQ(remove_nhg_count, 0);
+
+        ASSERT_EQ(routeNextHops("10.1.0.0/24").getSize(), 1);
+        ASSERT_EQ(routeNextHops("10.2.0.0/24").to_string(), nhg.to_string());
+        ASSERT_EQ(m_vnetRouteOrch->getNextHopGroupId("Vnet1", nhg), nhg_id);
+
+        auto &nhg_info = m_vnetRouteOrch->syncd_nexthop_groups_["Vnet1"][nhg];
+        ASSERT_EQ(nhg_info.ref_count, 1);
+        ASSERT_EQ(nhg_info.tunnel_routes, set<IpPrefix>({ IpPrefix("10.2.0.0/24") }));
+
+        // The group goes away with its last route
+        drain({ { "Vnet1:10.2.0.0/24", DEL_COMMAND, { } } });
+        ASSERT_TRUE(m_consumer->m_toSync.empty());
+        ASSERT_FALSE(hasRoute("10.2.0.0/24"));
+        ASSERT_FALSE(m_vnetRouteOrch->hasNextHopGroup("Vnet1", nhg));
+        ASSERT_EQ(remove_nhg_count, 1);
+    }
+
+    TEST_F(VNetRouteOrchTest, BulkPartialFailureRetried)
+    {
+        failed_route_ip4 = IpAddress("10.2.0.0").getV4Addr();
+
+        drain({
+            { "Vnet1:10.1.0.0/24", SET_COMMAND, { { "endpoint", "9.0.0.1" } } },
+            { "Vnet1:10.2.0.0/24", SET_COMMAND, { { "endpoint", "9.0.0.4,9.0.0.5" } } },
+            { "Vnet1:10.3.0.0/24", SET_COMMAND, { { "endpoint", "9.0.0.1" } } }
+        });
+
+        // Only the failed route is left to retry, the group created for it is removed
+        ASSERT_EQ(m_consumer->m_toSync.size(), 1);
+        ASSERT_EQ(m_consumer->m_toSync.begin()->first, "Vnet1:10.2.0.0/24");
+        ASSERT_TRUE(hasRoute("10.1.0.0/24"));
+        ASSERT_FALSE(hasRoute("10.2.0.0/24"));
+        ASSERT_TRUE(hasRoute("10.3.0.0/24"));
+        ASSERT_TRUE(m_vnetRouteOrch->released_nhgs_.empty());
+        ASSERT_EQ(m_vnetRouteOrch->syncd_nexthop_groups_["Vnet1"].size(), 1);
+        ASSERT_EQ(create_nhg_count, 1);
+        ASSERT_EQ(remove_nhg_count, 1);
+
+        // The retry goes through once SAI accepts the route
+        static_cast<Orch *>(m_vnetRouteOrch)->doTask(*m_consumer);
+        ASSERT_TRUE(m_consumer->m_toSync.empty());
+        ASSERT_TRUE(hasRoute("10.2.0.0/24"));
+        ASSERT_EQ(routeNextHops("10.2.0.0/24").getSize(), 2);
+        ASSERT_EQ(m_vnetRouteOrch->syncd_nexthop_groups_["Vnet1"].size(), 2);
+        ASSERT_EQ(create_nhg_count, 2);
+        ASSERT_EQ(remove_nhg_count, 1);
+    }
+
+    TEST_F(VNetRouteOrchTest, BulkDelOfQueuedPrefix)
+    {
+        drain({ { "Vnet1:10.1.0.0/24", SET_COMMAND, { { "endpoint", "9.0.0.1,9.0.0.2" } } } });
+        ASSERT_TRUE(m_consumer->m_toSync.empty());
+        ASSERT_EQ(create_nhg_count, 1);
+
+        // The DEL replaces the SET received before it, the group of that SET is never created
+        m_consumer->addToSync(deque<KeyOpFieldsValuesTuple>({
+            { "Vnet1:10.1.0.0/24", SET_COMMAND, { { "endpoint", "9.0.0.3,9.0.0.4" } } },
+            { "Vnet1:10.2.0.0/24", SET_COMMAND, { { "endpoint", "9.0.0.5" } } },
+            { "Vnet1:10.1.0.0/24", DEL_COMMAND, { } },
+            { "Vnet1:10.3.0.0/24", SET_COMMAND, { { "endpoint", "9.0.0.5" } } }
+        }));
+        ASSERT_EQ(m_consumer->m_toSync.count("Vnet1:10.1.0.0/24"), 1);
+        ASSERT_EQ(kfvOp(m_consumer->m_toSync.find("Vnet1:10.1.0.0/24")->second), DEL_COMMAND);
+
+        static_cast<Orch *>(m_vnetRouteOrch)->doTask(*m_consumer);
+        ASSERT_TRUE(m_consumer->m_toSync.empty());
+        ASSERT_FALSE(hasRoute("10.1.0.0/24"));
+        ASSERT_TRUE(hasRoute("10.2.0.0/24"));
+        ASSERT_TRUE(hasRoute("10.3.0.0/24"));
+        ASSERT_TRUE(m_vnetRouteOrch->released_nhgs_.empty());
+        ASSERT_EQ(m_vnetRouteOrch->syncd_nexthop_groups_["Vnet1"].size(), 1);
+        ASSERT_EQ(create_nhg_count, 1);
+        ASSERT_EQ(remove_nhg_count, 1);
+
+        // A SET after the DEL of the same drain is applied after it
+        drain({
+            { "Vnet1:10.2.0.0/24", DEL_COMMAND, { } },
+            { "Vnet1:10.2.0.0/24", SET_COMMAND, { { "endpoint", "9.0.0.6,9.0.0.7" } } }
+        });
+        ASSERT_TRUE(m_consumer->m_toSync.empty());
+        ASSERT_TRUE(hasRoute("10.2.0.0/24"));
+        ASSERT_EQ(routeNextHops("10.2.0.0/24").getSize(), 2);
+        ASSERT_EQ(create_nhg_count, 2);
+    }
+}
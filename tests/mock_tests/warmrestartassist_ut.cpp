@@ -11,6 +11,8 @@
 
 #define APP_WRA_TEST_TABLE_NAME "TEST_TABLE"
 
+extern redisReply *mockReply;
+
 namespace warmrestartassist_test
 {
     using namespace std;
@@ -21,6 +23,23 @@ namespace warmrestartassist_test
 
     AppRestartAssist *appRestartAssist;
 
+    // Reply to the HGETALL that verifies a SAME entry at reconcile time, freed by the reader
+    void mockHgetallReply(const vector<FieldValueTuple> &fvVector)
+    {
+        mockReply = (redisReply *)calloc(sizeof(redisReply), 1);
+        mockReply->type = REDIS_REPLY_ARRAY;
+        mockReply->elements = fvVector.size() * 2;
+        mockReply->element = (redisReply **)calloc(sizeof(redisReply *), mockReply->elements);
+        for (size_t i = 0; i < mockReply->elements; i++)
+        {
+            const string &str = i % 2 ? fvValue(fvVector[i / 2]) : fvField(fvVector[i / 2]);
+            mockReply->element[i] = (redisReply *)calloc(sizeof(redisReply), 1);
+            mockReply->element[i]->type = REDIS_REPLY_STRING;
+            mockReply->element[i]->len = str.length();
+            mockReply->element[i]->str = strdup(str.c_str());
+        }
+    }
+
     struct WarmrestartassistTest : public ::testing::Test
     {
         WarmrestartassistTest()
@@ -61,4 +80,69 @@ namespace warmrestartassist_test
         ASSERT_EQ(fvField(fvVector[0]), "field");
         ASSERT_EQ(fvValue(fvVector[0]), "value1");
     }
+
+    TEST_F(WarmrestartassistTest, warmRestartAssistHashCollisionTest)
+    {
+        appRestartAssist->readTablesToMap();
+
+        // A different value with the same hash as the restored one is still updated
+        vector<FieldValueTuple> fvVector = {{"field", "value1"}};
+        appRestartAssist->appTableCacheMap[APP_WRA_TEST_TABLE_NAME]["key"].hash = appRestartAssist->hashFV(fvVector);
+        appRestartAssist->insertToMap(APP_WRA_TEST_TABLE_NAME, "key", fvVector, false);
+        ASSERT_EQ(appRestartAssist->appTableCacheMap[APP_WRA_TEST_TABLE_NAME]["key"].state, AppRestartAssist::SAME);
+        ASSERT_TRUE(appRestartAssist->appTableCacheMap[APP_WRA_TEST_TABLE_NAME]["key"].verify);
+
+        // The restored value read back at reconcile time differs, the entry is rewritten
+        mockHgetallReply({{"field", "value0"}});
+        appRestartAssist->reconcile();
+        mockReply = nullptr;
+
+        fvVector.clear();
+        Table testTable = Table(m_app_db.get(), APP_WRA_TEST_TABLE_NAME);
+        ASSERT_TRUE(testTable.get("key", fvVector));
+        ASSERT_EQ(fvValue(fvVector[0]), "value1");
+    }
+
+    TEST_F(WarmrestartassistTest, warmRestartAssistReconcileTest)
+    {
+        Table testTable = Table(m_app_db.get(), APP_WRA_TEST_TABLE_NAME);
+        testTable.set("same", {{"field1", "value1"}, {"field2", "value2"}});
+        testTable.set("stale", {{"field", "value"}});
+        testTable.set("deleted", {{"field", "value"}});
+
+        appRestartAssist->readTablesToMap();
+
+        // Same f/v pairs in a different order are not rewritten
+        appRestartAssist->insertToMap(APP_WRA_TEST_TABLE_NAME, "same", {{"field2", "value2"}, {"field1", "value1"}}, false);
+        appRestartAssist->insertToMap(APP_WRA_TEST_TABLE_NAME, "deleted", {}, true);
+        appRestartAssist->insertToMap(APP_WRA_TEST_TABLE_NAME, "new", {{"field", "value"}}, false);
+        mockHgetallReply({{"field1", "value1"}, {"field2", "value2"}});
+        appRestartAssist->reconcile();
+        mockReply = nullptr;
+
+        vector<FieldValueTuple> fvVector;
+        ASSERT_TRUE(testTable.get("same", fvVector));
+        ASSERT_EQ(fvField(fvVector[0]), "field1");
+        ASSERT_FALSE(testTable.get("stale", fvVector));
+        ASSERT_FALSE(testTable.get("deleted", fvVector));
+        ASSERT_TRUE(testTable.get("new", fvVector));
+        ASSERT_FALSE(testTable.get("key", fvVector));
+        ASSERT_FALSE(appRestartAssist->isWarmStartInProgress());
+
+        // Reconcile statistics are published to the warm restart table
+        DBConnector state_db("STATE_DB", 0);
+        Table warmRestartTable(&state_db, STATE_WARM_RESTART_TABLE_NAME);
+        string value;
+        ASSERT_TRUE(warmRestartTable.hget("testsyncd", "restored_entries", value));
+        ASSERT_EQ(value, "4");
+        ASSERT_TRUE(warmRestartTable.hget("testsyncd", "same_entries", value));
+        ASSERT_EQ(value, "1");
+        ASSERT_TRUE(warmRestartTable.hget("testsyncd", "stale_entries", value));
+        ASSERT_EQ(value, "2");
+        ASSERT_TRUE(warmRestartTable.hget("testsyncd", "deleted_entries", value));
+        ASSERT_EQ(value, "1");
+        ASSERT_TRUE(warmRestartTable.hget("testsyncd", "new_entries", value));
+        ASSERT_EQ(value, "1");
+        ASSERT_TRUE(warmRestartTable.hget("testsyncd", "reconcile_time_ms", value));
+    }
 }
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "macaddress.h"
+#include "orch.h"
+#include "request_parser.h"
+
+using namespace swss;
+
+/*
+ * Allocation counter, the benchmark binary replaces the global allocation
+ * functions so that the allocations done by every parse can be reported.
+ */
+static std::atomic<uint64_t> g_allocCount(0);
+
+void *operator new(size_t size)
+{
+    g_allocCount.fetch_add(1, std::memory_order_relaxed);
+    void *p = malloc(size ? size : 1);
+    if (p == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *p) noexcept
+{
+    free(p);
+}
+
+void operator delete[](void *p) noexcept
+{
+    free(p);
+}
+
+void operator delete(void *p, size_t) noexcept
+{
+    free(p);
+}
+
+void operator delete[](void *p, size_t) noexcept
+{
+    free(p);
+}
+
+/*
+ * Request parsing throughput, the way Orch2 parses its tables: one Request
+ * reused with parse() and clear(), or a new Request per tuple. The default
+ * count can be changed with REQUEST_PARSER_BENCHMARK_COUNT.
+ */
+namespace request_parser_benchmark
+{
+    using namespace std;
+
+    /* VNET_ROUTE_TUNNEL_TABLE like request */
+    const request_description_t route_request_description = {
+        { REQ_T_STRING, REQ_T_IP_PREFIX },
+        {
+            { "endpoint",    REQ_T_IP },
+            { "mac_address", REQ_T_MAC_ADDRESS },
+            { "vni",         REQ_T_UINT },
+            { "ifname",      REQ_T_STRING },
+            { "vlan",        REQ_T_VLAN },
+            { "nexthops",    REQ_T_IP_LIST },
+        },
+        { "endpoint" }
+    };
+
+    class RouteRequest : public Request
+    {
+    public:
+        RouteRequest() : Request(route_request_description, ':') { }
+    };
+
+    static size_t requestCount()
+    {
+        const char *count_env = getenv("REQUEST_PARSER_BENCHMARK_COUNT");
+        size_t count = count_env ? strtoul(count_env, nullptr, 10) : 1000000;
+        return max<size_t>(1, count);
+    }
+
+    static vector<KeyOpFieldsValuesTuple> makeRequests(size_t count)
+    {
+        vector<KeyOpFieldsValuesTuple> requests;
+        requests.reserve(count);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            uint32_t index = static_cast<uint32_t>(i);
+            char prefix[48];
+            if (i % 2)
+            {
+                snprintf(prefix, sizeof(prefix), "fc00:%x:%x::/64", index >> 16, index & 0xffff);
+            }
+            else
+            {
+                snprintf(prefix, sizeof(prefix), "10.%u.%u.0/24", (index >> 16) & 0xff, (index >> 8) & 0xff);
+            }
+            char mac[18];
+            snprintf(mac, sizeof(mac), "02:00:%02x:%02x:%02x:%02x",
+                     (index >> 24) & 0xff, (index >> 16) & 0xff, (index >> 8) & 0xff, index & 0xff);
+
+            requests.emplace_back("Vnet" + to_string(i % 16) + ":" + string(prefix), SET_COMMAND,
+                                  vector<FieldValueTuple>{ { "endpoint", "100.0." + to_string((index >> 8) & 0xff) + "." + to_string(index & 0xff) },
+                                                           { "mac_address", mac },
+                                                           { "vni", to_string(10000 + i % 4096) },
+                                                           { "ifname", "Ethernet" + to_string(4 * (i % 32)) },
+                                                           { "vlan", "Vlan" + to_string(1 + i % 4094) },
+                                                           { "nexthops", "10.0.0.1,10.0.0.2,10.0.0.3,10.0.0.4" } });
+        }
+
+        return requests;
+    }
+
+    template <typename F>
+    static void run(const string &name, const vector<KeyOpFieldsValuesTuple> &requests, F parse)
+    {
+        auto allocs = g_allocCount.load(std::memory_order_relaxed);
+        auto start = chrono::steady_clock::now();
+
+        for (const auto &request : requests)
+        {
+            parse(request);
+        }
+
+        auto seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        allocs = g_allocCount.load(std::memory_order_relaxed) - allocs;
+
+        cout << "[ BENCHMARK] " << left << setw(24) << name << right
+             << " requests " << setw(8) << requests.size()
+             << "  time " << fixed << setprecision(3) << setw(7) << seconds << " s"
+             << "  " << setprecision(0) << setw(9) << (seconds > 0 ? static_cast<double>(requests.size()) / seconds : 0) << " requests/s"
+             << "  allocs/request " << setprecision(1) << static_cast<double>(allocs) / static_cast<double>(requests.size())
+             << defaultfloat << endl;
+    }
+
+    TEST(RequestParserBenchmark, Parse)
+    {
+        auto requests = makeRequests(requestCount());
+        uint64_t vni_sum = 0;
+
+        RouteRequest reused;
+        run("reused Request", requests, [&](const KeyOpFieldsValuesTuple &tuple) {
+            reused.parse(tuple);
+            vni_sum += reused.getAttrUint("vni");
+            reused.clear();
+        });
+
+        run("new Request per tuple", requests, [&](const KeyOpFieldsValuesTuple &tuple) {
+            RouteRequest request;
+            request.parse(tuple);
+            vni_sum += request.getAttrUint("vni");
+        });
+
+        ASSERT_GT(vni_sum, 0);
+    }
+}
@@ -659,6 +659,40 @@ TEST(request_parser, wrongAttrTypeVlan_out_of_int_range)
     }
 }
 
+TEST(request_parser, wrongAttrTypeVlan_out_of_uint16_range)
+{
+    KeyOpFieldsValuesTuple t {"key1|02:03:04:05:06:07|key2", "SET",
+                                 {
+                                     { "v4", "true" },
+                                     { "v6", "true" },
+                                     { "src_mac", "02:03:04:05:06:07" },
+                                     { "ttl_action", "copy" },
+                                     { "ip_opt_action", "drop" },
+                                     { "l3_mc_action", "log" },
+                                     { "just_string", "123" },
+                                     { "vlan", "Vlan70000" },
+                                 }
+                             };
+    try
+    {
+        TestRequest2 request;
+        request.parse(t);
+        FAIL() << "Expected std::invalid_argument";
+    }
+    catch (const std::invalid_argument& e)
+    {
+        EXPECT_STREQ(e.what(), "Out of range vlan id: Vlan70000");
+    }
+    catch (const std::exception& e)
+    {
+        FAIL() << "Got unexpected exception " << e.what();
+    }
+    catch (...)
+    {
+        FAIL() << "Expected std::invalid_argument, not other exception";
+    }
+}
+
 TEST(request_parser, wrongAttrTypeVlan_invalid_int)
 {
     KeyOpFieldsValuesTuple t {"key1|02:03:04:05:06:07|key2", "SET",
@@ -968,6 +1002,123 @@ TEST(request_parser, correctClear)
     }
 }
 
+TEST(request_parser, attrsNotKeptAfterClear)
+{
+    KeyOpFieldsValuesTuple t1 {"key1|02:03:04:05:06:07|key2", "SET",
+                                 {
+                                     { "v4", "false" },
+                                     { "v6", "false" },
+                                     { "src_mac", "02:03:04:05:06:07" },
+                                     { "ttl_action", "copy" },
+                                     { "just_string", "test_string" },
+                                     { "vlan", "Vlan1" },
+                                 }
+                              };
+
+    KeyOpFieldsValuesTuple t2 {"key3|f2:f3:f4:f5:f6:f7|key4", "SET",
+                                 {
+                                     { "v4", "true" },
+                                     { "just_string", "string" },
+                                 }
+                              };
+
+    KeyOpFieldsValuesTuple t3 {"key5|52:53:54:55:56:57|key6", "DEL",
+                                 {
+                                 }
+                             };
+
+    try
+    {
+        TestRequest2 request;
+
+        EXPECT_NO_THROW(request.parse(t1));
+        EXPECT_EQ(request.getAttrVlan("vlan"), 1);
+        EXPECT_NO_THROW(request.clear());
+
+        // attributes of t1 which are not in t2 are not readable anymore
+        EXPECT_NO_THROW(request.parse(t2));
+        EXPECT_TRUE(request.getAttrBool("v4"));
+        EXPECT_STREQ(request.getAttrString("just_string").c_str(), "string");
+        EXPECT_THROW(request.getAttrBool("v6"), std::out_of_range);
+        EXPECT_THROW(request.getAttrMacAddress("src_mac"), std::out_of_range);
+        EXPECT_THROW(request.getAttrPacketAction("ttl_action"), std::out_of_range);
+        EXPECT_THROW(request.getAttrVlan("vlan"), std::out_of_range);
+        EXPECT_TRUE(request.getAttrFieldNames() == (std::unordered_set<std::string>{"v4", "just_string"}));
+        EXPECT_NO_THROW(request.clear());
+
+        // no attribute is readable after a request without attributes
+        EXPECT_NO_THROW(request.parse(t3));
+        EXPECT_STREQ(request.getKeyString(0).c_str(), "key5");
+        EXPECT_THROW(request.getAttrBool("v4"), std::out_of_range);
+        EXPECT_THROW(request.getAttrString("just_string"), std::out_of_range);
+        EXPECT_TRUE(request.getAttrFieldNames().empty());
+    }
+    catch (const std::exception& e)
+    {
+        FAIL() << "Got unexpected exception " << e.what();
+    }
+    catch (...)
+    {
+        FAIL() << "Got unexpected exception";
+    }
+}
+
+TEST(request_parser, copiedRequest)
+{
+    KeyOpFieldsValuesTuple t1 {"key1|02:03:04:05:06:07|key2", "SET",
+                                 {
+                                     { "v4", "false" },
+                                     { "src_mac", "02:03:04:05:06:07" },
+                                     { "just_string", "test_string" },
+                                     { "vlan", "Vlan1" },
+                                 }
+                              };
+
+    KeyOpFieldsValuesTuple t2 {"key3|f2:f3:f4:f5:f6:f7|key4", "SET",
+                                 {
+                                     { "v6", "true" },
+                                     { "just_string", "string" },
+                                 }
+                              };
+
+    try
+    {
+        // A request copied from a parsed one, like the bulk requests of Orch2
+        TestRequest2 request;
+        EXPECT_NO_THROW(request.parse(t1));
+
+        TestRequest2 copy(request);
+        EXPECT_STREQ(copy.getFullKey().c_str(), "key1|02:03:04:05:06:07|key2");
+        EXPECT_STREQ(copy.getKeyString(2).c_str(), "key2");
+        EXPECT_STREQ(copy.getAttrMacAddress("src_mac").to_string().c_str(), "02:03:04:05:06:07");
+        EXPECT_EQ(copy.getAttrVlan("vlan"), 1);
+        EXPECT_TRUE(copy.getAttrFieldNames() == (std::unordered_set<std::string>{"v4", "src_mac", "just_string", "vlan"}));
+
+        // the copy is parsed independently of the original
+        EXPECT_NO_THROW(copy.clear());
+        EXPECT_NO_THROW(copy.parse(t2));
+        EXPECT_STREQ(copy.getKeyString(0).c_str(), "key3");
+        EXPECT_TRUE(copy.getAttrBool("v6"));
+        EXPECT_STREQ(copy.getAttrString("just_string").c_str(), "string");
+        EXPECT_THROW(copy.getAttrVlan("vlan"), std::out_of_range);
+        EXPECT_TRUE(copy.getAttrFieldNames() == (std::unordered_set<std::string>{"v6", "just_string"}));
+
+        EXPECT_STREQ(request.getKeyString(0).c_str(), "key1");
+        EXPECT_STREQ(request.getAttrString("just_string").c_str(), "test_string");
+        EXPECT_EQ(request.getAttrVlan("vlan"), 1);
+        EXPECT_THROW(request.getAttrBool("v6"), std::out_of_range);
+        EXPECT_TRUE(request.getAttrFieldNames() == (std::unordered_set<std::string>{"v4", "src_mac", "just_string", "vlan"}));
+    }
+    catch (const std::exception& e)
+    {
+        FAIL() << "Got unexpected exception " << e.what();
+    }
+    catch (...)
+    {
+        FAIL() << "Got unexpected exception";
+    }
+}
+
 TEST(request_parser, anotherKeySeparator)
 {
     KeyOpFieldsValuesTuple t {"key1:key2", "SET",
@@ -32,6 +32,12 @@ class TestBfd(object):
         for k, v in expected_values.items():
             assert fvs[k] == v
 
+    def count_published_bfd_session_states(self, dvs, marker, key, old_state, new_state):
+        # Each published state is written to STATE_DB and notified to the observers along with this log
+        log = "BFD session state for %s changed from %s to %s" % (key, old_state, new_state)
+        (exitcode, num) = dvs.runcmd(['sh', '-c', "awk '/%s/,ENDFILE {print;}' /var/log/syslog | grep -c \"%s\"" % (marker, log)])
+        return int(num.strip())
+
     def update_bfd_session_state(self, dvs, session, state):
         bfd_sai_state = {"Admin_Down":  "SAI_BFD_SESSION_STATE_ADMIN_DOWN",
                          "Down":        "SAI_BFD_SESSION_STATE_DOWN",
@@ -465,6 +471,45 @@ class TestBfd(object):
         self.remove_bfd_session(key4)
         self.adb.wait_for_deleted_entry("ASIC_STATE:SAI_OBJECT_TYPE_BFD_SESSION", session4)
 
+    def test_bfdSessionFlapCoalescing(self, dvs):
+        self.setup_db(dvs)
+
+        bfdSessions = self.get_exist_bfd_session()
+
+        # Create BFD session
+        fieldValues = {"local_addr": "10.0.0.1"}
+        self.create_bfd_session("default:default:10.0.0.2", fieldValues)
+        self.adb.wait_for_n_keys("ASIC_STATE:SAI_OBJECT_TYPE_BFD_SESSION", len(bfdSessions) + 1)
+
+        createdSessions = self.get_exist_bfd_session() - bfdSessions
+        assert len(createdSessions) == 1
+        session = createdSessions.pop()
+
+        # Flap the session, the first change is published right away and the
+        # storm ends in the same state, so nothing else is published
+        marker = dvs.add_log_marker()
+        for state in ["Up", "Down", "Up", "Down", "Up"]:
+            self.update_bfd_session_state(dvs, session, state)
+        time.sleep(2)
+
+        self.check_state_bfd_session_value("default|default|10.0.0.2", {"state": "Up"})
+        assert self.count_published_bfd_session_states(dvs, marker, "default|default|10.0.0.2", "Down", "Up") == 1
+        assert self.count_published_bfd_session_states(dvs, marker, "default|default|10.0.0.2", "Up", "Down") == 0
+
+        # Flap to the other state, only the first and the last states are published
+        marker = dvs.add_log_marker()
+        for state in ["Down", "Up", "Down", "Up", "Down"]:
+            self.update_bfd_session_state(dvs, session, state)
+        time.sleep(2)
+
+        self.check_state_bfd_session_value("default|default|10.0.0.2", {"state": "Down"})
+        assert self.count_published_bfd_session_states(dvs, marker, "default|default|10.0.0.2", "Up", "Down") == 1
+        assert self.count_published_bfd_session_states(dvs, marker, "default|default|10.0.0.2", "Down", "Up") == 0
+
+        # Remove the BFD session
+        self.remove_bfd_session("default:default:10.0.0.2")
+        self.adb.wait_for_deleted_entry("ASIC_STATE:SAI_OBJECT_TYPE_BFD_SESSION", session)
+
     def test_bfd_state_db_clear(self, dvs):
         self.setup_db(dvs)
 
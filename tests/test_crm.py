@@ -95,6 +95,37 @@ class TestCrm(object):
         # enable ipv6 on server 2
         dvs.servers[2].runcmd("sysctl -w net.ipv6.conf.eth0.disable_ipv6=0")
 
+    def test_CrmHwPollingRatio(self, dvs, testlog):
+
+        crm_update(dvs, "polling_interval", "1")
+
+        dvs.setReadOnlyAttr('SAI_OBJECT_TYPE_SWITCH', 'SAI_SWITCH_ATTR_AVAILABLE_IPV4_NEXTHOP_ENTRY', '1000')
+
+        time.sleep(2)
+
+        avail_counter = getCrmCounterValue(dvs, 'STATS', 'crm_stats_ipv4_nexthop_available')
+        assert avail_counter == 1000
+
+        # hardware is read only once every 100 polling intervals
+        crm_update(dvs, "hw_polling_ratio", "100")
+
+        dvs.setReadOnlyAttr('SAI_OBJECT_TYPE_SWITCH', 'SAI_SWITCH_ATTR_AVAILABLE_IPV4_NEXTHOP_ENTRY', '900')
+
+        time.sleep(2)
+
+        new_avail_counter = getCrmCounterValue(dvs, 'STATS', 'crm_stats_ipv4_nexthop_available')
+        assert new_avail_counter == avail_counter
+
+        # hardware is read again on every polling interval
+        crm_update(dvs, "hw_polling_ratio", "1")
+
+        time.sleep(2)
+
+        new_avail_counter = getCrmCounterValue(dvs, 'STATS', 'crm_stats_ipv4_nexthop_available')
+        assert new_avail_counter == 900
+
+        dvs.setReadOnlyAttr('SAI_OBJECT_TYPE_SWITCH', 'SAI_SWITCH_ATTR_AVAILABLE_IPV4_NEXTHOP_ENTRY', '1000')
+
     def test_CrmIpv4Route(self, dvs, testlog):
 
         config_db = swsscommon.DBConnector(swsscommon.CONFIG_DB, dvs.redis_sock, 0)
@@ -691,15 +691,18 @@ class TestMuxTunnelBase():
             fvs = statedb.get_entry("MUX_METRICS_TABLE", key)
             assert fvs != {}
 
-            start = end = False
-            for f, _ in fvs.items():
+            start = end = latency = False
+            for f, v in fvs.items():
                 if f == "orch_switch_active_start":
                     start = True
                 elif f == "orch_switch_active_end":
                     end = True
+                elif f == "orch_switch_active_latency_us":
+                    latency = int(v) >= 0
 
             assert start
             assert end
+            assert latency
 
         # Set to standby and test attributes for start and end time
         self.set_mux_state(appdb, "Ethernet0", "standby")
@@ -713,15 +716,18 @@ class TestMuxTunnelBase():
             fvs = statedb.get_entry("MUX_METRICS_TABLE", key)
             assert fvs != {}
 
-            start = end = False
+            start = end = latency = False
             for f, v in fvs.items():
                 if f == "orch_switch_standby_start":
                     start = True
                 elif f == "orch_switch_standby_end":
                     end = True
+                elif f == "orch_switch_standby_latency_us":
+                    latency = int(v) >= 0
 
             assert start
             assert end
+            assert latency
 
     def check_interface_exists_in_asicdb(self, asicdb, sai_oid):
         asicdb.wait_for_entry(self.ASIC_RIF_TABLE, sai_oid)
@@ -1,5 +1,8 @@
 #include <string>
 #include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include <hiredis/hiredis.h>
 #include "logger.h"
 #include "schema.h"
 #include "warm_restart.h"
@@ -22,7 +25,9 @@ AppRestartAssist::AppRestartAssist(RedisPipeline *pipelineAppDB, const std::stri
     m_pipeLine(pipelineAppDB),
     m_appName(appName),
     m_dockerName(dockerName),
-    m_warmStartTimer(timespec{0, 0})
+    m_warmStartTimer(timespec{0, 0}),
+    m_restoreDuration(0),
+    m_restoredEntries(0)
 {
     WarmStart::initialize(m_appName, m_dockerName);
     WarmStart::checkWarmStart(m_appName, m_dockerName);
@@ -74,9 +79,10 @@ AppRestartAssist::~AppRestartAssist()
     }
 }
 
-void AppRestartAssist::registerAppTable(const std::string &tableName, ProducerStateTable *psTable)
+void AppRestartAssist::registerAppTable(const std::string &tableName, ProducerStateTable *psTable, bool buffered)
 {
     m_psTables[tableName]  = psTable;
+    m_psTablesBuffered[tableName] = buffered;
 
     // Clear the producerstate table to make sure no pending data for the AppTable
     if (m_warmStartInProgress)
@@ -86,35 +92,44 @@ void AppRestartAssist::registerAppTable(const std::string &tableName, ProducerSt
     m_appTables[tableName] = new Table(m_pipeLine, tableName, false);
 }
 
-// join the field-value strings for straight printing.
-string AppRestartAssist::joinVectorString(const vector<FieldValueTuple> &fv)
+/*
+ * Hash of the f/v pairs of an entry. The pairs are sorted first so that
+ * the same set of f/v pairs yields the same hash regardless of their order.
+ */
+uint64_t AppRestartAssist::hashFV(const std::vector<FieldValueTuple> &fvVector)
 {
-    string s;
-    for (const auto &temps : fv )
+    vector<const FieldValueTuple *> sorted;
+    sorted.reserve(fvVector.size());
+    for (const auto &fv : fvVector)
     {
-	   s += temps.first + ":" + temps.second + ", ";
+        sorted.push_back(&fv);
     }
-    return s;
-}
+    sort(sorted.begin(), sorted.end(),
+         [](const FieldValueTuple *a, const FieldValueTuple *b) { return *a < *b; });
 
-// Set the cache entry state
-void AppRestartAssist::setCacheEntryState(std::vector<FieldValueTuple> &fvVector,
-    cache_state_t state)
-{
-    fvVector.back().second = cacheStateMap.at(state);
+    string canonical;
+    for (const auto *fv : sorted)
+    {
+        canonical += fvField(*fv);
+        canonical += '\0';
+        canonical += fvValue(*fv);
+        canonical += '\0';
+    }
+
+    return std::hash<string>()(canonical);
 }
 
-// Get the cache entry state
-AppRestartAssist::cache_state_t AppRestartAssist::getCacheEntryState(const std::vector<FieldValueTuple> &fvVector)
+// Compare two sets of f/v pairs regardless of their order
+bool AppRestartAssist::isSameFV(std::vector<FieldValueTuple> left, std::vector<FieldValueTuple> right)
 {
-    for (auto &iter : cacheStateMap)
+    if (left.size() != right.size())
     {
-        if (fvVector.back().second == iter.second)
-        {
-            return iter.first;
-        }
+        return false;
     }
-    throw std::logic_error("cache entry state is invalid");
+
+    sort(left.begin(), left.end());
+    sort(right.begin(), right.end());
+    return left == right;
 }
 
 void AppRestartAssist::appDataReplayed()
@@ -127,15 +142,18 @@ void AppRestartAssist::warmStartDisabled()
     WarmStart::setWarmStartState(m_appName, WarmStart::WSDISABLED);
 }
 
-// Read table(s) from APPDB and append stale flag then insert to cachemap
+// Read table(s) from APPDB and insert their hashes to cachemap as STALE
 void AppRestartAssist::readTablesToMap()
 {
     vector<string> keys;
+    auto start = chrono::steady_clock::now();
 
+    m_restoredEntries = 0;
     for (auto it = m_appTables.begin(); it != m_appTables.end(); it++)
     {
         (it->second)->getKeys(keys);
-        FieldValueTuple state(CACHE_STATE_FIELD, "");
+        auto &cache = appTableCacheMap[it->first];
+        cache.reserve(keys.size());
 
         for (const auto &key: keys)
         {
@@ -147,20 +165,18 @@ void AppRestartAssist::readTablesToMap()
                 continue;
             }
 
-            fv.push_back(state);
-            setCacheEntryState(fv, STALE);
+            SWSS_LOG_INFO("write to cachemap: %s, key: %s",
+                          (it->first).c_str(), key.c_str());
 
-            string s = joinVectorString(fv);
-
-            SWSS_LOG_INFO("write to cachemap: %s, key: %s, "
-                   "%s", (it->first).c_str(), key.c_str(), s.c_str());
-
-            // insert to the cache map
-            appTableCacheMap[it->first][key] = fv;
+            // insert to the cache map, only the hash is needed for restored entries
+            cache[key] = {hashFV(fv), STALE, false, {}};
+            m_restoredEntries++;
         }
         WarmStart::setWarmStartState(m_appName, WarmStart::RESTORED);
         SWSS_LOG_NOTICE("Restored appDB table to %s internal cache map", (it->first).c_str());
     }
+
+    m_restoreDuration = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start);
     return;
 }
 
@@ -178,133 +194,250 @@ void AppRestartAssist::readTablesToMap()
  */
 void AppRestartAssist::insertToMap(string tableName, string key, vector<FieldValueTuple> fvVector, bool delete_key)
 {
-    SWSS_LOG_INFO("Received message %s, key: %s, "
-            "%s, delete = %d", tableName.c_str(), key.c_str(), joinVectorString(fvVector).c_str(), delete_key);
+    SWSS_LOG_INFO("Received message %s, key: %s, delete = %d",
+                  tableName.c_str(), key.c_str(), delete_key);
 
-    auto found = appTableCacheMap[tableName].find(key);
+    auto &cache = appTableCacheMap[tableName];
+    auto found = cache.find(key);
 
     if (delete_key)
     {
         SWSS_LOG_NOTICE("%s, delete key: %s, ", tableName.c_str(), key.c_str());
         /* mark it as DELETE if exist, otherwise, no-op */
-        if (found != appTableCacheMap[tableName].end())
+        if (found != cache.end())
         {
-            setCacheEntryState(found->second, DELETE);
+            found->second.state = DELETE;
+            found->second.verify = false;
+            found->second.fvVector.clear();
         }
+        return;
     }
-    else if (found != appTableCacheMap[tableName].end())
+
+    uint64_t hash = hashFV(fvVector);
+
+    if (found != cache.end())
     {
-        // check only the original vector range (exclude cache-state field/value)
-        if(! contains(found->second, fvVector))
+        /*
+         * Equal hashes are confirmed with the f/v pairs, so that a hash collision
+         * can't hide an update. Only the hash of restored entries is cached, so
+         * they are marked SAME until their f/v pairs are read back from appDB,
+         * in one batch per table, at reconcile time.
+         */
+        bool same = false;
+        if (found->second.hash == hash)
         {
-            SWSS_LOG_NOTICE("%s, found key: %s, new value ", tableName.c_str(), key.c_str());
+            same = found->second.state != NEW || isSameFV(found->second.fvVector, fvVector);
+        }
 
-            FieldValueTuple state(CACHE_STATE_FIELD, "");
-            fvVector.push_back(state);
+        if (!same)
+        {
+            SWSS_LOG_NOTICE("%s, found key: %s, new value ", tableName.c_str(), key.c_str());
 
             // mark as NEW flag
-            setCacheEntryState(fvVector, NEW);
-            appTableCacheMap[tableName][key] = fvVector;
+            found->second = {hash, NEW, false, std::move(fvVector)};
+        }
+        /*
+         * In case an entry has been updated for more than once with the same value but different from the stored one,
+         * keep the state as NEW.
+         * Eg.
+         * Assume the entry's value that is restored from last warm reboot is V0.
+         * 1. The first update with value V1 is received and handled by the above branch,
+         *    - state is set to NEW
+         *    - value is updated to V1
+         * 2. The second update with the same value V1 is received and handled by this branch
+         *    - Originally, state was set to SAME, which is wrong because V1 is different from the stored value V0
+         *    - The correct logic should be: set the state to same only if the state is not NEW
+         * This is a very rare case because in most of times the entry won't be updated for multiple times
+         */
+        else if (found->second.state == NEW)
+        {
+            SWSS_LOG_NOTICE("%s, found key: %s, it has been updated for the second time, keep state as NEW",
+                            tableName.c_str(), key.c_str());
         }
         else
         {
-            auto state = getCacheEntryState(found->second);
-            /*
-             * In case an entry has been updated for more than once with the same value but different from the stored one,
-             * keep the state as NEW.
-             * Eg.
-             * Assume the entry's value that is restored from last warm reboot is V0.
-             * 1. The first update with value V1 is received and handled by the above `if (found != appTableCacheMap[tableName].end())` branch,
-             *    - state is set to NEW
-             *    - value is updated to V1
-             * 2. The second update with the same value V1 is received and handled by this branch
-             *    - Originally, state was set to SAME, which is wrong because V1 is different from the stored value V0
-             *    - The correct logic should be: set the state to same only if the state is not NEW
-             * This is a very rare case because in most of times the entry won't be updated for multiple times
-             */
-            if (state == NEW)
-            {
-                SWSS_LOG_NOTICE("%s, found key: %s, it has been updated for the second time, keep state as NEW",
-                                tableName.c_str(), key.c_str());
-            }
-            else
-            {
-                SWSS_LOG_INFO("%s, found key: %s, same value", tableName.c_str(), key.c_str());
-                // mark as SAME flag
-                setCacheEntryState(found->second, SAME);
-            }
+            SWSS_LOG_INFO("%s, found key: %s, same value", tableName.c_str(), key.c_str());
+            // mark as SAME flag, the f/v pairs are kept until they are verified
+            found->second = {hash, SAME, true, std::move(fvVector)};
         }
     }
     else
     {
         // not found, mark the entry as NEW and insert to map
         SWSS_LOG_NOTICE("%s, not found key: %s, new", tableName.c_str(), key.c_str());
-        FieldValueTuple state(CACHE_STATE_FIELD, "");
-        fvVector.push_back(state);
-        setCacheEntryState(fvVector, NEW);
-        appTableCacheMap[tableName][key] = fvVector;
+        cache.emplace(key, CacheEntry{hash, NEW, false, std::move(fvVector)});
     }
     return;
 }
 
+/*
+ * Confirm the SAME entries of a table against their f/v pairs in appDB, read
+ * with one pipelined batch of HGETALL commands rather than with a round trip
+ * per entry. Entries that turn out to differ are marked NEW.
+ */
+void AppRestartAssist::verifySameEntries(const std::string &tableName,
+                                         std::unordered_map<std::string, CacheEntry> &cache)
+{
+    vector<CacheEntry *> entries;
+    vector<string> redisKeys;
+    Table *table = m_appTables.at(tableName);
+
+    for (auto &it : cache)
+    {
+        if (it.second.verify)
+        {
+            entries.push_back(&it.second);
+            redisKeys.push_back(table->getKeyName(it.first));
+        }
+    }
+
+    if (entries.empty())
+    {
+        return;
+    }
+
+    redisContext *ctx = m_pipeLine->getDBConnector()->getContext();
+
+    /* Commands queued in the pipeline share its connection, send them first */
+    m_pipeLine->flush();
+
+    for (const auto &redisKey : redisKeys)
+    {
+        RedisCommand hgetall;
+        hgetall.format("HGETALL %s", redisKey.c_str());
+        if (redisAppendFormattedCommand(ctx, hgetall.c_str(), hgetall.length()) != REDIS_OK)
+        {
+            throw std::runtime_error("failed to queue HGETALL " + redisKey);
+        }
+    }
+
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        redisReply *reply = nullptr;
+        if (redisGetReply(ctx, reinterpret_cast<void **>(&reply)) != REDIS_OK || !reply)
+        {
+            throw std::runtime_error("failed to read " + redisKeys[i] + ": " + string(ctx->errstr));
+        }
+
+        vector<FieldValueTuple> restored;
+        if (reply->type == REDIS_REPLY_ARRAY)
+        {
+            for (size_t e = 0; e + 1 < reply->elements; e += 2)
+            {
+                restored.emplace_back(reply->element[e]->str, reply->element[e + 1]->str);
+            }
+        }
+        freeReplyObject(reply);
+
+        CacheEntry *entry = entries[i];
+        entry->verify = false;
+        if (isSameFV(restored, entry->fvVector))
+        {
+            entry->fvVector.clear();
+        }
+        else
+        {
+            SWSS_LOG_NOTICE("%s, key: %s, hash collision, new value", tableName.c_str(),
+                            redisKeys[i].c_str());
+            entry->state = NEW;
+        }
+    }
+}
+
 /*
  * Reconcile logic:
+ *  confirm the "SAME" entries against appDB, the ones that differ become "NEW"
  *  iterate through the cache map
  *  if the entry has "SAME" flag, do nothing
  *  if has "STALE/DELETE" flag, delete it from appDB.
  *  else if "NEW" flag,  add it to appDB
  *  else, throw (should never happen)
+ * The appDB updates of a table are buffered and written in one pipeline flush.
  */
 void AppRestartAssist::reconcile()
 {
     std::string tableName;
+    std::map<cache_state_t, size_t> stateCount = {{STALE, 0}, {SAME, 0}, {NEW, 0}, {DELETE, 0}};
+    auto start = chrono::steady_clock::now();
 
     SWSS_LOG_ENTER();
     for (auto tableIter = appTableCacheMap.begin(); tableIter != appTableCacheMap.end(); ++tableIter)
     {
         tableName = tableIter->first;
+        ProducerStateTable *psTable = m_psTables[tableName];
+
+        bool buffered = m_psTablesBuffered[tableName];
+
+        verifySameEntries(tableName, tableIter->second);
+
+        psTable->setBuffered(true);
         for (auto it = (tableIter->second).begin(); it != (tableIter->second).end(); ++it)
         {
-            string s = joinVectorString(it->second);
-            auto state = getCacheEntryState(it->second);
+            auto state = it->second.state;
+            stateCount[state]++;
 
             if (state == SAME)
             {
-                SWSS_LOG_INFO("%s SAME, key: %s, %s",
-                        tableName.c_str(), it->first.c_str(), s.c_str());
                 continue;
             }
             else if (state == STALE || state == DELETE)
             {
-                SWSS_LOG_NOTICE("%s STALE/DELETE, key: %s, %s",
-                        tableName.c_str(), it->first.c_str(), s.c_str());
+                SWSS_LOG_INFO("%s %s, key: %s", tableName.c_str(),
+                              cacheStateMap.at(state).c_str(), it->first.c_str());
 
                 //delete from appDB
-                m_psTables[tableName]->del(it->first);
+                psTable->del(it->first);
             }
             else if (state == NEW)
             {
-                SWSS_LOG_NOTICE("%s NEW, key: %s, %s",
-                        tableName.c_str(), it->first.c_str(), s.c_str());
+                SWSS_LOG_INFO("%s NEW, key: %s", tableName.c_str(), it->first.c_str());
 
-                //add to appDB, exclude the state
-                it->second.pop_back();
-                m_psTables[tableName]->set(it->first, it->second);
+                //add to appDB
+                psTable->set(it->first, it->second.fvVector);
             }
             else
             {
                 throw std::logic_error("cache entry state is invalid");
             }
         }
+        psTable->flush();
+        psTable->setBuffered(buffered);
+
         // reconcile finished, clear the map, mark the warmstart state
         appTableCacheMap[tableName].clear();
     }
     appTableCacheMap.clear();
+
+    auto duration = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start);
+    SWSS_LOG_NOTICE("%s reconciled in %ld ms: %zu same, %zu stale, %zu deleted, %zu new",
+                    m_appName.c_str(), static_cast<long>(duration.count()),
+                    stateCount[SAME], stateCount[STALE], stateCount[DELETE], stateCount[NEW]);
+    updateReconcileStats(stateCount, duration);
+
     WarmStart::setWarmStartState(m_appName, WarmStart::RECONCILED);
     m_warmStartInProgress = false;
     return;
 }
 
+// Publish restore/reconcile statistics along with the warm restart state
+void AppRestartAssist::updateReconcileStats(const std::map<cache_state_t, size_t> &stateCount,
+                                            std::chrono::milliseconds reconcileDuration)
+{
+    DBConnector stateDb("STATE_DB", 0);
+    Table warmRestartTable(&stateDb, STATE_WARM_RESTART_TABLE_NAME);
+
+    vector<FieldValueTuple> fvVector;
+    fvVector.emplace_back("restored_entries", to_string(m_restoredEntries));
+    fvVector.emplace_back("restore_time_ms", to_string(m_restoreDuration.count()));
+    fvVector.emplace_back("reconcile_time_ms", to_string(reconcileDuration.count()));
+    fvVector.emplace_back("same_entries", to_string(stateCount.at(SAME)));
+    fvVector.emplace_back("stale_entries", to_string(stateCount.at(STALE)));
+    fvVector.emplace_back("deleted_entries", to_string(stateCount.at(DELETE)));
+    fvVector.emplace_back("new_entries", to_string(stateCount.at(NEW)));
+
+    warmRestartTable.set(m_appName, fvVector);
+}
+
 // set the reconcile interval
 void AppRestartAssist::setReconcileInterval(uint32_t time)
 {
@@ -335,18 +468,3 @@ bool AppRestartAssist::checkReconcileTimer(Selectable *s)
     }
     return false;
 }
-
-// check if left vector contains all elements of right vector
-bool AppRestartAssist::contains(const std::vector<FieldValueTuple>& left,
-              const std::vector<FieldValueTuple>& right)
-{
-    for (auto const& rv : right)
-    {
-        if (std::find(left.begin(), left.end(), rv) == left.end())
-        {
-            return false;
-        }
-    }
-
-    return true;
-}
@@ -3,6 +3,7 @@
 
 #include <unordered_map>
 #include <string>
+#include <chrono>
 #include "dbconnector.h"
 #include "table.h"
 #include "producerstatetable.h"
@@ -14,7 +15,9 @@ namespace swss {
 /*
  * This class is to support application table reconciliation
  * For any application table which has entries with key -> vector<f1/v2, f2/v2..>
- * It is expect that the application owner keeps the order of f/v pairs
+ * Entries are compared by a hash of their sorted f/v pairs, so the order in
+ * which the application supplies them does not matter. Equal hashes are
+ * confirmed by comparing the f/v pairs themselves.
  * The application usually takes this class as composition, i.e. includes an instance of
  * this class in their classes.
  * A high level flow to use this class:
@@ -88,13 +91,13 @@ public:
     {
         return m_warmStartInProgress;
     }
-    void registerAppTable(const std::string &tableName, ProducerStateTable *psTable);
+    /* buffered: mode the application uses psTable in, restored after reconcile */
+    void registerAppTable(const std::string &tableName, ProducerStateTable *psTable, bool buffered = false);
 
 private:
     typedef std::map<cache_state_t, std::string> cache_state_map;
     // Enum to string translation map
     static const cache_state_map cacheStateMap;
-    const std::string CACHE_STATE_FIELD = "cache-state";
 
     /*
      * Default timer to be 5 seconds
@@ -102,7 +105,21 @@ private:
      * Precedence ascent order: Default -> loading class with value -> configuration
      */
     static const uint32_t DEFAULT_INTERNAL_TIMER_VALUE = 5;
-    typedef std::map<std::string, std::unordered_map<std::string, std::vector<swss::FieldValueTuple>>> AppTableMap;
+
+    /*
+     * Cache entry: only the hash of the f/v pairs is kept for entries restored
+     * from appDB, the f/v pairs themselves are only needed for NEW entries
+     * which have to be written back at reconcile time, and for SAME entries
+     * until they are verified against appDB.
+     */
+    struct CacheEntry
+    {
+        uint64_t hash;
+        cache_state_t state;
+        bool verify;      // SAME by hash, f/v pairs not yet compared with appDB
+        std::vector<swss::FieldValueTuple> fvVector;
+    };
+    typedef std::map<std::string, std::unordered_map<std::string, CacheEntry>> AppTableMap;
 
     // cache map to store temporary application table
     AppTableMap appTableCacheMap;
@@ -112,17 +129,21 @@ private:
     std::string         m_dockerName; // docker name of the application
     std::string         m_appName;    // application name
     ProducerStateTables m_psTables;   // producer state tables
+    std::map<std::string, bool> m_psTablesBuffered; // buffered mode of the producer state tables
 
     bool m_warmStartInProgress;       // indicate if warm start is in progress
     time_t m_reconcileTimer;          // reconcile timer value
     SelectableTimer m_warmStartTimer; // reconcile timer
 
-    // Set or get cache entry state
-    std::string joinVectorString(const std::vector<FieldValueTuple> &fv);
-    void setCacheEntryState(std::vector<FieldValueTuple> &fvVector, cache_state_t state);
-    cache_state_t getCacheEntryState(const std::vector<FieldValueTuple> &fvVector);
-    bool contains(const std::vector<FieldValueTuple>& left,
-                  const std::vector<FieldValueTuple>& right);
+    std::chrono::milliseconds m_restoreDuration; // time spent in readTablesToMap
+    size_t m_restoredEntries;                     // entries restored from appDB
+
+    uint64_t hashFV(const std::vector<FieldValueTuple> &fvVector);
+    static bool isSameFV(std::vector<FieldValueTuple> left, std::vector<FieldValueTuple> right);
+    void verifySameEntries(const std::string &tableName,
+                           std::unordered_map<std::string, CacheEntry> &cache);
+    void updateReconcileStats(const std::map<cache_state_t, size_t> &stateCount,
+                              std::chrono::milliseconds reconcileDuration);
 };
 
 }
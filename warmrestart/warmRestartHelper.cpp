@@ -1,5 +1,7 @@
 #include <cassert>
 #include <sstream>
+#include <stdexcept>
+#include <hiredis/hiredis.h>
 
 #include "warmRestartHelper.h"
 
@@ -7,13 +9,21 @@
 using namespace swss;
 
 
+/* Number of AppDB keys requested per SCAN iteration in digest mode */
+const uint32_t RESTORATION_SCAN_COUNT = 1000;
+
+
 WarmStartHelper::WarmStartHelper(RedisPipeline      *pipeline,
                                  ProducerStateTable *syncTable,
                                  const std::string  &syncTableName,
                                  const std::string  &dockerName,
-                                 const std::string  &appName) :
-    m_restorationTable(pipeline, syncTableName, false),
+                                 const std::string  &appName,
+                                 bool                digestReconcile) :
+    m_pipeline(pipeline),
     m_syncTable(syncTable),
+    m_db(pipeline->getDBConnector()),
+    m_restorationTable(pipeline, syncTableName, false),
+    m_digestReconcile(digestReconcile),
     m_syncTableName(syncTableName),
     m_dockName(dockerName),
     m_appName(appName)
@@ -66,6 +76,8 @@ bool WarmStartHelper::checkAndStart(void)
 
     /* Cleaning state from previous (unsuccessful) warm-restart attempts */
     m_restorationVector.clear();
+    m_restoredDigests.clear();
+    m_pendingDigests.clear();
     m_refreshMap.clear();
 
     /* Keeping track of warm-reboot active/inactive state */
@@ -104,13 +116,23 @@ bool WarmStartHelper::runRestoration()
     SWSS_LOG_NOTICE("Warm-Restart: Initiating AppDB restoration process for %s "
                     "application.", m_appName.c_str());
 
-    m_restorationTable.getContent(m_restorationVector);
+    size_t restored;
+
+    if (m_digestReconcile)
+    {
+        restored = restoreDigests();
+    }
+    else
+    {
+        m_restorationTable.getContent(m_restorationVector);
+        restored = m_restorationVector.size();
+    }
 
     /*
      * If there's no AppDB state to restore, then alert callee right away to avoid
      * iterating through the 'reconciliation' process.
      */
-    if (!m_restorationVector.size())
+    if (!restored)
     {
         SWSS_LOG_NOTICE("Warm-Restart: No records received from AppDB for %s "
                         "application.", m_appName.c_str());
@@ -122,7 +144,7 @@ bool WarmStartHelper::runRestoration()
 
     SWSS_LOG_NOTICE("Warm-Restart: Received %zu records from AppDB for %s "
                     "application.",
-                    m_restorationVector.size(),
+                    restored,
                     m_appName.c_str());
 
     setState(WarmStart::RESTORED);
@@ -134,10 +156,179 @@ bool WarmStartHelper::runRestoration()
 }
 
 
+/*
+ * Digest-reconciliation mode: the old state is streamed from AppDB in chunks
+ * and only a hash of each element's field-values is kept, instead of a full
+ * copy of the table.
+ */
+size_t WarmStartHelper::restoreDigests(void)
+{
+    const std::string pattern = m_restorationTable.getKeyName("*");
+    const size_t prefixLen = m_restorationTable.getKeyName("").size();
+    int cursor = 0;
+
+    do
+    {
+        auto chunk = m_db->scan(cursor, pattern.c_str(), RESTORATION_SCAN_COUNT);
+        cursor = chunk.first;
+
+        std::vector<std::vector<FieldValueTuple>> fvs;
+        readEntries(chunk.second, fvs);
+
+        for (size_t i = 0; i < chunk.second.size(); i++)
+        {
+            /* Element removed since the scan */
+            if (fvs[i].empty())
+            {
+                continue;
+            }
+
+            std::string key = chunk.second[i].substr(prefixLen);
+            m_restoredDigests[key] = {digestFV(fvs[i]), false, false};
+        }
+    } while (cursor != 0);
+
+    return m_restoredDigests.size();
+}
+
+
+/*
+ * Read the field-values of AppDB elements with one pipelined batch of HGETALL
+ * commands, rather than with a round trip per element.
+ */
+void WarmStartHelper::readEntries(const std::vector<std::string>       &redisKeys,
+                                  std::vector<std::vector<FieldValueTuple>> &fvs)
+{
+    redisContext *ctx = m_db->getContext();
+
+    fvs.assign(redisKeys.size(), std::vector<FieldValueTuple>());
+
+    /* Commands queued in the pipeline share its connection, send them first */
+    m_pipeline->flush();
+
+    for (const auto &redisKey : redisKeys)
+    {
+        RedisCommand hgetall;
+        hgetall.format("HGETALL %s", redisKey.c_str());
+        if (redisAppendFormattedCommand(ctx, hgetall.c_str(), hgetall.length()) != REDIS_OK)
+        {
+            throw std::runtime_error("Warm-Restart: failed to queue HGETALL " + redisKey);
+        }
+    }
+
+    for (size_t i = 0; i < redisKeys.size(); i++)
+    {
+        redisReply *reply = nullptr;
+        if (redisGetReply(ctx, reinterpret_cast<void **>(&reply)) != REDIS_OK || !reply)
+        {
+            throw std::runtime_error("Warm-Restart: failed to read " + redisKeys[i] +
+                                     ": " + std::string(ctx->errstr));
+        }
+
+        if (reply->type == REDIS_REPLY_ARRAY)
+        {
+            for (size_t e = 0; e + 1 < reply->elements; e += 2)
+            {
+                fvs[i].emplace_back(reply->element[e]->str, reply->element[e + 1]->str);
+            }
+        }
+
+        freeReplyObject(reply);
+    }
+}
+
+
+/*
+ * Digests only filter out the refreshed elements which are likely unchanged.
+ * These elements are held until their restored content is read back from
+ * AppDB, in batches, and fully compared with the refreshed one, so that a
+ * digest collision can't hide an update.
+ */
+void WarmStartHelper::verifyPendingDigests(void)
+{
+    if (m_pendingDigests.empty())
+    {
+        return;
+    }
+
+    std::vector<std::string> redisKeys;
+    redisKeys.reserve(m_pendingDigests.size());
+    for (const auto &key : m_pendingDigests)
+    {
+        redisKeys.push_back(m_restorationTable.getKeyName(key));
+    }
+
+    std::vector<std::vector<FieldValueTuple>> fvs;
+    readEntries(redisKeys, fvs);
+
+    for (size_t i = 0; i < m_pendingDigests.size(); i++)
+    {
+        const std::string &key = m_pendingDigests[i];
+
+        /* Refreshed again with a different content, or already verified */
+        auto restored = m_restoredDigests.find(key);
+        if (restored == m_restoredDigests.end() || !restored->second.pending)
+        {
+            continue;
+        }
+        restored->second.pending = false;
+
+        auto refreshed = m_refreshMap.find(key);
+        if (refreshed == m_refreshMap.end())
+        {
+            continue;
+        }
+
+        const auto &refreshedFV = kfvFieldsValues(refreshed->second);
+        if (fvs[i].size() == refreshedFV.size() && !compareAllFV(fvs[i], refreshedFV))
+        {
+            /*
+             * Refreshed elements matching their restored state need no action
+             * during reconciliation, so there's no need to hold them.
+             */
+            restored->second.refreshed = true;
+            m_refreshMap.erase(refreshed);
+        }
+    }
+
+    m_pendingDigests.clear();
+}
+
+
 void WarmStartHelper::insertRefreshMap(const KeyOpFieldsValuesTuple &kfv)
 {
     const std::string key = kfvKey(kfv);
 
+    if (m_digestReconcile)
+    {
+        auto iter = m_restoredDigests.find(key);
+        if (iter != m_restoredDigests.end())
+        {
+            iter->second.refreshed = false;
+
+            /* Likely unchanged, held until fully compared in a batch */
+            if (kfvOp(kfv) == SET_COMMAND &&
+                iter->second.digest == digestFV(kfvFieldsValues(kfv)))
+            {
+                if (!iter->second.pending)
+                {
+                    iter->second.pending = true;
+                    m_pendingDigests.push_back(key);
+                }
+
+                m_refreshMap[key] = kfv;
+
+                if (m_pendingDigests.size() >= RESTORATION_SCAN_COUNT)
+                {
+                    verifyPendingDigests();
+                }
+                return;
+            }
+
+            iter->second.pending = false;
+        }
+    }
+
     m_refreshMap[key] = kfv;
 }
 
@@ -156,6 +347,12 @@ void WarmStartHelper::reconcile(void)
 
     assert(getState() == WarmStart::RESTORED);
 
+    if (m_digestReconcile)
+    {
+        verifyPendingDigests();
+        reconcileDigests();
+    }
+
     for (auto &restoredElem : m_restorationVector)
     {
         std::string restoredKey  = kfvKey(restoredElem);
@@ -252,6 +449,8 @@ void WarmStartHelper::reconcile(void)
 
     /* Clearing restoration vector */
     m_restorationVector.clear();
+    m_restoredDigests.clear();
+    m_pendingDigests.clear();
 
     setState(WarmStart::RECONCILED);
 
@@ -260,6 +459,95 @@ void WarmStartHelper::reconcile(void)
 }
 
 
+/*
+ * Digest-reconciliation counterpart of the restored-elements loop in
+ * reconcile(). Only the elements which have been refreshed with a different
+ * content, explicitly deleted, or not refreshed at all are pushed to AppDB.
+ */
+void WarmStartHelper::reconcileDigests(void)
+{
+    for (auto &restoredElem : m_restoredDigests)
+    {
+        const std::string &restoredKey = restoredElem.first;
+
+        auto iter = m_refreshMap.find(restoredKey);
+
+        if (iter == m_refreshMap.end())
+        {
+            if (restoredElem.second.refreshed)
+            {
+                SWSS_LOG_INFO("Warm-Restart reconciliation: no changes needed for "
+                              "existing entry %s", restoredKey.c_str());
+            }
+            else
+            {
+                SWSS_LOG_NOTICE("Warm-Restart reconciliation: deleting stale entry %s",
+                                restoredKey.c_str());
+
+                m_syncTable->del(restoredKey);
+            }
+            continue;
+        }
+
+        if (kfvOp(iter->second) == DEL_COMMAND)
+        {
+            SWSS_LOG_NOTICE("Warm-Restart reconciliation: deleting entry %s",
+                            restoredKey.c_str());
+
+            m_syncTable->del(restoredKey);
+        }
+        else
+        {
+            auto refreshedFV = kfvFieldsValues(iter->second);
+
+            SWSS_LOG_NOTICE("Warm-Restart reconciliation: updating entry %s",
+                            printKFV(restoredKey, refreshedFV).c_str());
+
+            m_syncTable->set(restoredKey, refreshedFV);
+        }
+
+        /* Deleting the just-processed restored entry from the refreshMap */
+        m_refreshMap.erase(iter);
+    }
+}
+
+
+/*
+ * Hash of the field-value-tuples of an element. Fields, and the
+ * comma-separated values within a field, are sorted first, so that two
+ * elements considered equal by compareAllFV() have the same digest. Equal
+ * digests are only a hint, see verifyPendingDigests().
+ */
+uint64_t WarmStartHelper::digestFV(const std::vector<FieldValueTuple> &fv)
+{
+    std::vector<std::string> fields;
+    fields.reserve(fv.size());
+
+    for (auto &tuple : fv)
+    {
+        std::vector<std::string> values = tokenize(fvValue(tuple), ',');
+        std::sort(values.begin(), values.end());
+
+        std::string field = fvField(tuple) + "=";
+        for (auto &value : values)
+        {
+            field += value + ",";
+        }
+        fields.push_back(std::move(field));
+    }
+
+    std::sort(fields.begin(), fields.end());
+
+    std::string canonical;
+    for (auto &field : fields)
+    {
+        canonical += field + "\n";
+    }
+
+    return std::hash<std::string>()(canonical);
+}
+
+
 /*
  * Compare all field-value-tuples within two vectors.
  *
@@ -25,7 +25,8 @@ class WarmStartHelper {
                     ProducerStateTable *syncTable,
                     const std::string  &syncTableName,
                     const std::string  &dockerName,
-                    const std::string  &appName);
+                    const std::string  &appName,
+                    bool                digestReconcile = false);
 
     ~WarmStartHelper();
 
@@ -38,6 +39,22 @@ class WarmStartHelper {
      */
     using kfvMap = std::unordered_map<std::string, KeyOpFieldsValuesTuple>;
 
+    /*
+     * Restored element kept in digest-reconciliation mode: hash of its
+     * field-values, whether the application refreshed it with the very
+     * same content, and whether a refresh with the same hash is waiting to
+     * be fully compared with the restored content.
+     */
+    struct RestoredDigest
+    {
+        uint64_t digest;
+        bool     refreshed;
+        bool     pending;
+    };
+
+    /* digestMap type to host AppDB restored elements in digest mode */
+    using digestMap = std::unordered_map<std::string, RestoredDigest>;
+
     void setState(WarmStart::WarmStartState state);
 
     WarmStart::WarmStartState getState(void) const;
@@ -61,14 +78,30 @@ class WarmStartHelper {
 
   private:
 
+    size_t restoreDigests(void);
+
+    void readEntries(const std::vector<std::string>       &redisKeys,
+                     std::vector<std::vector<FieldValueTuple>> &fvs);
+
+    void verifyPendingDigests(void);
+
+    void reconcileDigests(void);
+
+    uint64_t digestFV(const std::vector<FieldValueTuple> &fv);
+
     bool compareAllFV(const std::vector<FieldValueTuple> &left,
                       const std::vector<FieldValueTuple> &right);
 
     bool compareOneFV(const std::string &v1, const std::string &v2);
 
+    RedisPipeline            *m_pipeline;          // redis pipeline shared with the producer-table
     ProducerStateTable       *m_syncTable;         // producer-table to sync/push state to
+    DBConnector              *m_db;                // redis db to stream old state from
     Table                     m_restorationTable;  // redis table to import current-state from
     kfvVector                 m_restorationVector; // buffer struct to hold old state
+    digestMap                 m_restoredDigests;   // old state digests in digest mode
+    std::vector<std::string>  m_pendingDigests;    // refreshed keys with a digest to verify
+    bool                      m_digestReconcile;   // reconcile against digests of old state
     kfvMap                    m_refreshMap;        // buffer struct to hold new state
     WarmStart::WarmStartState m_state;             // cached value of warmStart's FSM state
     bool                      m_enabled;           // warm-reboot enabled/disabled status